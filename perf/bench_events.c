@@ -0,0 +1,153 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bench_events.c
+ *
+ *    Description:  Compares the level-bucketed event queue with the generic
+ *                  priority queue, and event-driven with full-sweep simulation
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "globals.h"
+#include "parser_netlist.h"
+#include "fault_simulation.h"
+#include "test_generator.h"
+#include "event_queue.h"
+#include "test_cube.h"
+#include "pqueue.h"
+#include "ptime.h"
+
+#define PATTERNS 256
+
+CIRCUIT circuit;
+CIRCUIT_INFO info;
+TEST_CUBE patterns[PATTERNS];
+TEST_CUBE output;
+
+/*
+ *  Visits every gate reachable from the inputs in level order through a
+ *  priority queue allocated for the traversal, as the simulator used to
+ *
+ *  @return int - the number of gates dequeued
+ */
+int traversePriorityQueue( uint8_t* scheduled )
+{
+    PQueue* queue = pqueue_new(cmpGateLevels, info.numGates + 1);
+    int K, L, gate, visited = 0;
+
+    for(K = 0; K < info.numPI; K++)
+    {
+        scheduled[info.inputs[K]] = 1;
+        pqueue_enqueue(queue, &circuit.level[info.inputs[K]]);
+    }
+    while(!is_empty(queue))
+    {
+        gate = (int32_t*) pqueue_dequeue(queue) - circuit.level;
+        scheduled[gate] = 0;
+        visited++;
+        for(L = 0; L < NUM_FANOUT(&circuit, gate); L++)
+            if(!scheduled[FANOUT(&circuit, gate, L)])
+            {
+                scheduled[FANOUT(&circuit, gate, L)] = 1;
+                pqueue_enqueue(queue, &circuit.level[FANOUT(&circuit, gate, L)]);
+            }
+    }
+    pqueue_delete(queue);
+    return visited;
+}
+
+/*
+ *  Visits every gate reachable from the inputs in level order through the
+ *  circuit's event queue
+ *
+ *  @return int - the number of gates dequeued
+ */
+int traverseEventQueue( void )
+{
+    int K, L, gate, visited = 0;
+
+    for(K = 0; K < info.numPI; K++)
+        scheduleEvent(&circuit.events, info.inputs[K], circuit.level[info.inputs[K]]);
+    while((gate = nextEvent(&circuit.events)) >= 0)
+    {
+        visited++;
+        for(L = 0; L < NUM_FANOUT(&circuit, gate); L++)
+            scheduleEvent(&circuit.events, FANOUT(&circuit, gate, L),
+                          circuit.level[FANOUT(&circuit, gate, L)]);
+    }
+    return visited;
+}
+
+/*
+ *  Usage: bench_events <netlist> [<netlist> ...]
+ */
+int main( int argc, char* argv[] )
+{
+    STOP_WATCH sw;
+    int K, P, N;
+
+    srand(1);
+    fprintf(stdout, "%-24s %8s %8s %12s %12s %8s %12s %12s %8s\n", "netlist", "gates", "visited",
+            "pqueue (ms)", "events (ms)", "queue", "event (ms)", "sweep (ms)", "sim");
+    for(K = 1; K < argc; K++)
+    {
+        if(populateCircuit(&circuit, &info, argv[K]) == FALSE)
+        {
+            fprintf(stderr, "Failed to parse \"%s\"\n", argv[K]);
+            continue;
+        }
+        computeGateLevels(&circuit, &info);
+
+        for(P = 0; P < PATTERNS; P++)
+        {
+            clearCube(&patterns[P], info.numPI);
+            for(N = 0; N < info.numPI; N++) setCubeValue(&patterns[P], N, (rand() % 2) ? I : O);
+        }
+
+        // Queue operations alone, one full traversal per pattern
+        uint8_t* scheduled = (uint8_t*) calloc(info.numGates, sizeof(uint8_t));
+        int visited = 0;
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++) visited = traversePriorityQueue(scheduled);
+        double pqueue = getElaspedTimeSW(&sw);
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++) traverseEventQueue();
+        double events = getElaspedTimeSW(&sw);
+        free(scheduled);
+
+        // Fault-free simulation of the patterns
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            clearPropagationValuesCircuit(&circuit, info.numGates);
+            generate_output(&circuit, &info, &patterns[P], &output);
+        }
+        double eventSim = getElaspedTimeSW(&sw);
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+            sweep_pattern(&circuit, &info, &patterns[P], NULL, NULL, &output);
+        double sweepSim = getElaspedTimeSW(&sw);
+
+        fprintf(stdout, "%-24s %8d %8d %12.3f %12.3f %7.2fx %12.3f %12.3f %7.2fx\n", argv[K],
+                info.numGates, visited, pqueue * 1000, events * 1000, pqueue / events,
+                eventSim * 1000, sweepSim * 1000, eventSim / sweepSim);
+        clearCircuit(&circuit, &info);
+    }
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bench_fault_sim.c
+ *
+ *    Description:  Compares the serial fault simulator with the deductive, the
+ *                  concurrent and the parallel-pattern single-fault propagation
+ *                  ones on random test patterns
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "globals.h"
+#include "parser_netlist.h"
+#include "fault_list.h"
+#include "fault_simulation.h"
+#include "parallel_simulation.h"
+#include "deductive_simulation.h"
+#include "concurrent_simulation.h"
+#include "test_generator.h"
+#include "test_cube.h"
+#include "ptime.h"
+
+#define PATTERNS 256
+
+CIRCUIT circuit;
+CIRCUIT_INFO info;
+FAULT_LIST serial, deductive, concurrent, parallel;
+PARALLEL_SIMULATOR simulator;
+DEDUCTIVE_SIMULATOR deducer;
+CONCURRENT_SIMULATOR concurrer;
+TEST_VECTOR tv[PATTERNS];
+
+/*
+ *  Usage: bench_fault_sim <netlist> [<netlist> ...]
+ */
+int main( int argc, char* argv[] )
+{
+    STOP_WATCH sw;
+    int K, P, N;
+
+    srand(1);
+    fprintf(stdout, "%-24s %8s %8s %12s %14s %15s %12s %8s %10s %10s %10s %10s %10s\n", "netlist", "gates",
+            "faults", "serial (ms)", "deductive (ms)", "concurrent (ms)", "ppsfp (ms)", "speedup", "serial",
+            "deductive", "concurrent", "ppsfp", "lists (KB)");
+    for(K = 1; K < argc; K++)
+    {
+        if(populateCircuit(&circuit, &info, argv[K]) == FALSE)
+        {
+            fprintf(stderr, "Failed to parse \"%s\"\n", argv[K]);
+            continue;
+        }
+        computeGateLevels(&circuit, &info);
+        buildParallelSimulator(&simulator, &circuit, &info, findParallelKernel("scalar"));
+        buildDeductiveSimulator(&deducer, &circuit, &info);
+        buildConcurrentSimulator(&concurrer, &circuit, &info, (size_t) CONCURRENT_MEMORY_MB << 20);
+
+        // Both stuck-at faults of every gate
+        allocateFaultList(&serial, 2 * info.numGates);
+        allocateFaultList(&deductive, 2 * info.numGates);
+        allocateFaultList(&concurrent, 2 * info.numGates);
+        allocateFaultList(&parallel, 2 * info.numGates);
+        for(N = 0; N < 2 * info.numGates; N++)
+        {
+            appendFault(&serial, N / 2, -1, (N % 2) ? ST_1 : ST_0);
+            appendFault(&deductive, N / 2, -1, (N % 2) ? ST_1 : ST_0);
+            appendFault(&concurrent, N / 2, -1, (N % 2) ? ST_1 : ST_0);
+            appendFault(&parallel, N / 2, -1, (N % 2) ? ST_1 : ST_0);
+        }
+
+        for(P = 0; P < PATTERNS; P++)
+        {
+            clearCube(&tv[P].input, info.numPI);
+            for(N = 0; N < info.numPI; N++) setCubeValue(&tv[P].input, N, (rand() % 2) ? I : O);
+        }
+
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            tv[P].faults_count = 0;
+            sweep_pattern(&circuit, &info, &tv[P].input, NULL, NULL, &tv[P].output);
+            simulateTestVector(&circuit, &info, &serial, &tv[P], 0);
+        }
+        double bySerial = getElaspedTimeSW(&sw);
+
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            tv[P].faults_count = 0;
+            sweep_pattern(&circuit, &info, &tv[P].input, NULL, NULL, &tv[P].output);
+            simulateDeductiveVector(&deducer, &circuit, &info, &deductive, &tv[P], 0);
+        }
+        double byDeductive = getElaspedTimeSW(&sw);
+
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            tv[P].faults_count = 0;
+            sweep_pattern(&circuit, &info, &tv[P].input, NULL, NULL, &tv[P].output);
+            simulateConcurrentVector(&concurrer, &circuit, &info, &concurrent, &tv[P], 0);
+        }
+        double byConcurrent = getElaspedTimeSW(&sw);
+
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P += PARALLEL_PATTERNS)
+        {
+            for(N = 0; N < PARALLEL_PATTERNS; N++) tv[P + N].faults_count = 0;
+            simulateParallelPatterns(&simulator, &circuit, &info, &tv[P], PARALLEL_PATTERNS);
+            for(N = 0; N < PARALLEL_PATTERNS; N++)
+                collectParallelOutputs(&simulator, &info, N, &tv[P + N].output);
+            dropParallelFaults(&simulator, &circuit, &info, &parallel, &tv[P], 0);
+        }
+        double byParallel = getElaspedTimeSW(&sw);
+
+        fprintf(stdout, "%-24s %8d %8d %12.3f %14.3f %15.3f %12.3f %7.2fx %10d %10d %10d %10d %10.1f\n", argv[K],
+                info.numGates, serial.count, bySerial * 1000, byDeductive * 1000, byConcurrent * 1000,
+                byParallel * 1000, bySerial / byParallel, countFaults(&serial, FAULT_DETECTED),
+                countFaults(&deductive, FAULT_DETECTED), countFaults(&concurrent, FAULT_DETECTED),
+                countFaults(&parallel, FAULT_DETECTED), concurrer.peakMemory / 1024.0);
+
+        clearFaultList(&serial);
+        clearFaultList(&deductive);
+        clearFaultList(&concurrent);
+        clearFaultList(&parallel);
+        clearCircuit(&circuit, &info);
+    }
+    releaseParallelSimulator(&simulator);
+    releaseDeductiveSimulator(&deducer);
+    releaseConcurrentSimulator(&concurrer);
+    for(P = 0; P < PATTERNS; P++) releaseTestVector(&tv[P]);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bench_kernel_width.c
+ *
+ *    Description:  Measures the test patterns per second of every fault simulation
+ *                  kernel the CPU runs, 64 to 512 patterns at once
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "globals.h"
+#include "parser_netlist.h"
+#include "fault_list.h"
+#include "parallel_simulation.h"
+#include "test_generator.h"
+#include "test_cube.h"
+#include "ptime.h"
+
+#define PATTERNS 4096
+#define GOOD_ROUNDS 4
+#define NO_DROP_PATTERNS 1024
+
+CIRCUIT circuit;
+CIRCUIT_INFO info;
+FAULT_LIST faultList;
+PARALLEL_SIMULATOR simulator;
+TEST_VECTOR tv[PATTERNS];
+
+/*
+ *  Usage: bench_kernel_width <netlist> [<netlist> ...]
+ *
+ *  Every kernel simulates the same random test patterns: the fault-free circuit
+ *  alone, every fault of the list without dropping any, and the list with
+ *  fault dropping, the list holding the stuck-at faults of every gate. The
+ *  kernels must detect the same faults.
+ */
+int main( int argc, char* argv[] )
+{
+    const PARALLEL_KERNEL* kernel;
+    STOP_WATCH sw;
+    int K, N, P, R, block, detected, reference;
+
+    srand(1);
+    fprintf(stdout, "%-24s %8s %8s %-10s %6s %14s %14s %14s %10s\n", "netlist", "gates", "faults", "kernel",
+            "width", "good (pat/s)", "no drop (pat/s)", "drop (pat/s)", "detected");
+    for(K = 1; K < argc; K++)
+    {
+        if(populateCircuit(&circuit, &info, argv[K]) == FALSE)
+        {
+            fprintf(stderr, "Failed to parse \"%s\"\n", argv[K]);
+            continue;
+        }
+        computeGateLevels(&circuit, &info);
+
+        for(P = 0; P < PATTERNS; P++)
+        {
+            clearCube(&tv[P].input, info.numPI);
+            for(N = 0; N < info.numPI; N++) setCubeValue(&tv[P].input, N, (rand() % 2) ? I : O);
+        }
+
+        reference = -1;
+        for(N = 0; N < NUM_PARALLEL_KERNELS; N++)
+        {
+            kernel = PARALLEL_KERNELS[N];
+            if(kernel->isSupported() == FALSE) continue;
+            buildParallelSimulator(&simulator, &circuit, &info, kernel);
+            block = kernel->numPatterns;
+
+            // Fault-free circuit
+            startSW(&sw);
+            for(R = 0; R < GOOD_ROUNDS; R++)
+                for(P = 0; P < PATTERNS; P += block)
+                    simulateParallelPatterns(&simulator, &circuit, &info, &tv[P], block);
+            double byGood = getElaspedTimeSW(&sw);
+
+            // Both stuck-at faults of every gate, every one simulated for every block
+            allocateFaultList(&faultList, 2 * info.numGates);
+            for(P = 0; P < 2 * info.numGates; P++)
+                appendFault(&faultList, P / 2, -1, (P % 2) ? ST_1 : ST_0);
+
+            startSW(&sw);
+            for(P = 0; P < NO_DROP_PATTERNS; P += block)
+            {
+                simulateParallelPatterns(&simulator, &circuit, &info, &tv[P], block);
+                for(R = 0; R < faultList.count; R++)
+                    simulateParallelFault(&simulator, &circuit, &info, &faultList.faults[R]);
+            }
+            double byEveryFault = getElaspedTimeSW(&sw);
+
+            // The faults dropped once detected
+            startSW(&sw);
+            for(P = 0; P < PATTERNS; P += block)
+            {
+                for(R = 0; R < block; R++) tv[P + R].faults_count = 0;
+                simulateParallelPatterns(&simulator, &circuit, &info, &tv[P], block);
+                for(R = 0; R < block; R++)
+                    collectParallelOutputs(&simulator, &info, R, &tv[P + R].output);
+                dropParallelFaults(&simulator, &circuit, &info, &faultList, &tv[P], 0);
+            }
+            double byFaults = getElaspedTimeSW(&sw);
+
+            detected = countFaults(&faultList, FAULT_DETECTED);
+            if(reference < 0) reference = detected;
+            fprintf(stdout, "%-24s %8d %8d %-10s %6d %14.0f %14.0f %14.0f %10d%s\n", argv[K], info.numGates,
+                    faultList.count, kernel->name, block, GOOD_ROUNDS * PATTERNS / byGood,
+                    NO_DROP_PATTERNS / byEveryFault, PATTERNS / byFaults, detected,
+                    (detected == reference) ? "" : " MISMATCH");
+            clearFaultList(&faultList);
+        }
+
+        clearCircuit(&circuit, &info);
+    }
+    releaseParallelSimulator(&simulator);
+    for(P = 0; P < PATTERNS; P++) releaseTestVector(&tv[P]);
+    return 0;
+}
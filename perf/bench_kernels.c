@@ -0,0 +1,170 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bench_kernels.c
+ *
+ *    Description:  Compares gate evaluation through the per-gate kernels with
+ *                  evaluation switching on the gate type, in full sweeps
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "globals.h"
+#include "parser_netlist.h"
+#include "fault_simulation.h"
+#include "logic_tables.h"
+#include "test_cube.h"
+#include "ptime.h"
+
+#define PATTERNS 1024
+#define ROUNDS   16
+
+CIRCUIT circuit;
+CIRCUIT_INFO info;
+TEST_CUBE patterns[PATTERNS];
+
+/*
+ *  Evaluates a gate by switching on its type and folding its inputs through
+ *  the logic tables one at a time
+ *
+ *  @param  uint8_t* value  - the value of every gate
+ *  @param  int     gate    - the gate to evaluate
+ *  @return LOGIC_VALUE - the gate's output
+ */
+LOGIC_VALUE evaluateGateByType( uint8_t* value, int gate )
+{
+    int K = circuit.faninStart[gate], end = circuit.faninStart[gate + 1];
+    LOGIC_VALUE result;
+    if(K == end) return X;
+
+    switch(circuit.type[gate])
+    {
+        case AND:
+            result = value[circuit.fanin[K]];
+            while(++K < end) result = TABLE_AND[result][value[circuit.fanin[K]]];
+            return negate(result, circuit.inv[gate]);
+        case OR:
+            result = value[circuit.fanin[K]];
+            while(++K < end) result = TABLE_OR[result][value[circuit.fanin[K]]];
+            return negate(result, circuit.inv[gate]);
+        case XOR:
+            result = value[circuit.fanin[K]];
+            while(++K < end) result = TABLE_XOR[result][value[circuit.fanin[K]]];
+            return negate(result, circuit.inv[gate]);
+        case BUF:
+            return negate(value[circuit.fanin[K]], circuit.inv[gate]);
+        default:
+            return X;
+    }
+}
+
+/*
+ *  Evaluates every gate of the circuit in order for a pattern, switching on
+ *  the gate types
+ *
+ *  @param  uint8_t* value  - receives the value of every gate
+ *  @param  const TEST_CUBE* pattern - the input gates' values
+ *  @return nothing
+ */
+void sweepByType( uint8_t* value, const TEST_CUBE* pattern )
+{
+    int K, gate;
+    for(K = 0; K < info.numPI; K++) value[info.inputs[K]] = CUBE_VALUE(pattern, K);
+    for(K = 0; K < info.numGates; K++)
+    {
+        gate = circuit.order[K];
+        if(circuit.type[gate] != PI) value[gate] = evaluateGateByType(value, gate);
+    }
+}
+
+/*
+ *  Evaluates every gate of the circuit in order for a pattern through the
+ *  gate kernels
+ *
+ *  @param  uint8_t* value  - receives the value of every gate
+ *  @param  const TEST_CUBE* pattern - the input gates' values
+ *  @return nothing
+ */
+void sweepByKernel( uint8_t* value, const TEST_CUBE* pattern )
+{
+    int K, gate;
+    for(K = 0; K < info.numPI; K++) value[info.inputs[K]] = CUBE_VALUE(pattern, K);
+    for(K = 0; K < info.numGates; K++)
+    {
+        gate = circuit.order[K];
+        if(circuit.type[gate] != PI)
+            value[gate] = evaluateGateKernel(circuit.kernel[gate], value,
+                                             circuit.fanin + circuit.faninStart[gate],
+                                             NUM_FANIN(&circuit, gate));
+    }
+}
+
+/*
+ *  Usage: bench_kernels <netlist> [<netlist> ...]
+ */
+int main( int argc, char* argv[] )
+{
+    STOP_WATCH sw;
+    int K, P, N, R;
+
+    srand(1);
+    fprintf(stdout, "%-24s %8s %8s %12s %12s %8s %10s\n", "netlist", "gates", "xor",
+            "type (ms)", "kernel (ms)", "speedup", "mismatches");
+    for(K = 1; K < argc; K++)
+    {
+        if(populateCircuit(&circuit, &info, argv[K]) == FALSE)
+        {
+            fprintf(stderr, "Failed to parse \"%s\"\n", argv[K]);
+            continue;
+        }
+        computeGateLevels(&circuit, &info);
+
+        int numXOR = 0;
+        for(N = 0; N < info.numGates; N++) numXOR += (circuit.type[N] == XOR);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            clearCube(&patterns[P], info.numPI);
+            for(N = 0; N < info.numPI; N++) setCubeValue(&patterns[P], N, (rand() % 2) ? I : O);
+        }
+
+        // Both evaluations must agree on every gate
+        uint8_t* value = (uint8_t*) malloc(info.numGates);
+        int mismatches = 0;
+        for(P = 0; P < PATTERNS; P++)
+        {
+            sweepByType(value, &patterns[P]);
+            sweep_pattern(&circuit, &info, &patterns[P], NULL, NULL, NULL);
+            for(N = 0; N < info.numGates; N++) mismatches += (value[N] != circuit.value[N]);
+        }
+
+        startSW(&sw);
+        for(R = 0; R < ROUNDS; R++)
+            for(P = 0; P < PATTERNS; P++) sweepByType(value, &patterns[P]);
+        double byType = getElaspedTimeSW(&sw);
+        startSW(&sw);
+        for(R = 0; R < ROUNDS; R++)
+            for(P = 0; P < PATTERNS; P++) sweepByKernel(value, &patterns[P]);
+        double byKernel = getElaspedTimeSW(&sw);
+        free(value);
+
+        fprintf(stdout, "%-24s %8d %8d %12.3f %12.3f %7.2fx %10d\n", argv[K], info.numGates, numXOR,
+                byType * 1000, byKernel * 1000, byType / byKernel, mismatches);
+        clearCircuit(&circuit, &info);
+    }
+    return 0;
+}
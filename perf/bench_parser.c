@@ -0,0 +1,94 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bench_parser.c
+ *
+ *    Description:  Compares the parsing time of the netlist parsers
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "globals.h"
+#include "parser_netlist.h"
+#include "parser_threaded.h"
+#include "ptime.h"
+
+#define REPETITIONS 5
+
+CIRCUIT circuit;
+CIRCUIT_INFO info;
+
+/*
+ *  Parses <filename> REPETITIONS times with the given parser and returns the
+ *  best parsing time in seconds
+ */
+double timeParser( BOOLEAN (*parser)(CIRCUIT*, CIRCUIT_INFO*, char*), char* filename )
+{
+    STOP_WATCH sw;
+    double best = -1, duration;
+    int K;
+    for(K = 0; K < REPETITIONS; K++)
+    {
+        startSW(&sw);
+        if(parser(&circuit, &info, filename) == FALSE)
+        {
+            fprintf(stderr, "Failed to parse \"%s\"\n", filename);
+            exit(1);
+        }
+        duration = getElaspedTimeSW(&sw);
+        if(best < 0 || duration < best) best = duration;
+        clearCircuit(&circuit, &info);
+    }
+    return best;
+}
+
+/*
+ *  Usage: bench_parser [-j <threads>] <netlist> [<netlist> ...]
+ */
+int main( int argc, char* argv[] )
+{
+    int K = 1;
+    struct stat st;
+
+    // The threaded parser uses one thread per online CPU unless told otherwise
+    if(argc > 2 && strcmp(argv[1], "-j") == 0)
+    {
+        options.parserThreads = atoi(argv[2]);
+        K = 3;
+    }
+
+    fprintf(stdout, "%-24s %10s %8s %12s %12s %12s %8s %8s\n", "netlist", "bytes", "gates",
+            "stdio (ms)", "mmap (ms)", "thread (ms)", "mmap", "thread");
+    for(; K < argc; K++)
+    {
+        if(stat(argv[K], &st) < 0) continue;
+
+        populateCircuit(&circuit, &info, argv[K]);
+        int gates = info.numGates;
+        clearCircuit(&circuit, &info);
+
+        double stdio    = timeParser(populateCircuit, argv[K]);
+        double mapped   = timeParser(populateCircuitMapped, argv[K]);
+        double threaded = timeParser(populateCircuitThreaded, argv[K]);
+        fprintf(stdout, "%-24s %10ld %8d %12.3f %12.3f %12.3f %7.2fx %7.2fx\n", argv[K],
+                (long) st.st_size, gates, stdio * 1000, mapped * 1000, threaded * 1000,
+                stdio / mapped, stdio / threaded);
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bench_wide.c
+ *
+ *    Description:  Compares event-driven simulation of wide gates, evaluated from
+ *                  the counts of their input values, with full sweeps
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "globals.h"
+#include "parser_netlist.h"
+#include "fault_simulation.h"
+#include "test_generator.h"
+#include "test_cube.h"
+#include "ptime.h"
+
+#define PATTERNS 4096
+#define GATES    8
+
+CIRCUIT circuit;
+CIRCUIT_INFO info;
+TEST_CUBE patterns[PATTERNS];
+uint64_t hashes[PATTERNS];
+TEST_CUBE output;
+
+/*
+ *  Writes a netlist of GATES gates of the given width, all of them reading
+ *  every input. The gates cycle through AND, NAND, OR and NOR.
+ *
+ *  @param  int     width   - the number of inputs
+ *  @return char* - the netlist, to be freed
+ */
+char* buildWideNetlist( int width )
+{
+    static const char* types[] = { "AND", "NAND", "OR", "NOR" };
+    char* netlist = (char*) malloc((width + GATES) * 32 + GATES * width * 8);
+    int K, L, size = 0;
+
+    for(K = 0; K < width; K++) size += sprintf(netlist + size, "INPUT(i%d)\n", K);
+    for(K = 0; K < GATES; K++) size += sprintf(netlist + size, "OUTPUT(g%d)\n", K);
+    for(K = 0; K < GATES; K++)
+    {
+        size += sprintf(netlist + size, "g%d = %s(", K, types[K % 4]);
+        for(L = 0; L < width; L++) size += sprintf(netlist + size, L ? ", i%d" : "i%d", L);
+        size += sprintf(netlist + size, ")\n");
+    }
+    return netlist;
+}
+
+/*
+ *  Usage: bench_wide [<width> ...]
+ */
+int main( int argc, char* argv[] )
+{
+    static const int defaults[] = { 16, 64, 256, 1024 };
+    STOP_WATCH sw;
+    int K, P, N, width, numWidths = (argc > 1) ? argc - 1 : 4;
+
+    srand(1);
+    fprintf(stdout, "%8s %8s %12s %12s %8s %10s\n", "width", "gates",
+            "event (ms)", "sweep (ms)", "speedup", "mismatches");
+    for(K = 0; K < numWidths; K++)
+    {
+        width = (argc > 1) ? atoi(argv[K + 1]) : defaults[K];
+        char* netlist = buildWideNetlist(width);
+        if(parseNetlistBuffer(&circuit, &info, netlist, strlen(netlist)) == FALSE)
+        {
+            fprintf(stderr, "Failed to parse a netlist of width %d\n", width);
+            free(netlist);
+            continue;
+        }
+        free(netlist);
+        computeGateLevels(&circuit, &info);
+
+        // Every pattern changes one input of the previous one, to 0, 1 or X
+        clearCube(&patterns[0], info.numPI);
+        for(N = 0; N < info.numPI; N++) setCubeValue(&patterns[0], N, (rand() % 2) ? I : O);
+        for(P = 1; P < PATTERNS; P++)
+        {
+            copyCube(&patterns[P], &patterns[P - 1]);
+            setCubeValue(&patterns[P], rand() % info.numPI, (rand() % 3 == 0) ? X : ((rand() % 2) ? I : O));
+        }
+
+        // Only the gates reading the changed input are evaluated again
+        clearPropagationValuesCircuit(&circuit, info.numGates);
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            generate_output(&circuit, &info, &patterns[P], &output);
+            hashes[P] = hashCube(&output);
+        }
+        double event = getElaspedTimeSW(&sw);
+
+        int mismatches = 0;
+        startSW(&sw);
+        for(P = 0; P < PATTERNS; P++)
+        {
+            sweep_pattern(&circuit, &info, &patterns[P], NULL, NULL, &output);
+            mismatches += (hashes[P] != hashCube(&output));
+        }
+        double sweep = getElaspedTimeSW(&sw);
+
+        fprintf(stdout, "%8d %8d %12.3f %12.3f %7.2fx %10d\n", width, info.numGates,
+                event * 1000, sweep * 1000, sweep / event, mismatches);
+        clearCircuit(&circuit, &info);
+    }
+    return 0;
+}
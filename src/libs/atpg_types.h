@@ -19,6 +19,12 @@
  * =====================================================================================
  */
 
+/* uint8_t, uint32_t, int32_t, uint64_t */
+#include <stdint.h>
+
+/* size_t */
+#include <stddef.h>
+
 #include "defines.h"
 
 
@@ -64,21 +70,53 @@ typedef enum{
     X   // Unknown value in either true or faulty circuits
 } LOGIC_VALUE;
 
+/*
+ *  64 five-valued signals in dual-rail form, one per bit position (lane). A
+ *  known lane holds its true circuit value in <good> and its faulty circuit
+ *  value in <faulty>: O is (0,0), I is (1,1), D is (1,0) and B is (0,1). An
+ *  unknown lane (X) has its <unknown> bit set and both of its other bits
+ *  cleared.
+ */
+typedef struct
+{
+    uint64_t good;      // Values in the true circuits
+    uint64_t faulty;    // Values in the faulty circuits
+    uint64_t unknown;   // Set for the X lanes
+} DUAL_RAIL;
+
 
 /* 
  * =====================================================================================
- *                                HASH TABLES TYPES
+ *                               SYMBOL TABLES TYPES
  * =====================================================================================
  */
 
 /*
- *  Hash entry stores string-int pair of values to be used in the hash table
+ *  A slot of the symbol table
+ */
+typedef struct
+{
+    uint32_t hash;      // Full hash of the name, compared before the name itself
+    int32_t  id;        // Gate id of the name, -1 for an empty slot
+    uint32_t offset;    // Position of the name in the names arena
+    int32_t  len;       // Length of the name
+} SYMBOL_SLOT;
+
+/*
+ *  Symbol table interning gate names. Every name is stored once, null
+ *  terminated, in a single growable arena and found through an open addressing
+ *  table that doubles whenever it becomes half full.
  */
 typedef struct
 {
-    char* strKey;
-    int   intKey;
-} HASH_ENTRY;
+    SYMBOL_SLOT* slots;
+    int     capacity;       // Number of slots, a power of two
+    int     count;          // Number of interned names
+    char*   arena;          // The interned names
+    size_t  arenaSize;
+    size_t  arenaCapacity;
+    int     lookups;        // Number of names searched, counted in debug builds only
+} SYMBOL_TABLE;
 
 /* 
  * =====================================================================================
@@ -96,6 +134,27 @@ typedef enum
     RANDOM
 } DONTCARE_FILLING_OPTION;
 
+/*
+ *  Netlist parser implementations
+ */
+typedef enum
+{
+    PARSER_STDIO,   // Line by line parsing through stdio
+    PARSER_MMAP,    // Single pass tokenizer over a memory mapped netlist
+    PARSER_THREADED // Two pass multi-threaded parser over a memory mapped netlist
+} PARSER_MODE;
+
+/*
+ *  Fault simulator implementations
+ */
+typedef enum
+{
+    FAULT_SIM_PARALLEL,     // Parallel-pattern single-fault propagation, 64 to 512 patterns at once
+    FAULT_SIM_SERIAL,       // Every fault from the fault-free circuit, one pattern at a time
+    FAULT_SIM_DEDUCTIVE,    // Fault lists of every gate deduced in one pass, one pattern at a time
+    FAULT_SIM_CONCURRENT    // Faulty machines diverging at every gate, kept from a pattern to the next
+} FAULT_SIMULATOR;
+
 /*
  *  Command line options structure
  */
@@ -113,22 +172,47 @@ typedef struct
     BOOLEAN isBenchmarkFileGiven;   // -b <filename>
     char*   benchmarkFilename;      // -b <filename>
 
+    // Netlist parser implementation
+    PARSER_MODE parserMode;         // -P <S, M, T>
+    int     parserThreads;          // -j <threads>, 0 -> one per online CPU
+
+    // Reuse and save compiled netlists next to the benchmark file
+    BOOLEAN isNetlistCacheEnabled;  // -C
+
     // Turn ON/OFF fault collapsing
     BOOLEAN isOneTestPerFault;      // -x
 
     // Specify the filename to save undetected faults into
     BOOLEAN isPrintUndetectedFaults;    // -u <filename>
     char*   undetectedFaultsFilename;   // -u <filename>
+    BOOLEAN isBinaryFaultList;          // -B
+
+    // Specify the filename to convert the fault list into
+    char*   convertedFaultListFilename; // --convert-faults <filename>
 
     // Option for filling in the don't cares with during fault simulation
     DONTCARE_FILLING_OPTION dontCareFilling;    // -X <0, 1, R>
 
+    // Fault simulator implementation
+    FAULT_SIMULATOR faultSimulator;     // -F <P, S, D, C>, -S for S
+    int     faultMemory;                // --fault-memory <megabytes>, for C
+
     // Specify the filename to parse test patterns to simulate fault collapsing with
     BOOLEAN isCustomFaultSimulation;    // -s <filename>
     char*   inputTestPatternFilename;        // -s <filename>
 
     // Specify the output test pattern filename
     char*   outputTestPatternFilename;        // -t <filename>
+    BOOLEAN isBinaryTestPatterns;             // -T
+
+    // Compress the saved test patterns and undetected faults with gzip
+    BOOLEAN isCompressedOutput;               // -z
+
+    // Specify the binary test pattern file to print as text
+    char*   dumpedTestPatternFilename;        // --dump-patterns <filename>
+
+    // Specify the command to stream the binary test patterns to
+    char*   patternPipeCommand;               // --pipe-patterns <command>
 } COMMAND_LINE_OPTIONS;
 
 /* 
@@ -152,13 +236,39 @@ typedef enum
     OTHER   // Other gate type
 } GATE_TYPE;
 
+/*
+ *  Logic functions computed by the gates. Every inverted function directly
+ *  follows the function it inverts.
+ */
+typedef enum
+{
+    FUNCTION_AND,
+    FUNCTION_NAND,
+    FUNCTION_OR,
+    FUNCTION_NOR,
+    FUNCTION_XOR,
+    FUNCTION_XNOR,
+    MAX_GATE_FUNCTIONS
+} GATE_FUNCTION;
+
+/*
+ *  Evaluation kernel of a gate, chosen once the netlist is built from its
+ *  type, inversion and number of inputs: the logic function in the low three
+ *  bits and the arity above them. Arity 0 marks gates that always evaluate to
+ *  X, and arity KERNEL_MANY gates with more than four inputs.
+ */
+#define KERNEL_MANY                 5
+#define GATE_KERNEL(function, arity)    ((uint8_t) (((arity) << 3) | (function)))
+#define KERNEL_FUNCTION(kernel)     ((kernel) & 7)
+#define KERNEL_ARITY(kernel)        ((kernel) >> 3)
+
 /*
  *  Justification object
  */
 typedef struct
 {
-    BOOLEAN state;    // If the gate has been justified or not
-    BOOLEAN value;    // Results of justification
+    uint8_t state;    // If the gate has been justified or not
+    uint8_t value;    // Results of justification
 } JUST_OBJECT;
 
 /*
@@ -166,54 +276,132 @@ typedef struct
  */
 typedef struct
 {
-    BOOLEAN state;    // If the gate has been propagated with a given value or not
-    BOOLEAN value;    // Results of the propagation
+    uint8_t state;    // If the gate has been propagated with a given value or not
+    uint8_t value;    // Results of the propagation
 } PROP_OBJECT;
 
 /*
- *  Gate abstraction
+ *  Gates scheduled for event-driven simulation, in one circular FIFO bucket per
+ *  level. A gate is queued at most once at a time, so the bucket of level L
+ *  never holds more than the gates of that level and all the buckets share a
+ *  single array laid out like the circuit's evaluation order.
  */
 typedef struct
 {
-	// Name given to the gate
-    char name[MAX_WORD];   
-
-    // Number of connected input and output gates
-    BOOLEAN numIn;      
-    BOOLEAN numOut;     
-
-    // List of connected input and output gates
-    int in[MAX_INPUT_GATES];     
-    int out[MAX_OUTPUT_GATES];   
-
-    // 1 -> the gate is inverted, 0 otherwise
-    BOOLEAN inv;   
+    int      numLevels;
+    int32_t* bucketStart;   // numLevels + 1 positions in <events>
+    int32_t* head;          // Next event to dequeue from every bucket
+    int32_t* count;         // Number of events in every bucket
+    int32_t* events;        // The scheduled gates
+    uint8_t* scheduled;     // 1 -> the gate is in the queue, 0 otherwise
+    int      level;         // No bucket below this level has events
+    int      size;          // Number of scheduled gates
+} EVENT_QUEUE;
 
-    // Gate type
-    GATE_TYPE type;    
-
-    // 1 -> the gate is a primary output, 0 otherwise 
-    BOOLEAN PO;        
+/*
+ *  Circuit abstraction. Gates are numbered from 0 and every gate field is kept
+ *  in its own array indexed by the gate's number. The fanin and fanout lists
+ *  of all the gates are stored back to back: the fanin list of gate G is
+ *  fanin[faninStart[G]] to fanin[faninStart[G+1] - 1], and likewise for the
+ *  fanout list, which also indexes the values of the fan out segments. Every
+ *  fanin entry knows the position of the fan out segment that feeds it. Once
+ *  the levels are known, <order> lists every gate after all of its inputs.
+ */
+typedef struct
+{
+    int capacity;               // Number of gates the gate arrays can hold
+
+    // Gate fields
+    uint32_t*    nameOffset;    // Position of the gate's name in <names>
+    uint8_t*     type;          // GATE_TYPE
+    uint8_t*     inv;           // 1 -> the gate is inverted, 0 otherwise
+    uint8_t*     kernel;        // GATE_KERNEL evaluating the gate
+    uint8_t*     PO;            // 1 -> the gate is a primary output, 0 otherwise
+    uint8_t*     PPO;           // 1 -> the gate is a pseudo PO, 0 otherwise
+    int32_t*     level;         // Gate level from the inputs
+    int32_t*     order;         // Gates sorted by level, in which a full sweep evaluates them
+    uint8_t*     value;         // LOGIC_VALUE of the wire during fault generation/simulation
+    uint8_t*     goodValue;     // LOGIC_VALUE of the wire in the fault-free circuit, kept
+                                // while the faults of a test vector are simulated
+    int32_t*     touched;       // Gates whose value the simulated fault changed
+    int32_t*     inputCount;    // INPUT_COUNT_SLOTS counts of the values on the inputs of
+                                // every gate, kept for wide gates during event-driven
+                                // simulation and test generation
+    JUST_OBJECT* justified;     // MAX_LOGIC_VALUES results of justifying each wire
+    PROP_OBJECT* propagated;    // MAX_LOGIC_VALUES results of propagating each wire
+
+    // Fanin and fanout lists, built once the whole netlist is read
+    int32_t* faninStart;        // numGates + 1 positions in <fanin> and <faninBranch>
+    int32_t* fanin;
+    int32_t* faninBranch;       // Position in <fanout> of the segment feeding each input
+    int32_t* fanoutStart;       // numGates + 1 positions in <fanout> and <branchValue>
+    int32_t* fanout;
+    uint8_t* branchValue;       // LOGIC_VALUE of every fan out segment
+    int     numEdges;           // Total fanin (and fanout) connections
+
+    // Connections in the order they are read, until the lists are built
+    int32_t* edgeFrom;          // The driving gate
+    int32_t* edgeTo;            // The driven gate
+    int     edgeCapacity;
+
+    EVENT_QUEUE events;         // Gates to evaluate during event-driven simulation
+    SYMBOL_TABLE names;         // Gate names and their numbers
+
+    // Compiled netlist whose sections are the arrays of a loaded circuit
+    char*   image;
+    size_t  imageSize;
+} CIRCUIT;
 
-    // 1 -> the gate is a pseudo PO, 0 otherwise 
-    BOOLEAN PPO;     
+/*
+ *  Accessors of the gate at position <g> in the circuit <c>
+ */
+#define GATE_NAME(c, g)         ((c)->names.arena + (c)->nameOffset[g])
+#define NUM_FANIN(c, g)         ((c)->faninStart[(g) + 1] - (c)->faninStart[g])
+#define FANIN(c, g, k)          ((c)->fanin[(c)->faninStart[g] + (k)])
+#define NUM_FANOUT(c, g)        ((c)->fanoutStart[(g) + 1] - (c)->fanoutStart[g])
+#define FANOUT(c, g, k)         ((c)->fanout[(c)->fanoutStart[g] + (k)])
+#define BRANCH_VALUE(c, g, k)   ((c)->branchValue[(c)->fanoutStart[g] + (k)])
+#define FANIN_BRANCH(c, g, k)   ((c)->faninBranch[(c)->faninStart[g] + (k)])
+#define JUSTIFIED(c, g, v)      ((c)->justified[(g) * MAX_LOGIC_VALUES + (v)])
+#define PROPAGATED(c, g, v)     ((c)->propagated[(g) * MAX_LOGIC_VALUES + (v)])
+#define INPUT_COUNTS(c, g)      (&(c)->inputCount[(g) * INPUT_COUNT_SLOTS])
 
-    // Results of justifying this wire with a logical value   
-    JUST_OBJECT justified[MAX_LOGIC_VALUES];   
+/*
+ *  Slots of the input counts of a gate: one per logic value, then the number
+ *  of inputs fed by fan out segments, which test generation reads as the
+ *  gate's own value
+ */
+#define BRANCH_INPUTS           MAX_LOGIC_VALUES
+#define INPUT_COUNT_SLOTS       (MAX_LOGIC_VALUES + 1)
 
-    // Results of propagating this wire with a logical value
-    PROP_OBJECT propagated[MAX_LOGIC_VALUES];  
-    
-    // Logical value of the wire during fault generation/simulation
-    LOGIC_VALUE value;  
-    // Logical values of the fan out segments
-    LOGIC_VALUE values[MAX_OUTPUT_GATES];
 
-    // Gate level from the inputs
-    int level;          
-} GATE;
+/*
+ *  Kinds of netlist lines
+ */
+typedef enum
+{
+    NETLIST_INPUT,      // INPUT(<name>)
+    NETLIST_OUTPUT,     // OUTPUT(<name>)
+    NETLIST_GATE,       // <name> = <type>(<input>, <input>, ...)
+    NETLIST_BLANK,      // Empty or comment line
+    NETLIST_MALFORMED   // Anything else
+} NETLIST_LINE_TYPE;
 
-typedef GATE* CIRCUIT[MAX_GATES];   // A circuit is a graph of gates
+/*
+ *  Parts of a tokenized netlist line. Every part points into the netlist's text.
+ */
+typedef struct
+{
+    NETLIST_LINE_TYPE type;
+    const char* start;          // The line without comments and surrounding blanks
+    const char* end;
+    const char* name;           // The declared gate's name
+    int         nameLen;
+    const char* gateType;       // The inner gate's type name
+    int         gateTypeLen;
+    const char* inputs;         // The inner gate's inputs between the parentheses
+    const char* inputsEnd;
+} NETLIST_LINE;
 
 
 /*
@@ -223,9 +411,11 @@ typedef struct
 {
     int numGates;       // Total number of gates
     int numPI;          // Total number of primary inputs
-    int inputs[MAX_INPUT_GATES];    // List of primary inputs
+    int32_t* inputs;    // List of primary inputs
+    int inputCapacity;  // Number of primary inputs <inputs> can hold
     int numPO;          // Total number of primary outputs
-    int outputs[MAX_OUTPUT_GATES];  // List of primary outputs
+    int32_t* outputs;   // List of primary outputs
+    int outputCapacity; // Number of primary outputs <outputs> can hold
     int numPPI;         // TOtal number of pseudo primary inputs
     int numPPO;         // Total number of pseudo primary outputs
     int numIIR;         // Total number of input interface registers
@@ -251,26 +441,70 @@ typedef enum
 
 
 /*
- *  A fault structure
+ *  Statuses of the faults, every one kept in a bitmap of the fault list
+ */
+typedef enum
+{
+    FAULT_DETECTED,     // A test pattern detects the fault
+    FAULT_ABORTED,      // Test generation gave up on the fault
+    FAULT_REDUNDANT,    // No test pattern can detect the fault
+    MAX_FAULT_STATUS
+} FAULT_STATUS;
+
+
+/*
+ *  A fault structure. A fault is known by its position in the fault list.
  */
 typedef struct
 {
-    int index;          // The index of the wire stuck at fault
-    int indexOut;       // For specifying fan out segments
+    int32_t index;      // The index of the wire stuck at fault
+    int32_t indexOut;   // For specifying fan out segments, -1 for the main segment
     FAULT_TYPE type;    // Either stuck at 1 or stuck at 0
-    BOOLEAN detected;   // Flag if the fault is detected or not
 } FAULT;
 
 
 /*
- *  A fault list structure
+ *  A fault list structure. The faults are stored back to back along with one
+ *  bit per fault for every status, all in a single allocation. Once indexed
+ *  by gate, the faults of gate G are byGate[gateStart[G]] to
+ *  byGate[gateStart[G+1] - 1]: the ones of its main segment first, then the
+ *  ones of its fan out segments from byGate[branchStart[G]].
  */
 typedef struct
 {
-    FAULT* list[MAX_GATES*2];
-    int count;
+    FAULT*    faults;
+    int       count;
+    int       capacity;                     // Number of faults the block can hold
+    uint64_t* status[MAX_FAULT_STATUS];     // FAULT_STATUS_WORDS(capacity) words each
+    void*     block;                        // The faults and their statuses
+
+    int       numGates;                     // Number of gates indexed, 0 if not indexed
+    int32_t*  gateStart;                    // numGates + 1 positions in <byGate>
+    int32_t*  branchStart;                  // numGates positions in <byGate>
+    int32_t*  byGate;                       // Positions of the faults sorted by gate
 } FAULT_LIST;
 
+/*
+ *  Accessors of the statuses of the fault at position <f> in the fault list <l>
+ */
+#define FAULT_STATUS_WORDS(n)       (((n) + 63) / 64)
+#define HAS_FAULT_STATUS(l, f, s)   ((int) (((l)->status[s][(f) >> 6] >> ((f) & 63)) & 1))
+#define SET_FAULT_STATUS(l, f, s)   ((l)->status[s][(f) >> 6] |= (uint64_t) 1 << ((f) & 63))
+#define CLEAR_FAULT_STATUS(l, f, s) ((l)->status[s][(f) >> 6] &= ~((uint64_t) 1 << ((f) & 63)))
+#define IS_DETECTED(l, f)           HAS_FAULT_STATUS(l, f, FAULT_DETECTED)
+
+
+/*
+ *  Index of the fan out branches of a circuit keyed by their (stem, sink) pair
+ */
+typedef struct
+{
+    uint64_t* keys;     // (stem << 32) | sink, all bits set for an empty slot
+    int32_t*  slots;    // Position of the sink in the out[] list of the stem
+    int     capacity;   // Number of slots, a power of two
+    int     count;      // Number of indexed branches
+} BRANCH_INDEX;
+
 
 /* 
  * =====================================================================================
@@ -279,13 +513,31 @@ typedef struct
  */
 
 /*
- *  Simulation results
+ *  Number of 64-bit words holding <width> values of a test cube
+ */
+#define CUBE_WORDS(width)   ((width) / 64 + ((width) % 64 != 0))
+
+/*
+ *  A test cube: the values of the input or the output gates packed 64 to a
+ *  word. A value is specified when its care bit is set and is then given by its
+ *  value bit; it is a don't-care (x) otherwise. The bits past <width> in the
+ *  words of the values and the value bits of the don't-cares are always
+ *  cleared. Both bit-vectors share one allocation, which grows with the widest
+ *  test cube it held; a test cube set to zeros is empty and holds nothing.
+ */
+typedef struct
+{
+    int32_t  width;         // Number of values
+    int32_t  capacity;      // Number of values the bit-vectors can hold
+    uint64_t* care;         // Set for the specified values
+    uint64_t* value;        // Set for the values at 1
+} TEST_CUBE;
+
+/*
+ *  Accessors of the value at position <K> of the test cube <c>
  */
- typedef struct 
- {
-     char input[MAX_INPUT_GATES];
-     char output[MAX_OUTPUT_GATES];
- } SIM_RESULT;
+#define CUBE_BIT(bits, K)   ((int) (((bits)[(K) >> 6] >> ((K) & 63)) & 1))
+#define CUBE_VALUE(c, K)    (CUBE_BIT((c)->care, K) ? (CUBE_BIT((c)->value, K) ? I : O) : X)
 
 /* 
  * =====================================================================================
@@ -298,10 +550,11 @@ typedef struct
  */
 typedef struct
 {
-    char input[MAX_INPUT_GATES+1];    // Input gates values
-    char output[MAX_OUTPUT_GATES+1];  // Output gates values
+    TEST_CUBE input;        // Input gates values
+    TEST_CUBE output;       // Output gates values
     int  faults_count;      // Total stuck-at faults the test can detect
-    FAULT* faults_list[MAX_GATES*2];
+    int  faults_capacity;   // Number of faults <faults_list> can hold
+    int32_t* faults_list;   // Positions of the detected faults in the fault list
 } TEST_VECTOR;
 
 
@@ -0,0 +1,446 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  concurrent_simulation.c
+ *
+ *    Description:  Concurrent fault simulation: every gate keeps the faulty
+ *                  machines diverging from the fault-free one, which are only
+ *                  evaluated again when an event reaches the gate
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* qsort, free */
+#include <stdlib.h>
+
+/* memcpy */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+#include "concurrent_simulation.h"
+#include "event_queue.h"
+#include "fault_list.h"
+#include "fault_set.h"
+#include "fault_simulation.h"
+#include "logic_tables.h"
+#include "test_cube.h"
+#include "test_generator.h"
+
+
+/*
+ *  Bytes taken by an entry of a divergence list
+ */
+#define DIVERGENCE_ENTRY_SIZE   (sizeof(int32_t) + sizeof(uint8_t))
+
+
+/*
+ *  Frees the divergence lists of every gate
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+static void releaseDivergenceLists( CONCURRENT_SIMULATOR* sim )
+{
+    int K;
+    for(K = 0; K < sim->numGates; K++)
+    {
+        free(sim->lists[K].ids);
+        free(sim->lists[K].values);
+    }
+    if(sim->lists != NULL) bzero(sim->lists, sim->numGates * sizeof(DIVERGENCE_LIST));
+    sim->memory = 0;
+}
+
+/*
+ *  Gives a gate the new divergence list deduced for it, resizing its storage
+ *  when it outgrows it or uses a quarter of it
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator, holding the new list
+ *  @param  DIVERGENCE_LIST* list - the divergence list of the gate
+ *  @param  int     count       - the number of entries of the new list
+ *  @return nothing
+ */
+static void storeDivergenceList( CONCURRENT_SIMULATOR* sim, DIVERGENCE_LIST* list, int count )
+{
+    int capacity = list->capacity;
+
+    if(count > capacity)
+        capacity = (count < 4) ? 4 : count + count / 2;
+    else if(capacity > 16 && count < capacity / 4)
+        capacity = 2 * count;
+
+    if(capacity != list->capacity)
+    {
+        list->ids    = (int32_t*) growFaultArray(list->ids, capacity, sizeof(int32_t));
+        list->values = (uint8_t*) growFaultArray(list->values, capacity, sizeof(uint8_t));
+        sim->memory  = sim->memory + (size_t) capacity * DIVERGENCE_ENTRY_SIZE
+                                   - (size_t) list->capacity * DIVERGENCE_ENTRY_SIZE;
+        list->capacity = capacity;
+        if(sim->memory > sim->peakMemory) sim->peakMemory = sim->memory;
+    }
+
+    if(count > 0)
+    {
+        memcpy(list->ids, sim->listIds, count * sizeof(int32_t));
+        memcpy(list->values, sim->listValues, count * sizeof(uint8_t));
+    }
+    list->count = count;
+}
+
+/*
+ *  Tells whether the active faults of a divergence list are the new list
+ *  deduced for the gate
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator, holding the new list
+ *  @param  DIVERGENCE_LIST* list - the divergence list of the gate
+ *  @param  int     count       - the number of entries of the new list
+ *  @return BOOLEAN TRUE if the lists are the same and FALSE otherwise
+ */
+static BOOLEAN isSameDivergence( CONCURRENT_SIMULATOR* sim, DIVERGENCE_LIST* list, int count )
+{
+    int K, N = 0;
+    for(K = 0; K < list->count; K++)
+    {
+        if(isActiveFault(&sim->faults, list->ids[K]) == FALSE) continue;
+        if(N == count || list->ids[K] != sim->listIds[N] || list->values[K] != sim->listValues[N])
+            return FALSE;
+        N++;
+    }
+    return (N == count) ? TRUE : FALSE;
+}
+
+/*
+ *  Deduces the divergence list of a gate into the simulator's new list. Every
+ *  faulty machine diverging at an input is evaluated with the five-valued
+ *  logic of the gate's kernel, and the gate's own faults the test vector
+ *  excites are added.
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate
+ *  @param  int     gate        - the gate
+ *  @param  LOGIC_VALUE good    - the gate's fault-free value
+ *  @return int - the number of entries of the new list
+ */
+static int deduceDivergence( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, FAULT_LIST* fList,
+                             int gate, LOGIC_VALUE good )
+{
+    const int32_t* in = circuit->fanin + circuit->faninStart[gate];
+    LOGIC_VALUE value, flipped = (good == I) ? D : B;
+    int K, L, M, id, size = 0, numOwn = 0;
+    int numIn = (circuit->type[gate] == PI) ? 0 : NUM_FANIN(circuit, gate);
+    size_t need, branchSize = 0, branchNeed = 0;
+    BOOLEAN isSorted = TRUE;
+
+    // Every faulty machine leaves a gate unknown in the fault-free circuit unknown
+    if(good == X) return 0;
+
+    // The excited faults of the gate, the ones of its fan out branches being
+    // given to the inputs of the gates they drive
+    for(K = fList->gateStart[gate]; K < fList->gateStart[gate + 1]; K++)
+    {
+        id = fList->byGate[K];
+        if(isActiveFault(&sim->faults, id) == FALSE || exciteValue(fList->faults[id].type, good) == X) continue;
+        if(fList->faults[id].indexOut >= 0 && NUM_FANOUT(circuit, gate) > 1) continue;
+        if(numOwn > 0 && sim->faults.own[numOwn - 1] > id) isSorted = FALSE;
+        sim->faults.own[numOwn++] = id;
+    }
+    if(isSorted == FALSE) qsort(sim->faults.own, numOwn, sizeof(int32_t), cmpFaultIds);
+
+    // Room for the new list and the lists of the branches feeding the gate
+    need = numOwn;
+    for(K = 0; K < numIn; K++)
+    {
+        need += sim->lists[in[K]].count;
+        if(NUM_FANOUT(circuit, in[K]) < 2) continue;
+        need += fList->gateStart[in[K] + 1] - fList->branchStart[in[K]];
+        branchNeed += sim->lists[in[K]].count + fList->gateStart[in[K] + 1] - fList->branchStart[in[K]];
+    }
+    reserveEntries(&sim->listIds, &sim->listValues, &sim->listCapacity, need);
+    reserveEntries(&sim->faults.branchIds, &sim->faults.branchValues, &sim->faults.branchCapacity, branchNeed);
+
+    // The faulty machines diverging at the inputs
+    for(K = 0; K < numIn; K++)
+    {
+        sim->pins[K].ids    = sim->lists[in[K]].ids;
+        sim->pins[K].values = sim->lists[in[K]].values;
+        sim->pins[K].count  = sim->lists[in[K]].count;
+        sim->pins[K].next   = 0;
+        readBranchFaults(&sim->faults, circuit, fList, gate, in[K], sim->good[in[K]], &sim->pins[K], &branchSize);
+    }
+    while((id = nextFault(&sim->faults, sim->pins, numIn)) >= 0)
+    {
+        for(K = 0; K < numIn; K++)
+            if(sim->pins[K].next < sim->pins[K].count && sim->pins[K].ids[sim->pins[K].next] == id)
+                sim->pinValues[K] = sim->pins[K].values[sim->pins[K].next++];
+            else
+                sim->pinValues[K] = sim->good[in[K]];
+
+        value = evaluateGateKernel(circuit->kernel[gate], sim->pinValues, sim->pinOrder, numIn);
+        if(value == good) continue;
+        sim->listIds[size]      = id;
+        sim->listValues[size++] = value;
+    }
+
+    // Merge the gate's own faults, from the last entries on
+    L = size;
+    M = size + numOwn;
+    for(K = numOwn - 1; K >= 0; K--)
+    {
+        while(L > 0 && sim->listIds[L - 1] > sim->faults.own[K])
+        {
+            M--, L--;
+            sim->listIds[M]    = sim->listIds[L];
+            sim->listValues[M] = sim->listValues[L];
+        }
+        M--;
+        sim->listIds[M]    = sim->faults.own[K];
+        sim->listValues[M] = flipped;
+    }
+    return size + numOwn;
+}
+
+/*
+ *  Evaluates a gate in the fault-free circuit and in the faulty machines
+ *  diverging at its inputs
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate
+ *  @param  int     gate        - the gate
+ *  @param  LOGIC_VALUE good    - the value of an input gate, ignored for other gates
+ *  @return BOOLEAN TRUE if the gate's value or divergence list changed and FALSE otherwise
+ */
+static BOOLEAN evaluateConcurrentGate( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, FAULT_LIST* fList,
+                                       int gate, LOGIC_VALUE good )
+{
+    DIVERGENCE_LIST* list = &sim->lists[gate];
+    BOOLEAN isChanged;
+    int count;
+
+    if(circuit->type[gate] != PI)
+        good = evaluateGateKernel(circuit->kernel[gate], sim->good, circuit->fanin + circuit->faninStart[gate],
+                                  NUM_FANIN(circuit, gate));
+    count = deduceDivergence(sim, circuit, fList, gate, good);
+
+    isChanged = (good != sim->good[gate] || isSameDivergence(sim, list, count) == FALSE) ? TRUE : FALSE;
+    sim->good[gate] = good;
+    if(isChanged == TRUE || list->count != count) storeDivergenceList(sim, list, count);
+    return isChanged;
+}
+
+/*
+ *  Schedules the gates a gate drives
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  int     gate        - the gate
+ *  @return nothing
+ */
+static void scheduleFanout( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, int gate )
+{
+    int L, sink;
+    for(L = circuit->fanoutStart[gate]; L < circuit->fanoutStart[gate + 1]; L++)
+    {
+        sink = circuit->fanout[L];
+        scheduleEvent(&sim->events, sink, circuit->level[sink]);
+    }
+}
+
+/*
+ *  Brings the fault-free values and the divergence lists to a test vector,
+ *  evaluating every gate if the lists do not hold every active fault, and
+ *  otherwise the gates the changes of the input gates reach
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate
+ *  @param  TEST_VECTOR* tv     - test vector object, filled
+ *  @param  BOOLEAN isBounded   - TRUE to give up when the lists outgrow the memory bound
+ *  @return BOOLEAN FALSE if the lists outgrew the memory bound and TRUE otherwise
+ */
+static BOOLEAN simulateConcurrentPass( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                                       FAULT_LIST* fList, TEST_VECTOR* tv, BOOLEAN isBounded )
+{
+    LOGIC_VALUE value;
+    int K, gate;
+
+    if(sim->isValid == FALSE)
+    {
+        for(K = 0; K < sim->numGates; K++)
+            sim->lists[K].count = 0;
+        for(K = 0; K < info->numPI; K++)
+            sim->good[info->inputs[K]] = CUBE_VALUE(&tv->input, K);
+        for(K = 0; K < info->numGates; K++)
+        {
+            gate = circuit->order[K];
+            evaluateConcurrentGate(sim, circuit, fList, gate, sim->good[gate]);
+            if(isBounded == TRUE && sim->memory > sim->memoryLimit) return FALSE;
+        }
+        sim->isValid = TRUE;
+        return TRUE;
+    }
+
+    // Only the input gates whose value changed start events
+    for(K = 0; K < info->numPI; K++)
+    {
+        gate  = info->inputs[K];
+        value = CUBE_VALUE(&tv->input, K);
+        if(value != sim->good[gate] && evaluateConcurrentGate(sim, circuit, fList, gate, value) == TRUE)
+            scheduleFanout(sim, circuit, gate);
+    }
+    while((gate = nextEvent(&sim->events)) >= 0)
+    {
+        if(evaluateConcurrentGate(sim, circuit, fList, gate, sim->good[gate]) == TRUE)
+            scheduleFanout(sim, circuit, gate);
+        if(isBounded == TRUE && sim->memory > sim->memoryLimit)
+        {
+            clearEventQueue(&sim->events);
+            sim->isValid = FALSE;
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/*
+ *  Sizes the simulator for a circuit whose levels are computed and empties its
+ *  divergence lists. The storage of a simulator that was built before is
+ *  reused.
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  size_t  memoryLimit - bound of the memory of the divergence lists, in bytes
+ *  @return nothing
+ */
+void buildConcurrentSimulator( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                               size_t memoryLimit )
+{
+    int K, numGates = info->numGates, maxFanin = 1;
+
+    for(K = 0; K < numGates; K++)
+        if(NUM_FANIN(circuit, K) > maxFanin) maxFanin = NUM_FANIN(circuit, K);
+
+    releaseDivergenceLists(sim);
+    sim->lists     = growFaultArray(sim->lists, numGates, sizeof(DIVERGENCE_LIST));
+    sim->good      = growFaultArray(sim->good, numGates, sizeof(uint8_t));
+    sim->pins      = growFaultArray(sim->pins, maxFanin, sizeof(FAULT_PIN));
+    sim->pinOrder  = growFaultArray(sim->pinOrder, maxFanin, sizeof(int32_t));
+    sim->pinValues = growFaultArray(sim->pinValues, maxFanin, sizeof(uint8_t));
+    bzero(sim->lists, numGates * sizeof(DIVERGENCE_LIST));
+    buildEventQueue(&sim->events, circuit->level, numGates);
+
+    sim->numGates    = numGates;
+    sim->maxFanin    = maxFanin;
+    sim->memoryLimit = memoryLimit;
+    sim->peakMemory  = 0;
+    sim->numPasses   = 0;
+    sim->numSplits   = 0;
+    sim->window      = 0;
+    sim->isValid     = FALSE;
+    for(K = 0; K < numGates; K++)
+        sim->good[K] = X;
+    for(K = 0; K < maxFanin; K++)
+        sim->pinOrder[K] = K;
+}
+
+/*
+ *  Simulates a test vector to drop all the faults it detects from the given
+ *  position in the fault list on, as simulateTestVector does. Only the gates
+ *  whose inputs changed since the last test vector are evaluated, and only for
+ *  the faulty machines diverging at their inputs. The fault list must be the
+ *  one of the last test vectors, or the simulator built again.
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate if it is not
+ *  @param  TEST_VECTOR* tv     - test vector object, holding the expected outputs
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void simulateConcurrentVector( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                               FAULT_LIST* fList, TEST_VECTOR* tv, int start )
+{
+    BOOLEAN wasValid, isSplit = FALSE;
+    size_t memory = 0;
+    int K, first, last;
+
+    if(fList->numGates != info->numGates) indexFaultsByGate(fList, info->numGates);
+    if(startFaultSet(&sim->faults, info, fList) == TRUE) sim->isValid = FALSE;
+    if(sim->window <= 0 || sim->window > fList->count) sim->window = fList->count;
+
+    fillDontCares(info, tv);
+
+    // The faults in passes over parts of the fault list, the lists only being
+    // kept from a test vector to the next when one pass takes all the faults
+    for(first = start; first < fList->count; first = last)
+    {
+        last = (sim->window < fList->count - first) ? first + sim->window : fList->count;
+        if(first != start || last != fList->count) sim->isValid = FALSE;
+        if(activateFaults(&sim->faults, fList, first, last) == FALSE) sim->isValid = FALSE;
+        wasValid = sim->isValid;
+        sim->numPasses++;
+
+        if(simulateConcurrentPass(sim, circuit, info, fList, tv, (last - first > 1) ? TRUE : FALSE) == FALSE)
+        {
+            // Start the pass over from empty lists, with half the faults if the
+            // ones of the test vector alone outgrow the bound
+            releaseDivergenceLists(sim);
+            sim->isValid = FALSE;
+            sim->numSplits++;
+            isSplit = TRUE;
+            if(wasValid == FALSE) sim->window = (last - first) / 2;
+            last = first;
+            continue;
+        }
+        if(sim->memory > memory) memory = sim->memory;
+        for(K = 0; K < info->numPO; K++)
+        {
+            sim->faults.outputs[K].ids    = sim->lists[info->outputs[K]].ids;
+            sim->faults.outputs[K].values = sim->lists[info->outputs[K]].values;
+            sim->faults.outputs[K].count  = sim->lists[info->outputs[K]].count;
+        }
+        dropDetectedFaults(&sim->faults, info, fList, tv, sim->good, first, last);
+    }
+
+    // Take more faults per pass again once the lists have shrunk
+    if(isSplit == FALSE && sim->window < fList->count && memory < sim->memoryLimit / 4)
+        sim->window = (sim->window < fList->count / 2) ? 2 * sim->window : fList->count;
+}
+
+/*
+ *  Frees the memory of the simulator
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+void releaseConcurrentSimulator( CONCURRENT_SIMULATOR* sim )
+{
+    releaseDivergenceLists(sim);
+    releaseEventQueue(&sim->events);
+    free(sim->lists);
+    free(sim->good);
+    free(sim->listIds);
+    free(sim->listValues);
+    free(sim->pins);
+    free(sim->pinOrder);
+    free(sim->pinValues);
+    releaseFaultSet(&sim->faults);
+    bzero(sim, sizeof(CONCURRENT_SIMULATOR));
+}
@@ -0,0 +1,126 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  concurrent_simulation.h
+ *
+ *    Description:  Concurrent fault simulation: every gate keeps the faulty
+ *                  machines diverging from the fault-free one, which are only
+ *                  evaluated again when an event reaches the gate
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atpg_types.h"
+#include "fault_set.h"
+
+
+#ifndef CONCURRENT_SIMULATION_H
+#define CONCURRENT_SIMULATION_H
+
+
+/*
+ *  Default bound of the memory taken by the divergence lists, in megabytes
+ */
+#define CONCURRENT_MEMORY_MB    256
+
+/*
+ *  The faulty machines of a gate diverging from the fault-free one
+ */
+typedef struct
+{
+    int32_t*   ids;             // Positions of the faults in the fault list, ascending
+    uint8_t*   values;          // The gate's value in every faulty machine: D, B or X
+    int32_t    count;
+    int32_t    capacity;
+} DIVERGENCE_LIST;
+
+/*
+ *  Concurrent fault simulator. The fault-free values and the divergence lists
+ *  of the last test vector are kept, so that the next one only evaluates the
+ *  gates an event reaches: a gate whose fault-free value or divergence list
+ *  changed schedules the gates it drives. The faults are dropped as they
+ *  reach an output gate. When the lists outgrow the memory bound, the faults
+ *  are simulated in passes over smaller parts of the fault list.
+ */
+typedef struct
+{
+    int        numGates;        // Number of gates the arrays can hold
+    int        maxFanin;        // Inputs of the widest gate
+
+    EVENT_QUEUE events;         // Gates to evaluate again, by level
+    uint8_t*   good;            // The fault-free value of every gate
+    DIVERGENCE_LIST* lists;     // The divergence list of every gate
+    FAULT_SET  faults;          // The faults simulated in the lists, and the ones detected
+    BOOLEAN    isValid;         // TRUE if the lists hold every active fault for <good>
+    int        window;          // Faults of the fault list simulated in one pass
+
+    size_t     memoryLimit;     // Bound of the memory of the lists, in bytes
+    size_t     memory;          // Memory taken by the lists, in bytes
+    size_t     peakMemory;      // Most memory taken by the lists, in bytes
+    long       numPasses;       // Passes simulated over parts of the fault list
+    long       numSplits;       // Passes given up for outgrowing the memory bound
+
+    int32_t*   listIds;         // The new divergence list of the gate being evaluated
+    uint8_t*   listValues;
+    size_t     listCapacity;
+
+    FAULT_PIN* pins;            // The divergence lists of the inputs of a gate
+    int32_t*   pinOrder;        // 0 to maxFanin - 1, the inputs of a gate evaluated alone
+    uint8_t*   pinValues;       // The values of the inputs of a gate in a faulty machine
+} CONCURRENT_SIMULATOR;
+
+
+/*
+ *  Sizes the simulator for a circuit whose levels are computed and empties its
+ *  divergence lists. The storage of a simulator that was built before is
+ *  reused.
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  size_t  memoryLimit - bound of the memory of the divergence lists, in bytes
+ *  @return nothing
+ */
+void buildConcurrentSimulator( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                               size_t memoryLimit );
+
+/*
+ *  Simulates a test vector to drop all the faults it detects from the given
+ *  position in the fault list on, as simulateTestVector does. Only the gates
+ *  whose inputs changed since the last test vector are evaluated, and only for
+ *  the faulty machines diverging at their inputs.
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate if it is not
+ *  @param  TEST_VECTOR* tv     - test vector object, holding the expected outputs
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void simulateConcurrentVector( CONCURRENT_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                               FAULT_LIST* fList, TEST_VECTOR* tv, int start );
+
+/*
+ *  Frees the memory of the simulator
+ *
+ *  @param  CONCURRENT_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+void releaseConcurrentSimulator( CONCURRENT_SIMULATOR* sim );
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  data_file.c
+ *
+ *    Description:  Input and output files that are transparently compressed
+ *                  with gzip when their name ends with .gz
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* fopencookie */
+#define _GNU_SOURCE
+
+/* FILE, fopen, fopencookie, cookie_io_functions_t */
+#include <stdio.h>
+
+/* malloc, realloc, free */
+#include <stdlib.h>
+
+/* strlen, strcmp, strchr */
+#include <string.h>
+
+/* errno, EIO, ENOMEM */
+#include <errno.h>
+
+/* open, O_RDONLY */
+#include <fcntl.h>
+
+/* close */
+#include <unistd.h>
+
+/* mmap, munmap, madvise */
+#include <sys/mman.h>
+
+/* fstat */
+#include <sys/stat.h>
+
+/* gzopen, gzread, gzwrite, gzclose, gzbuffer */
+#include <zlib.h>
+
+#include "data_file.h"
+
+
+/*
+ *  Size of the buffers zlib reads and writes compressed files with
+ */
+#define COMPRESSED_FILE_BUFFER_SIZE (1 << 17)
+
+
+/*
+ *  Checks if a filename names a gzip compressed file
+ *
+ *  @param  const char* filename - the filename
+ *  @return BOOLEAN - TRUE if the filename ends with COMPRESSED_FILE_EXTENSION
+ */
+BOOLEAN isCompressedFilename( const char* filename )
+{
+    size_t len = strlen(filename), extLen = strlen(COMPRESSED_FILE_EXTENSION);
+    return (len > extLen && strcmp(filename + len - extLen, COMPRESSED_FILE_EXTENSION) == 0);
+}
+
+/*
+ *  Stream functions of a compressed file opened with fopencookie
+ */
+static ssize_t readCompressed( void* cookie, char* buffer, size_t size )
+{
+    int count = gzread((gzFile) cookie, buffer, (unsigned) size);
+    if(count < 0) errno = EIO;
+    return count;
+}
+
+static ssize_t writeCompressed( void* cookie, const char* buffer, size_t size )
+{
+    // A short count makes the stream report an error
+    if(size > 0 && gzwrite((gzFile) cookie, buffer, (unsigned) size) == 0)
+    {
+        errno = EIO;
+        return 0;
+    }
+    return size;
+}
+
+static int closeCompressed( void* cookie )
+{
+    if(gzclose((gzFile) cookie) != Z_OK)
+    {
+        errno = EIO;
+        return EOF;
+    }
+    return 0;
+}
+
+/*
+ *  Opens a file like fopen. Files named *.gz are decompressed as they are read
+ *  or compressed as they are written; they cannot be repositioned.
+ *
+ *  @param  char*   filename    - the file's name
+ *  @param  const char* mode    - "r", "w" or "a", optionally with "b"
+ *  @return FILE* - the open file or NULL if it could not be opened
+ */
+FILE* openDataFile( char* filename, const char* mode )
+{
+    if(isCompressedFilename(filename) == FALSE) return fopen(filename, mode);
+
+    BOOLEAN isReading = (strchr(mode, 'r') != NULL);
+    gzFile gz = gzopen(filename, isReading ? "rb" : (strchr(mode, 'a') != NULL ? "ab" : "wb"));
+    if(gz == NULL)
+    {
+        if(errno == 0) errno = ENOMEM;
+        return NULL;
+    }
+    gzbuffer(gz, COMPRESSED_FILE_BUFFER_SIZE);
+
+    cookie_io_functions_t functions = { NULL, NULL, NULL, closeCompressed };
+    if(isReading) functions.read = readCompressed;
+    else functions.write = writeCompressed;
+
+    FILE* fp = fopencookie(gz, isReading ? "r" : "w", functions);
+    if(fp == NULL) gzclose(gz);
+    return fp;
+}
+
+/*
+ *  Decompresses a whole file into an allocated buffer
+ *
+ *  @param  DATA_FILE* file     - receives the file's content
+ *  @param  char*   filename    - the file's name
+ *  @return BOOLEAN - TRUE if the file was read, FALSE otherwise
+ */
+static BOOLEAN inflateDataFile( DATA_FILE* file, char* filename )
+{
+    gzFile gz = gzopen(filename, "rb");
+    if(gz == NULL) return FALSE;
+    gzbuffer(gz, COMPRESSED_FILE_BUFFER_SIZE);
+
+    size_t capacity = COMPRESSED_FILE_BUFFER_SIZE;
+    char* data = (char*) malloc(capacity);
+    int count = 0;
+    while(data != NULL)
+    {
+        count = gzread(gz, data + file->size, (unsigned) (capacity - file->size));
+        if(count <= 0) break;
+        file->size += count;
+
+        // The decompressed size is unknown until the end of the file
+        if(file->size == capacity)
+        {
+            char* grown = (char*) realloc(data, capacity * 2);
+            if(grown == NULL) free(data);
+            data = grown;
+            capacity *= 2;
+        }
+    }
+
+    if(data == NULL || count < 0)
+    {
+        free(data);
+        gzclose(gz);
+        errno = (data == NULL) ? ENOMEM : EIO;
+        return FALSE;
+    }
+    gzclose(gz);
+
+    if(file->size == 0)
+    {
+        free(data);
+        data = NULL;
+    }
+    file->data = data;
+    return TRUE;
+}
+
+/*
+ *  Reads the whole content of a plain or compressed file
+ *
+ *  @param  DATA_FILE* file     - receives the file's content
+ *  @param  char*   filename    - the file's name
+ *  @return BOOLEAN - TRUE if the file was read, FALSE otherwise
+ */
+BOOLEAN loadDataFile( DATA_FILE* file, char* filename )
+{
+    file->data = NULL;
+    file->size = 0;
+    file->isMapped = FALSE;
+
+    if(isCompressedFilename(filename)) return inflateDataFile(file, filename);
+
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0) return FALSE;
+
+    struct stat st;
+    if(fstat(fd, &st) < 0)
+    {
+        close(fd);
+        return FALSE;
+    }
+
+    // An empty file cannot be mapped
+    if(st.st_size == 0)
+    {
+        close(fd);
+        return TRUE;
+    }
+
+    char* data = (char*) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) return FALSE;
+    madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+    file->data = data;
+    file->size = st.st_size;
+    file->isMapped = TRUE;
+    return TRUE;
+}
+
+/*
+ *  Releases the content of a file read by loadDataFile
+ *
+ *  @param  DATA_FILE* file     - a loaded file
+ *  @return nothing
+ */
+void releaseDataFile( DATA_FILE* file )
+{
+    if(file->data == NULL) return;
+
+    if(file->isMapped) munmap(file->data, file->size);
+    else free(file->data);
+    file->data = NULL;
+    file->size = 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  data_file.h
+ *
+ *    Description:  Input and output files that are transparently compressed
+ *                  with gzip when their name ends with .gz
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+
+#include "atpg_types.h"
+
+
+#ifndef DATA_FILE_H
+#define DATA_FILE_H
+
+
+/*
+ *  Extension of gzip compressed files
+ */
+#define COMPRESSED_FILE_EXTENSION   ".gz"
+
+/*
+ *  Whole content of an input file. Plain files are mapped into memory while
+ *  compressed files are decompressed into an allocated buffer.
+ */
+typedef struct
+{
+    char*   data;               // NULL for an empty file
+    size_t  size;
+    BOOLEAN isMapped;           // TRUE if <data> is a mapping of the file
+} DATA_FILE;
+
+
+/*
+ *  Checks if a filename names a gzip compressed file
+ *
+ *  @param  const char* filename - the filename
+ *  @return BOOLEAN - TRUE if the filename ends with COMPRESSED_FILE_EXTENSION
+ */
+BOOLEAN isCompressedFilename( const char* filename );
+
+/*
+ *  Opens a file like fopen. Files named *.gz are decompressed as they are read
+ *  or compressed as they are written; they cannot be repositioned.
+ *
+ *  @param  char*   filename    - the file's name
+ *  @param  const char* mode    - "r", "w" or "a", optionally with "b"
+ *  @return FILE* - the open file or NULL if it could not be opened
+ */
+FILE* openDataFile( char* filename, const char* mode );
+
+/*
+ *  Reads the whole content of a plain or compressed file
+ *
+ *  @param  DATA_FILE* file     - receives the file's content
+ *  @param  char*   filename    - the file's name
+ *  @return BOOLEAN - TRUE if the file was read, FALSE otherwise
+ */
+BOOLEAN loadDataFile( DATA_FILE* file, char* filename );
+
+/*
+ *  Releases the content of a file read by loadDataFile
+ *
+ *  @param  DATA_FILE* file     - a loaded file
+ *  @return nothing
+ */
+void releaseDataFile( DATA_FILE* file );
+
+#endif
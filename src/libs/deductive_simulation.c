@@ -0,0 +1,350 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  deductive_simulation.c
+ *
+ *    Description:  Deductive fault simulation: the faults detected by a test
+ *                  vector deduced from the fault lists of the gates, all in
+ *                  one pass through the circuit
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* qsort, free */
+#include <stdlib.h>
+
+/* bzero */
+#include <strings.h>
+
+#include "deductive_simulation.h"
+#include "fault_list.h"
+#include "fault_set.h"
+#include "fault_simulation.h"
+#include "logic_tables.h"
+#include "test_cube.h"
+#include "test_generator.h"
+
+
+/*
+ *  Searches a fault in a fault list
+ *
+ *  @param  const int32_t* ids  - the faults of the list, ascending
+ *  @param  int     count       - the number of faults of the list
+ *  @param  int     id          - the fault
+ *  @return BOOLEAN TRUE if the list holds the fault and FALSE otherwise
+ */
+static BOOLEAN hasFault( const int32_t* ids, int count, int id )
+{
+    int low = 0, high = count - 1, middle;
+    while(low <= high)
+    {
+        middle = (low + high) / 2;
+        if(ids[middle] == id) return TRUE;
+        if(ids[middle] < id) low = middle + 1;
+        else high = middle - 1;
+    }
+    return FALSE;
+}
+
+/*
+ *  Appends a fault to the fault list of the gate being deduced
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator, with room for the entry
+ *  @param  int     id          - the fault
+ *  @param  LOGIC_VALUE value   - the gate's value with the fault
+ *  @return nothing
+ */
+static inline void appendEntry( DEDUCTIVE_SIMULATOR* sim, int id, LOGIC_VALUE value )
+{
+    sim->ids[sim->size]    = id;
+    sim->values[sim->size] = value;
+    sim->size++;
+}
+
+/*
+ *  Deduces the fault list of a gate whose inputs are 0 or 1 and hold D or B
+ *  with every listed fault, with the set operations of its function. A fault
+ *  flips an AND or OR gate if it flips every input holding the controlling
+ *  value and no other input, or any input when none holds it; it flips an
+ *  XOR gate if it flips an odd number of inputs.
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator, holding the inputs' lists
+ *  @param  CIRCUIT* circuit    - the circuit, holding the fault-free values
+ *  @param  int     gate        - the gate, 0 or 1
+ *  @return nothing
+ */
+static void deduceBinaryFaults( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, int gate )
+{
+    const int32_t* in = circuit->fanin + circuit->faninStart[gate];
+    LOGIC_VALUE control, flipped = (circuit->value[gate] == I) ? D : B;
+    FAULT_PIN* pins = sim->pins;
+    int K, L, id, numIn = NUM_FANIN(circuit, gate), smallest = -1, parity;
+
+    switch(KERNEL_FUNCTION(circuit->kernel[gate]) >> 1)
+    {
+        case FUNCTION_AND >> 1:
+            control = O;
+            break;
+        case FUNCTION_OR >> 1:
+            control = I;
+            break;
+        default:
+            while((id = nextFault(&sim->faults, pins, numIn)) >= 0)
+            {
+                for(K = parity = 0; K < numIn; K++)
+                    if(pins[K].next < pins[K].count && pins[K].ids[pins[K].next] == id)
+                    {
+                        parity ^= 1;
+                        pins[K].next++;
+                    }
+                if(parity) appendEntry(sim, id, flipped);
+            }
+            return;
+    }
+
+    // The union of the lists when no input holds the controlling value
+    for(K = 0; K < numIn; K++)
+        if(circuit->value[in[K]] == control && (smallest < 0 || pins[K].count < pins[smallest].count))
+            smallest = K;
+    if(smallest < 0)
+    {
+        while((id = nextFault(&sim->faults, pins, numIn)) >= 0)
+        {
+            for(K = 0; K < numIn; K++)
+                if(pins[K].next < pins[K].count && pins[K].ids[pins[K].next] == id) pins[K].next++;
+            appendEntry(sim, id, flipped);
+        }
+        return;
+    }
+
+    // Otherwise the intersection of the lists of the controlling inputs, less
+    // the faults of the other lists, read from the shortest controlling list
+    for(L = 0; L < pins[smallest].count; L++)
+    {
+        id = pins[smallest].ids[L];
+        for(K = 0; K < numIn; K++)
+            if(K != smallest && hasFault(pins[K].ids, pins[K].count, id) != (circuit->value[in[K]] == control))
+                break;
+        if(K == numIn) appendEntry(sim, id, flipped);
+    }
+}
+
+/*
+ *  Deduces the fault list of a gate by evaluating it for every fault of the
+ *  lists of its inputs, for gates having an input X in the fault-free circuit
+ *  or with a fault
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator, holding the inputs' lists
+ *  @param  CIRCUIT* circuit    - the circuit, holding the fault-free values
+ *  @param  int     gate        - the gate, 0 or 1
+ *  @return nothing
+ */
+static void deduceEvaluatedFaults( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, int gate )
+{
+    const int32_t* in = circuit->fanin + circuit->faninStart[gate];
+    FAULT_PIN* pins = sim->pins;
+    LOGIC_VALUE value;
+    int K, id, numIn = NUM_FANIN(circuit, gate);
+
+    while((id = nextFault(&sim->faults, pins, numIn)) >= 0)
+    {
+        for(K = 0; K < numIn; K++)
+            if(pins[K].next < pins[K].count && pins[K].ids[pins[K].next] == id)
+                sim->pinValues[K] = pins[K].values[pins[K].next++];
+            else
+                sim->pinValues[K] = circuit->value[in[K]];
+
+        value = evaluateGateKernel(circuit->kernel[gate], sim->pinValues, sim->pinOrder, numIn);
+        if(value == circuit->value[gate]) continue;
+        appendEntry(sim, id, value);
+        if(value == X) sim->isBinary[gate] = 0;
+    }
+}
+
+/*
+ *  Deduces the fault list of a gate from the lists of its inputs and the
+ *  faults of the gate itself the test vector excites
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit, holding the fault-free values
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate
+ *  @param  int     gate        - the gate
+ *  @return nothing
+ */
+static void deduceFaultList( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, FAULT_LIST* fList, int gate )
+{
+    const int32_t* in = circuit->fanin + circuit->faninStart[gate];
+    LOGIC_VALUE good = circuit->value[gate], flipped = (good == I) ? D : B;
+    int K, id, numIn = NUM_FANIN(circuit, gate), numOwn = 0;
+    size_t need, first, L, M, branchSize = 0, branchNeed = 0;
+    BOOLEAN isBinary = TRUE, isSorted = TRUE;
+
+    sim->listStart[gate] = sim->size;
+    sim->listCount[gate] = 0;
+    sim->isBinary[gate]  = 1;
+
+    // Every fault leaves a gate unknown in the fault-free circuit unknown
+    if(good == X) return;
+
+    // The excited faults of the gate, the ones of its fan out branches being
+    // given to the inputs of the gates they drive
+    for(K = fList->gateStart[gate]; K < fList->gateStart[gate + 1]; K++)
+    {
+        id = fList->byGate[K];
+        if(isActiveFault(&sim->faults, id) == FALSE || exciteValue(fList->faults[id].type, good) == X) continue;
+        if(fList->faults[id].indexOut >= 0 && NUM_FANOUT(circuit, gate) > 1) continue;
+        if(numOwn > 0 && sim->faults.own[numOwn - 1] > id) isSorted = FALSE;
+        sim->faults.own[numOwn++] = id;
+    }
+    if(isSorted == FALSE) qsort(sim->faults.own, numOwn, sizeof(int32_t), cmpFaultIds);
+
+    // Room for the list of the gate and the lists of the branches feeding it
+    need = numOwn;
+    for(K = 0; K < numIn; K++)
+    {
+        need += sim->listCount[in[K]];
+        if(NUM_FANOUT(circuit, in[K]) < 2) continue;
+        need += fList->gateStart[in[K] + 1] - fList->branchStart[in[K]];
+        branchNeed += sim->listCount[in[K]] + fList->gateStart[in[K] + 1] - fList->branchStart[in[K]];
+    }
+    reserveEntries(&sim->ids, &sim->values, &sim->capacity, sim->size + need);
+    reserveEntries(&sim->faults.branchIds, &sim->faults.branchValues, &sim->faults.branchCapacity, branchNeed);
+
+    // The faults changing the gate's value through its inputs
+    for(K = 0; K < numIn; K++)
+    {
+        sim->pins[K].ids      = sim->ids + sim->listStart[in[K]];
+        sim->pins[K].values   = sim->values + sim->listStart[in[K]];
+        sim->pins[K].count    = sim->listCount[in[K]];
+        sim->pins[K].next     = 0;
+        sim->pins[K].isBinary = sim->isBinary[in[K]] ? TRUE : FALSE;
+        readBranchFaults(&sim->faults, circuit, fList, gate, in[K], circuit->value[in[K]], &sim->pins[K], &branchSize);
+        if(circuit->value[in[K]] == X || sim->pins[K].isBinary == FALSE) isBinary = FALSE;
+    }
+    if(isBinary == TRUE)
+        deduceBinaryFaults(sim, circuit, gate);
+    else
+        deduceEvaluatedFaults(sim, circuit, gate);
+
+    // Merge the gate's own faults, from the last entries on
+    first = sim->listStart[gate];
+    L = sim->size;
+    M = sim->size + numOwn;
+    for(K = numOwn - 1; K >= 0; K--)
+    {
+        while(L > first && sim->ids[L - 1] > sim->faults.own[K])
+        {
+            M--, L--;
+            sim->ids[M]    = sim->ids[L];
+            sim->values[M] = sim->values[L];
+        }
+        M--;
+        sim->ids[M]    = sim->faults.own[K];
+        sim->values[M] = flipped;
+    }
+    sim->size += numOwn;
+    sim->listCount[gate] = (int32_t) (sim->size - first);
+}
+
+/*
+ *  Sizes the simulator for a circuit whose levels are computed. The storage of
+ *  a simulator that was built before is reused.
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @return nothing
+ */
+void buildDeductiveSimulator( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info )
+{
+    int K, numGates = info->numGates, maxFanin = 1;
+
+    for(K = 0; K < numGates; K++)
+        if(NUM_FANIN(circuit, K) > maxFanin) maxFanin = NUM_FANIN(circuit, K);
+
+    sim->listStart = growFaultArray(sim->listStart, numGates, sizeof(size_t));
+    sim->listCount = growFaultArray(sim->listCount, numGates, sizeof(int32_t));
+    sim->isBinary  = growFaultArray(sim->isBinary, numGates, sizeof(uint8_t));
+    sim->pins      = growFaultArray(sim->pins, maxFanin, sizeof(FAULT_PIN));
+    sim->pinOrder  = growFaultArray(sim->pinOrder, maxFanin, sizeof(int32_t));
+    sim->pinValues = growFaultArray(sim->pinValues, maxFanin, sizeof(uint8_t));
+    sim->numGates  = numGates;
+    sim->maxFanin  = maxFanin;
+    sim->size      = 0;
+    for(K = 0; K < maxFanin; K++)
+        sim->pinOrder[K] = K;
+}
+
+/*
+ *  Simulates a test vector to drop all the faults it detects from the given
+ *  position in the fault list on, as simulateTestVector does. The fault lists
+ *  of the gates are deduced in the evaluation order from the lists of their
+ *  inputs, and the faults listed at the output gates are detected.
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate if it is not
+ *  @param  TEST_VECTOR* tv     - test vector object, holding the expected outputs
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void simulateDeductiveVector( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                              FAULT_LIST* fList, TEST_VECTOR* tv, int start )
+{
+    int K, gate;
+
+    if(fList->numGates != info->numGates) indexFaultsByGate(fList, info->numGates);
+    startFaultSet(&sim->faults, info, fList);
+    activateFaults(&sim->faults, fList, start, fList->count);
+
+    // Simulate the fault-free circuit
+    fillDontCares(info, tv);
+    sweep_pattern(circuit, info, &tv->input, NULL, NULL, NULL);
+
+    // Deduce the fault lists, every gate after its inputs
+    sim->size = 0;
+    for(K = 0; K < info->numGates; K++)
+        deduceFaultList(sim, circuit, fList, circuit->order[K]);
+
+    // Drop the faults listed at the output gates
+    for(K = 0; K < info->numPO; K++)
+    {
+        gate = info->outputs[K];
+        sim->faults.outputs[K].ids    = sim->ids + sim->listStart[gate];
+        sim->faults.outputs[K].values = sim->values + sim->listStart[gate];
+        sim->faults.outputs[K].count  = sim->listCount[gate];
+    }
+    dropDetectedFaults(&sim->faults, info, fList, tv, circuit->value, start, fList->count);
+}
+
+/*
+ *  Frees the memory of the simulator
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+void releaseDeductiveSimulator( DEDUCTIVE_SIMULATOR* sim )
+{
+    free(sim->listStart);
+    free(sim->listCount);
+    free(sim->isBinary);
+    free(sim->ids);
+    free(sim->values);
+    free(sim->pins);
+    free(sim->pinOrder);
+    free(sim->pinValues);
+    releaseFaultSet(&sim->faults);
+    bzero(sim, sizeof(DEDUCTIVE_SIMULATOR));
+}
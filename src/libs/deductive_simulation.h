@@ -0,0 +1,97 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  deductive_simulation.h
+ *
+ *    Description:  Deductive fault simulation: the faults detected by a test
+ *                  vector deduced from the fault lists of the gates, all in
+ *                  one pass through the circuit
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atpg_types.h"
+#include "fault_set.h"
+
+
+#ifndef DEDUCTIVE_SIMULATION_H
+#define DEDUCTIVE_SIMULATION_H
+
+
+/*
+ *  Deductive fault simulator. The fault list of a gate holds the faults
+ *  giving it another value than in the fault-free circuit along with that
+ *  value: D or B, or X where a fault leaves it unknown. The lists of all the
+ *  gates of a test vector are kept back to back in <ids> and <values>.
+ */
+typedef struct
+{
+    int        numGates;        // Number of gates the arrays can hold
+    int        maxFanin;        // Inputs of the widest gate
+
+    size_t*    listStart;       // Position in <ids> of the fault list of every gate
+    int32_t*   listCount;       // Number of faults in the list of every gate
+    uint8_t*   isBinary;        // 1 -> every value of the gate's list is D or B
+    int32_t*   ids;             // Fault lists of the gates, each sorted by fault position
+    uint8_t*   values;          // The gate's value with every listed fault
+    size_t     size;            // Entries used in <ids> and <values>
+    size_t     capacity;        // Entries <ids> and <values> can hold
+    FAULT_SET  faults;          // The faults simulated, and the ones detected
+
+    FAULT_PIN* pins;            // The fault lists of the inputs of a gate
+    int32_t*   pinOrder;        // 0 to maxFanin - 1, the inputs of a gate evaluated alone
+    uint8_t*   pinValues;       // The values of the inputs of a gate with a fault
+} DEDUCTIVE_SIMULATOR;
+
+
+/*
+ *  Sizes the simulator for a circuit whose levels are computed. The storage of
+ *  a simulator that was built before is reused.
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @return nothing
+ */
+void buildDeductiveSimulator( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info );
+
+/*
+ *  Simulates a test vector to drop all the faults it detects from the given
+ *  position in the fault list on, as simulateTestVector does. The fault lists
+ *  of the gates are deduced in the evaluation order from the lists of their
+ *  inputs, and the faults listed at the output gates are detected.
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate if it is not
+ *  @param  TEST_VECTOR* tv     - test vector object, holding the expected outputs
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void simulateDeductiveVector( DEDUCTIVE_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                              FAULT_LIST* fList, TEST_VECTOR* tv, int start );
+
+/*
+ *  Frees the memory of the simulator
+ *
+ *  @param  DEDUCTIVE_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+void releaseDeductiveSimulator( DEDUCTIVE_SIMULATOR* sim );
+
+#endif
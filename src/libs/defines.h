@@ -28,6 +28,10 @@
 #define GLOBAL_NAME 			"atpg"
 #define VERSION					"1.0"
 #define FAULT_FILE_EXTENSION	".flt"
+#define BINARY_FAULT_FILE_EXTENSION ".bfl"
+#define COMPILED_NETLIST_EXTENSION  ".cnl"
+#define TEST_PATTERN_FILE_EXTENSION ".tvl"
+#define BINARY_TEST_PATTERN_FILE_EXTENSION  ".tvb"
  
 /*
  *  Custom error codes
@@ -37,21 +41,17 @@
 #define ERROR_IO_LIMIT_EXCEEDED		    10002
 #define ERROR_PARSING_CIRCUIT		    10003
 #define ERROR_PARSING_FAULT_LIST        10004
+#define ERROR_PARSING_TEST_PATTERNS     10005
 
 /*
  *  Gate contents limits
  */
-#define MAX_WORD            32      // Maximum length of names
-#define MAX_GATES           100000  // Maximum gates in a circuit
-#define MAX_INPUT_GATES     2000    // Maximum input lines in a gate
-#define MAX_OUTPUT_GATES    2000    // Maximum output lines in a gate
 #define MAX_LINE_LENGTH     256     // Maximum length of an input file line
 #define MAX_LOGIC_VALUES	5 		// Maximum number of logical values used
 
 /*
  *
  */
-#define MAX_FAULTS          1000000 // Maximum number of faults
 
 
 #endif
@@ -0,0 +1,82 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  dual_rail.c
+ *
+ *    Description:  Five valued logic in dual-rail form, 64 signals to a word
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include "dual_rail.h"
+
+
+/*
+ *  Makes a word of signals holding the same value on every lane
+ *
+ *  @param  LOGIC_VALUE value - the value of the lanes
+ *  @return DUAL_RAIL - the word of signals
+ */
+DUAL_RAIL spreadDualRail( LOGIC_VALUE value )
+{
+    DUAL_RAIL word = { 0, 0, 0 };
+    switch(value)
+    {
+        case I: word.good = word.faulty = ~(uint64_t) 0; break;
+        case D: word.good   = ~(uint64_t) 0; break;
+        case B: word.faulty = ~(uint64_t) 0; break;
+        case O: break;
+        default: word.unknown = ~(uint64_t) 0; break;
+    }
+    return word;
+}
+
+/*
+ *  Sets the value of a lane of a word of signals
+ *
+ *  @param  DUAL_RAIL* word  - the word of signals
+ *  @param  int     lane     - the position of the signal, 0 to 63
+ *  @param  LOGIC_VALUE value - the value of the signal
+ *  @return nothing
+ */
+void setDualRailValue( DUAL_RAIL* word, int lane, LOGIC_VALUE value )
+{
+    uint64_t bit = (uint64_t) 1 << lane;
+    word->good    &= ~bit;
+    word->faulty  &= ~bit;
+    word->unknown &= ~bit;
+    switch(value)
+    {
+        case I: word->good |= bit; word->faulty |= bit; break;
+        case D: word->good    |= bit; break;
+        case B: word->faulty  |= bit; break;
+        case O: break;
+        default: word->unknown |= bit; break;
+    }
+}
+
+/*
+ *  Extracts the value of a lane of a word of signals
+ *
+ *  @param  const DUAL_RAIL* word - the word of signals
+ *  @param  int     lane     - the position of the signal, 0 to 63
+ *  @return LOGIC_VALUE - the value of the signal
+ */
+LOGIC_VALUE getDualRailValue( const DUAL_RAIL* word, int lane )
+{
+    // Index on the (good, faulty) pair: O, B, D and I
+    static const LOGIC_VALUE known[4] = { O, B, D, I };
+    if((word->unknown >> lane) & 1) return X;
+    return known[(((word->good >> lane) & 1) << 1) | ((word->faulty >> lane) & 1)];
+}
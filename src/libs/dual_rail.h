@@ -0,0 +1,201 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  dual_rail.h
+ *
+ *    Description:  Five valued logic in dual-rail form, 64 signals to a word
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef DUAL_RAIL_H
+#define DUAL_RAIL_H
+
+
+/*
+ *  The logic operators below compute the same values as the logic tables, on
+ *  every lane at once. The X lanes of their results keep both of their value
+ *  bits cleared.
+ */
+
+/*
+ *  Computes the AND of two words of signals. A lane is O as soon as one of its
+ *  operands is O, X otherwise if one of its operands is X.
+ *
+ *  @param  DUAL_RAIL a      - the first operand
+ *  @param  DUAL_RAIL b      - the second operand
+ *  @return DUAL_RAIL - the results of the operation
+ */
+static inline DUAL_RAIL andDualRail( DUAL_RAIL a, DUAL_RAIL b )
+{
+    uint64_t zeroA = ~(a.good | a.faulty | a.unknown);
+    uint64_t zeroB = ~(b.good | b.faulty | b.unknown);
+    DUAL_RAIL result;
+    result.good    = a.good & b.good;
+    result.faulty  = a.faulty & b.faulty;
+    result.unknown = (a.unknown & ~zeroB) | (b.unknown & ~zeroA);
+    return result;
+}
+
+/*
+ *  Computes the OR of two words of signals. A lane is I as soon as one of its
+ *  operands is I, X otherwise if one of its operands is X.
+ *
+ *  @param  DUAL_RAIL a      - the first operand
+ *  @param  DUAL_RAIL b      - the second operand
+ *  @return DUAL_RAIL - the results of the operation
+ */
+static inline DUAL_RAIL orDualRail( DUAL_RAIL a, DUAL_RAIL b )
+{
+    uint64_t oneA = a.good & a.faulty;
+    uint64_t oneB = b.good & b.faulty;
+    DUAL_RAIL result;
+    result.unknown = (a.unknown & ~oneB) | (b.unknown & ~oneA);
+    result.good    = (a.good | b.good) & ~result.unknown;
+    result.faulty  = (a.faulty | b.faulty) & ~result.unknown;
+    return result;
+}
+
+/*
+ *  Computes the XOR of two words of signals. A lane is X if one of its operands
+ *  is X.
+ *
+ *  @param  DUAL_RAIL a      - the first operand
+ *  @param  DUAL_RAIL b      - the second operand
+ *  @return DUAL_RAIL - the results of the operation
+ */
+static inline DUAL_RAIL xorDualRail( DUAL_RAIL a, DUAL_RAIL b )
+{
+    DUAL_RAIL result;
+    result.unknown = a.unknown | b.unknown;
+    result.good    = (a.good ^ b.good) & ~result.unknown;
+    result.faulty  = (a.faulty ^ b.faulty) & ~result.unknown;
+    return result;
+}
+
+/*
+ *  Negates a word of signals or passes it as it is depending on the flag <inv>
+ *
+ *  @param  DUAL_RAIL value  - the signals to be negated
+ *  @param  BOOLEAN inv      - marking if the signals have to be negated or not
+ *  @return DUAL_RAIL - the results of the operation
+ */
+static inline DUAL_RAIL negateDualRail( DUAL_RAIL value, BOOLEAN inv )
+{
+    if(inv == TRUE)
+    {
+        value.good   = ~(value.good | value.unknown);
+        value.faulty = ~(value.faulty | value.unknown);
+    }
+    return value;
+}
+
+/*
+ *  Evaluates a gate with its kernel on every lane at once, giving the same
+ *  outputs as evaluateGateKernel. The true and the faulty circuit values are
+ *  each reduced over all the inputs before a lane unknown in either of them
+ *  is made X.
+ *
+ *  @param  uint8_t kernel  - the GATE_KERNEL of the gate
+ *  @param  const DUAL_RAIL* word - the words of signals of every gate
+ *  @param  const int32_t* in - the gates driving the inputs
+ *  @param  int     numIn   - the number of inputs
+ *  @return DUAL_RAIL - the outputs of the gate
+ */
+static inline DUAL_RAIL evaluateDualRailKernel( uint8_t kernel, const DUAL_RAIL* word,
+                                                const int32_t* in, int numIn )
+{
+    uint64_t goodOne, goodZero, faultyOne, faultyZero;
+    DUAL_RAIL result;
+    int K;
+
+    if(KERNEL_ARITY(kernel) == 0) return (DUAL_RAIL) { 0, 0, ~(uint64_t) 0 };
+    switch(KERNEL_FUNCTION(kernel) >> 1)
+    {
+        case FUNCTION_AND >> 1:     // 1 if every input is 1, 0 if one of them is 0
+            goodOne = faultyOne = ~(uint64_t) 0;
+            goodZero = faultyZero = 0;
+            for(K = 0; K < numIn; K++)
+            {
+                goodOne    &= word[in[K]].good;
+                faultyOne  &= word[in[K]].faulty;
+                goodZero   |= ~(word[in[K]].good | word[in[K]].unknown);
+                faultyZero |= ~(word[in[K]].faulty | word[in[K]].unknown);
+            }
+            break;
+        case FUNCTION_OR >> 1:      // 1 if one of the inputs is 1, 0 if every one is 0
+            goodOne = faultyOne = 0;
+            goodZero = faultyZero = ~(uint64_t) 0;
+            for(K = 0; K < numIn; K++)
+            {
+                goodOne    |= word[in[K]].good;
+                faultyOne  |= word[in[K]].faulty;
+                goodZero   &= ~(word[in[K]].good | word[in[K]].unknown);
+                faultyZero &= ~(word[in[K]].faulty | word[in[K]].unknown);
+            }
+            break;
+        default:                    // The parity of the 1s unless an input is X
+            goodOne = faultyOne = goodZero = 0;
+            for(K = 0; K < numIn; K++)
+            {
+                goodOne   ^= word[in[K]].good;
+                faultyOne ^= word[in[K]].faulty;
+                goodZero  |= word[in[K]].unknown;
+            }
+            goodZero = faultyZero = ~goodZero;
+            goodOne   &= goodZero;
+            faultyOne &= faultyZero;
+            break;
+    }
+
+    result.unknown = ~((goodOne | goodZero) & (faultyOne | faultyZero));
+    result.good    = goodOne & ~result.unknown;
+    result.faulty  = faultyOne & ~result.unknown;
+    return negateDualRail(result, (BOOLEAN) (KERNEL_FUNCTION(kernel) & 1));
+}
+
+/*
+ *  Makes a word of signals holding the same value on every lane
+ *
+ *  @param  LOGIC_VALUE value - the value of the lanes
+ *  @return DUAL_RAIL - the word of signals
+ */
+DUAL_RAIL spreadDualRail( LOGIC_VALUE value );
+
+/*
+ *  Sets the value of a lane of a word of signals
+ *
+ *  @param  DUAL_RAIL* word  - the word of signals
+ *  @param  int     lane     - the position of the signal, 0 to 63
+ *  @param  LOGIC_VALUE value - the value of the signal
+ *  @return nothing
+ */
+void setDualRailValue( DUAL_RAIL* word, int lane, LOGIC_VALUE value );
+
+/*
+ *  Extracts the value of a lane of a word of signals
+ *
+ *  @param  const DUAL_RAIL* word - the word of signals
+ *  @param  int     lane     - the position of the signal, 0 to 63
+ *  @return LOGIC_VALUE - the value of the signal
+ */
+LOGIC_VALUE getDualRailValue( const DUAL_RAIL* word, int lane );
+
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  event_queue.c
+ *
+ *    Description:  Level-bucketed queue of the gates scheduled for event-driven
+ *                  simulation
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* realloc, free, exit */
+#include <stdlib.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+#include "event_queue.h"
+
+
+/*
+ *  Resizes an array of the queue, quitting when memory runs out
+ *
+ *  @param  void*   items   - the array
+ *  @param  int     count   - the number of items it must hold
+ *  @param  size_t  size    - the size of one item
+ *  @return void* - the resized array
+ */
+static void* growEventArray( void* items, int count, size_t size )
+{
+    items = realloc(items, (size_t) (count > 0 ? count : 1) * size);
+    if(items == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    return items;
+}
+
+/*
+ *  Sizes the queue for the buckets laid out in <bucketStart> and empties it
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue, whose buckets are set
+ *  @param  int     numGates    - total number of gates
+ *  @return nothing
+ */
+static void resetEventQueue( EVENT_QUEUE* queue, int numGates )
+{
+    int K, numLevels = queue->numLevels;
+
+    queue->head      = growEventArray(queue->head, numLevels, sizeof(int32_t));
+    queue->count     = growEventArray(queue->count, numLevels, sizeof(int32_t));
+    queue->events    = growEventArray(queue->events, numGates, sizeof(int32_t));
+    queue->scheduled = growEventArray(queue->scheduled, numGates, sizeof(uint8_t));
+    for(K = 0; K < numLevels; K++)
+    {
+        queue->head[K]  = queue->bucketStart[K];
+        queue->count[K] = 0;
+    }
+
+    bzero(queue->scheduled, numGates * sizeof(uint8_t));
+    queue->level = numLevels;
+    queue->size  = 0;
+}
+
+/*
+ *  Sizes the buckets of the queue for the given gate levels and empties it.
+ *  The storage of a queue that was built before is reused.
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @param  const int32_t* level - the level of every gate
+ *  @param  int     numGates    - total number of gates
+ *  @return nothing
+ */
+void buildEventQueue( EVENT_QUEUE* queue, const int32_t* level, int numGates )
+{
+    int K, numLevels = 0;
+    for(K = 0; K < numGates; K++)
+        if(level[K] + 1 > numLevels) numLevels = level[K] + 1;
+
+    queue->bucketStart = growEventArray(queue->bucketStart, numLevels + 1, sizeof(int32_t));
+    queue->numLevels   = numLevels;
+
+    // Every bucket holds as many events as there are gates in its level
+    bzero(queue->bucketStart, (numLevels + 1) * sizeof(int32_t));
+    for(K = 0; K < numGates; K++)
+        queue->bucketStart[level[K] + 1]++;
+    for(K = 0; K < numLevels; K++)
+        queue->bucketStart[K + 1] += queue->bucketStart[K];
+
+    resetEventQueue(queue, numGates);
+}
+
+/*
+ *  Sets up an empty queue over buckets laid out before by buildEventQueue,
+ *  such as the ones of a compiled netlist. The queue uses <bucketStart> in
+ *  place: its owner keeps it and takes it back before releaseEventQueue.
+ *
+ *  @param  EVENT_QUEUE* queue  - an empty queue
+ *  @param  int32_t* bucketStart - numLevels + 1 bucket positions
+ *  @param  int     numLevels   - number of gate levels
+ *  @param  int     numGates    - total number of gates
+ *  @return nothing
+ */
+void openEventQueue( EVENT_QUEUE* queue, int32_t* bucketStart, int numLevels, int numGates )
+{
+    queue->bucketStart = bucketStart;
+    queue->numLevels   = numLevels;
+    resetEventQueue(queue, numGates);
+}
+
+/*
+ *  Schedules a gate for evaluation unless it is already scheduled
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @param  int     gate        - the gate
+ *  @param  int     level       - the gate's level
+ *  @return nothing
+ */
+void scheduleEvent( EVENT_QUEUE* queue, int gate, int level )
+{
+    if(queue->scheduled[gate]) return;
+
+    // Wrap around the end of the bucket
+    int slot = queue->head[level] + queue->count[level];
+    if(slot >= queue->bucketStart[level + 1])
+        slot -= queue->bucketStart[level + 1] - queue->bucketStart[level];
+
+    queue->scheduled[gate] = 1;
+    queue->events[slot] = gate;
+    queue->count[level]++;
+    if(level < queue->level) queue->level = level;
+    queue->size++;
+}
+
+/*
+ *  Removes the first gate scheduled at the lowest level
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @return int - the gate or -1 if the queue is empty
+ */
+int nextEvent( EVENT_QUEUE* queue )
+{
+    if(queue->size == 0) return -1;
+
+    int level = queue->level;
+    while(queue->count[level] == 0) level++;
+    queue->level = level;
+
+    int gate = queue->events[queue->head[level]];
+    if(++queue->head[level] == queue->bucketStart[level + 1])
+        queue->head[level] = queue->bucketStart[level];
+    queue->count[level]--;
+    queue->scheduled[gate] = 0;
+
+    if(--queue->size == 0) queue->level = queue->numLevels;
+
+    return gate;
+}
+
+/*
+ *  Drops all the scheduled gates
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @return nothing
+ */
+void clearEventQueue( EVENT_QUEUE* queue )
+{
+    while(nextEvent(queue) >= 0);
+}
+
+/*
+ *  Releases the storage of the queue and empties it
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @return nothing
+ */
+void releaseEventQueue( EVENT_QUEUE* queue )
+{
+    free(queue->bucketStart);
+    free(queue->head);
+    free(queue->count);
+    free(queue->events);
+    free(queue->scheduled);
+    bzero(queue, sizeof(EVENT_QUEUE));
+}
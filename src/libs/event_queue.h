@@ -0,0 +1,88 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  event_queue.h
+ *
+ *    Description:  Level-bucketed queue of the gates scheduled for event-driven
+ *                  simulation
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include "atpg_types.h"
+
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+
+/*
+ *  Sizes the buckets of the queue for the given gate levels and empties it.
+ *  The storage of a queue that was built before is reused.
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @param  const int32_t* level - the level of every gate
+ *  @param  int     numGates    - total number of gates
+ *  @return nothing
+ */
+void buildEventQueue( EVENT_QUEUE* queue, const int32_t* level, int numGates );
+
+/*
+ *  Sets up an empty queue over buckets laid out before by buildEventQueue,
+ *  such as the ones of a compiled netlist. The queue uses <bucketStart> in
+ *  place: its owner keeps it and takes it back before releaseEventQueue.
+ *
+ *  @param  EVENT_QUEUE* queue  - an empty queue
+ *  @param  int32_t* bucketStart - numLevels + 1 bucket positions
+ *  @param  int     numLevels   - number of gate levels
+ *  @param  int     numGates    - total number of gates
+ *  @return nothing
+ */
+void openEventQueue( EVENT_QUEUE* queue, int32_t* bucketStart, int numLevels, int numGates );
+
+/*
+ *  Schedules a gate for evaluation unless it is already scheduled
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @param  int     gate        - the gate
+ *  @param  int     level       - the gate's level
+ *  @return nothing
+ */
+void scheduleEvent( EVENT_QUEUE* queue, int gate, int level );
+
+/*
+ *  Removes the first gate scheduled at the lowest level
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @return int - the gate or -1 if the queue is empty
+ */
+int nextEvent( EVENT_QUEUE* queue );
+
+/*
+ *  Drops all the scheduled gates
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @return nothing
+ */
+void clearEventQueue( EVENT_QUEUE* queue );
+
+/*
+ *  Releases the storage of the queue and empties it
+ *
+ *  @param  EVENT_QUEUE* queue  - the queue
+ *  @return nothing
+ */
+void releaseEventQueue( EVENT_QUEUE* queue );
+
+#endif
@@ -0,0 +1,653 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  fault_list.c
+ *
+ *    Description:  Fault list database and fault list files loader. The file is
+ *                  mapped into memory and
+ *                  tokenized in a single pass; gate names are resolved in place
+ *                  through the gate names table and fan out branches through an
+ *                  index of the circuit's (stem, sink) pairs.
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* FILE, fprintf, fwrite, fclose, sprintf */
+#include <stdio.h>
+
+/* malloc, free, exit */
+#include <stdlib.h>
+
+/* memchr, memcmp, memcpy, memset, strlen, strncmp */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+#include "fault_list.h"
+#include "symbol_table.h"
+#include "data_file.h"
+
+
+/*
+ *  Allocates the faults of an empty fault list and their statuses in a single
+ *  block, all the faults being undetected
+ *
+ *  @param  FAULT_LIST* faultList   - an empty fault list
+ *  @param  int     capacity        - the number of faults the list must hold
+ *  @return nothing
+ */
+void allocateFaultList( FAULT_LIST* faultList, int capacity )
+{
+    size_t words = FAULT_STATUS_WORDS((size_t) capacity);
+
+    // The statuses come first to keep their words aligned
+    uint64_t* block = (uint64_t*) calloc(1, MAX_FAULT_STATUS * words * sizeof(uint64_t) +
+                                            (size_t) (capacity > 0 ? capacity : 1) * sizeof(FAULT));
+    if(block == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+
+    int K;
+    for(K = 0; K < MAX_FAULT_STATUS; K++)
+        faultList->status[K] = block + K * words;
+    faultList->faults   = (FAULT*) (block + MAX_FAULT_STATUS * words);
+    faultList->block    = block;
+    faultList->capacity = capacity;
+    faultList->count    = 0;
+}
+
+/*
+ *  Appends a fault to a fault list
+ *
+ *  @param  FAULT_LIST* faultList   - an allocated fault list
+ *  @param  int     index           - the faulty gate (the stem of a fan out branch)
+ *  @param  int     indexOut        - the gate driven by the faulty fan out branch,
+ *                                    -1 for the main segment
+ *  @param  FAULT_TYPE type         - the stuck-at value
+ *  @return int - the position of the fault in the fault list
+ */
+int appendFault( FAULT_LIST* faultList, int index, int indexOut, FAULT_TYPE type )
+{
+    if(faultList->count == faultList->capacity)
+    {
+        extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+        sprintf(ERROR_MESSAGE, "The fault list has more than %d faults", faultList->capacity);
+        errno = ERROR_IO_LIMIT_EXCEEDED;
+        exit(1);
+    }
+
+    FAULT* fault = &faultList->faults[faultList->count];
+    fault->index    = index;
+    fault->indexOut = indexOut;
+    fault->type     = type;
+    return faultList->count++;
+}
+
+/*
+ *  Indexes the faults of a fault list by gate, the faults of the main segment
+ *  of every gate before the ones of its fan out segments
+ *
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  int     numGates        - total number of gates in the circuit
+ *  @return nothing
+ */
+void indexFaultsByGate( FAULT_LIST* faultList, int numGates )
+{
+    free(faultList->gateStart);
+    free(faultList->byGate);
+
+    // One allocation holds the gate and the branch starts
+    faultList->gateStart = (int32_t*) calloc(2 * (size_t) numGates + 1, sizeof(int32_t));
+    faultList->byGate    = (int32_t*) malloc((faultList->count > 0 ? faultList->count : 1) * sizeof(int32_t));
+    if(faultList->gateStart == NULL || faultList->byGate == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    faultList->branchStart = faultList->gateStart + numGates + 1;
+    faultList->numGates    = numGates;
+
+    // Count the main segment and the fan out segment faults of every gate
+    FAULT* fault;
+    int K;
+    for(K = 0; K < faultList->count; K++)
+    {
+        fault = &faultList->faults[K];
+        faultList->gateStart[fault->index + 1]++;
+        if(fault->indexOut < 0) faultList->branchStart[fault->index]++;
+    }
+    for(K = 0; K < numGates; K++)
+    {
+        faultList->gateStart[K + 1] += faultList->gateStart[K];
+        faultList->branchStart[K]   += faultList->gateStart[K];
+    }
+
+    // Place the faults, keeping their order within the two groups of a gate
+    int32_t* next = (int32_t*) malloc(2 * (size_t) (numGates > 0 ? numGates : 1) * sizeof(int32_t));
+    if(next == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    memcpy(next, faultList->gateStart, numGates * sizeof(int32_t));
+    memcpy(next + numGates, faultList->branchStart, numGates * sizeof(int32_t));
+    for(K = 0; K < faultList->count; K++)
+    {
+        fault = &faultList->faults[K];
+        if(fault->indexOut < 0)
+            faultList->byGate[next[fault->index]++] = K;
+        else
+            faultList->byGate[next[numGates + fault->index]++] = K;
+    }
+    free(next);
+}
+
+/*
+ *  Counts the faults of a fault list having a status
+ *
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  FAULT_STATUS status     - the status
+ *  @return int - the number of faults with the status
+ */
+int countFaults( FAULT_LIST* faultList, FAULT_STATUS status )
+{
+    int K, count = 0;
+    if(faultList->block == NULL) return 0;
+
+    for(K = 0; K < FAULT_STATUS_WORDS(faultList->count); K++)
+        count += __builtin_popcountll(faultList->status[status][K]);
+    return count;
+}
+
+/*
+ *  Computes the memory taken by the faults of a fault list, their statuses
+ *  and their index by gate
+ *
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @return size_t - the number of bytes allocated
+ */
+size_t getFaultListMemoryUsage( FAULT_LIST* faultList )
+{
+    if(faultList->block == NULL) return 0;
+
+    size_t bytes = MAX_FAULT_STATUS * FAULT_STATUS_WORDS((size_t) faultList->capacity) * sizeof(uint64_t) +
+                   faultList->capacity * sizeof(FAULT);
+    if(faultList->gateStart != NULL)
+        bytes += (2 * (size_t) faultList->numGates + 1 + faultList->count) * sizeof(int32_t);
+    return bytes;
+}
+
+/*
+ *  Key of an empty slot of the branches index
+ */
+#define BRANCH_INDEX_EMPTY  (~((uint64_t) 0))
+
+
+/*
+ *  Hashes a (stem, sink) key into a slot of an index with <mask> + 1 slots
+ */
+static inline uint32_t hashBranchKey( uint64_t key, uint32_t mask )
+{
+    return (uint32_t) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+/*
+ *  Indexes every fan out branch of the <circuit> by its (stem, sink) pair
+ *
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  int     numGates    - total number of gates in the circuit
+ *  @param  BRANCH_INDEX* index - an empty index to be populated
+ *  @return nothing
+ */
+void buildBranchIndex( CIRCUIT* circuit, int numGates, BRANCH_INDEX* index )
+{
+    int K, L, numBranches = 0, capacity = 16;
+    for(K = 0; K < numGates; K++)
+        numBranches += NUM_FANOUT(circuit, K);
+    while(capacity < 2 * numBranches) capacity *= 2;   // At most half full
+
+    index->keys  = (uint64_t*) malloc(capacity * sizeof(uint64_t));
+    index->slots = (int32_t*) malloc(capacity * sizeof(int32_t));
+    if(index->keys == NULL || index->slots == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    memset(index->keys, 0xFF, capacity * sizeof(uint64_t));
+    index->capacity = capacity;
+    index->count    = 0;
+
+    uint32_t mask = capacity - 1, M;
+    uint64_t key;
+    for(K = 0; K < numGates; K++)
+        for(L = 0; L < NUM_FANOUT(circuit, K); L++)
+        {
+            key = ((uint64_t) K << 32) | (uint32_t) FANOUT(circuit, K, L);
+
+            // A sink driven twice by the same stem keeps its first position
+            for(M = hashBranchKey(key, mask); index->keys[M] != BRANCH_INDEX_EMPTY; M = (M + 1) & mask)
+                if(index->keys[M] == key) break;
+            if(index->keys[M] == key) continue;
+
+            index->keys[M]  = key;
+            index->slots[M] = L;
+            index->count++;
+        }
+}
+
+/*
+ *  Finds the position of <sink> in the fan out list of <stem>
+ *
+ *  @param  BRANCH_INDEX* index - the branches index
+ *  @param  int     stem        - the gate driving the branch
+ *  @param  int     sink        - the gate driven by the branch
+ *  @return int - the first position of <sink> in the out[] list of <stem>, -1 if
+ *                the two gates are not connected
+ */
+int findBranchSlot( BRANCH_INDEX* index, int stem, int sink )
+{
+    if(index->capacity == 0 || stem < 0 || sink < 0) return -1;
+
+    uint64_t key  = ((uint64_t) stem << 32) | (uint32_t) sink;
+    uint32_t mask = index->capacity - 1, M;
+
+    for(M = hashBranchKey(key, mask); index->keys[M] != BRANCH_INDEX_EMPTY; M = (M + 1) & mask)
+        if(index->keys[M] == key) return index->slots[M];
+
+    return -1;
+}
+
+/*
+ *  Releases the memory of a branches index and empties it
+ *
+ *  @param  BRANCH_INDEX* index - the branches index
+ *  @return nothing
+ */
+void releaseBranchIndex( BRANCH_INDEX* index )
+{
+    free(index->keys);
+    free(index->slots);
+    bzero(index, sizeof(BRANCH_INDEX));
+}
+
+/*
+ *  Reads the faults stored in <filename> by mapping the file into memory, or
+ *  by decompressing it for *.gz files. Text and binary fault lists are told
+ *  apart by their content.
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - an empty fault list to be populated
+ *  @param  char*   filename        - the filename storing the faults
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return BOOLEAN - TRUE if the file was read, FALSE otherwise
+ */
+BOOLEAN loadFaultList( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                       char* filename, uint64_t netlistHash )
+{
+    DATA_FILE file;
+    if(loadDataFile(&file, filename) == FALSE) return FALSE;
+
+    // An empty fault list is trivially parsed
+    if(file.size == 0)
+    {
+        faultList->count = 0;
+        return TRUE;
+    }
+
+    BOOLEAN status;
+    if(file.size >= sizeof(BINARY_FAULT_LIST_MAGIC) &&
+       memcmp(file.data, BINARY_FAULT_LIST_MAGIC, sizeof(BINARY_FAULT_LIST_MAGIC)) == 0)
+        status = parseBinaryFaultList(circuit, info, faultList, file.data, file.size, netlistHash);
+    else
+        status = parseFaultListBuffer(circuit, info, faultList, file.data, file.size);
+
+    releaseDataFile(&file);
+    return status;
+}
+
+/*
+ *  Returns TRUE for the blank characters separating fault list tokens
+ */
+static inline BOOLEAN isFaultListBlank( char c )
+{
+    return (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f');
+}
+
+/*
+ *  Returns the end of the gate name starting at <p>. Names end at a blank, at
+ *  a fault value or at the arrow of a fan out branch.
+ */
+static inline const char* scanFaultListName( const char* p, const char* end )
+{
+    while(p < end && !isFaultListBlank(*p) && *p != '/' &&
+          !(*p == '-' && p + 1 < end && p[1] == '>'))
+        p++;
+    return p;
+}
+
+/*
+ *  Reports a malformed line of a fault list and terminates the program
+ */
+static void reportMalformedFaultLine( const char* start, const char* end, int lineNumber,
+                                      const char* reason )
+{
+    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+    int len = (int) (end - start);
+    if(len > 64) len = 64;
+    sprintf(ERROR_MESSAGE, "%s in fault list line %d: \"%.*s\"", reason, lineNumber, len, start);
+    errno = ERROR_PARSING_FAULT_LIST;
+    exit(1);
+}
+
+/*
+ *  Parses a fault list held in memory in the ISCAS89 format:
+ *      <gate name> [/0] [/1]                       (stem faults)
+ *      <stem gate name> -> <sink gate name> [/0] [/1]  (fan out branch faults)
+ *  Gate names are resolved in place through the gate names table and all the
+ *  faults are allocated in a single block. Branches that do not exist in the
+ *  circuit are ignored.
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - an empty fault list to be populated
+ *  @param  const char* data        - the fault list's text
+ *  @param  size_t  size            - number of characters in <data>
+ *  @return BOOLEAN - TRUE if the faults were parsed, FALSE otherwise
+ */
+BOOLEAN parseFaultListBuffer( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                              const char* data, size_t size )
+{
+    const char* end = data + size;
+    const char *p, *eol, *q, *stop, *name, *sinkName = NULL;
+    int nameLen, sinkLen = 0, stem, sink, values, lineNumber = 0, K;
+    BOOLEAN isBranch;
+    FAULT_TYPE types[2];
+
+    // Every fault value starts with a '/', so their number bounds the faults
+    int capacity = 0;
+    for(p = data; (p = (const char*) memchr(p, '/', end - p)) != NULL; p++)
+        capacity++;
+
+    allocateFaultList(faultList, capacity);
+
+    BRANCH_INDEX branches;
+    bzero(&branches, sizeof(BRANCH_INDEX));
+
+    for(p = data; p < end; p = eol + 1)
+    {
+        eol = (const char*) memchr(p, '\n', end - p);
+        if(eol == NULL) eol = end;
+        lineNumber++;
+
+        // Drop comments and surrounding blanks
+        stop = (const char*) memchr(p, '#', eol - p);
+        if(stop == NULL) stop = eol;
+        while(p < stop && isFaultListBlank(*p)) p++;
+        while(stop > p && isFaultListBlank(stop[-1])) stop--;
+        if(p == stop) continue;
+
+        // Gate names
+        name = p;
+        q = scanFaultListName(p, stop);
+        nameLen = q - name;
+        while(q < stop && isFaultListBlank(*q)) q++;
+
+        isBranch = (q + 1 < stop && q[0] == '-' && q[1] == '>');
+        if(isBranch)
+        {
+            q += 2;
+            while(q < stop && isFaultListBlank(*q)) q++;
+            sinkName = q;
+            q = scanFaultListName(q, stop);
+            sinkLen = q - sinkName;
+            while(q < stop && isFaultListBlank(*q)) q++;
+        }
+        if(nameLen == 0 || (isBranch && sinkLen == 0))
+            reportMalformedFaultLine(p, stop, lineNumber, "Missing gate name");
+
+        // Stuck-at values
+        for(values = 0; q < stop; values++)
+        {
+            if(*q != '/' || q + 1 == stop || (q[1] != '0' && q[1] != '1') || values == 2 ||
+               (q + 2 < stop && !isFaultListBlank(q[2]) && q[2] != '/'))
+                reportMalformedFaultLine(p, stop, lineNumber, "Invalid stuck-at value");
+
+            types[values] = (q[1] == '0') ? ST_0 : ST_1;
+            q += 2;
+            while(q < stop && isFaultListBlank(*q)) q++;
+        }
+        if(values == 0)
+            reportMalformedFaultLine(p, stop, lineNumber, "Missing stuck-at value");
+
+        // Resolve the gates
+        stem = findSymbol(&circuit->names, name, nameLen, hashSymbol(name, nameLen));
+        if(stem < 0 || stem >= info->numGates)
+            reportMalformedFaultLine(p, stop, lineNumber, "Unknown gate");
+
+        sink = -1;
+        if(isBranch)
+        {
+            sink = findSymbol(&circuit->names, sinkName, sinkLen, hashSymbol(sinkName, sinkLen));
+            if(sink < 0 || sink >= info->numGates)
+                reportMalformedFaultLine(p, stop, lineNumber, "Unknown gate");
+
+            if(branches.capacity == 0) buildBranchIndex(circuit, info->numGates, &branches);
+            if(findBranchSlot(&branches, stem, sink) < 0) continue;
+        }
+
+        // Add the faults
+        for(K = 0; K < values; K++)
+            appendFault(faultList, stem, sink, types[K]);
+    }
+
+    releaseBranchIndex(&branches);
+    return TRUE;
+}
+
+/*
+ *  Reports an invalid binary fault list and terminates the program
+ */
+static void reportInvalidBinaryFaultList( const char* reason )
+{
+    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+    sprintf(ERROR_MESSAGE, "Invalid binary fault list: %s", reason);
+    errno = ERROR_PARSING_FAULT_LIST;
+    exit(1);
+}
+
+/*
+ *  Reads the faults of a binary fault list held in memory. The list is
+ *  rejected if it was saved for a different netlist.
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - an empty fault list to be populated
+ *  @param  const char* data        - the binary fault list
+ *  @param  size_t  size            - number of bytes in <data>
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return BOOLEAN - TRUE if the faults were read, FALSE otherwise
+ */
+BOOLEAN parseBinaryFaultList( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                              const char* data, size_t size, uint64_t netlistHash )
+{
+    BINARY_FAULT_LIST_HEADER header;
+    if(size < sizeof(header)) reportInvalidBinaryFaultList("truncated header");
+    memcpy(&header, data, sizeof(header));
+
+    if(memcmp(header.magic, BINARY_FAULT_LIST_MAGIC, sizeof(BINARY_FAULT_LIST_MAGIC)) != 0 ||
+       header.version != BINARY_FAULT_LIST_VERSION || header.byteOrder != BINARY_FAULT_LIST_BYTE_ORDER)
+        reportInvalidBinaryFaultList("unsupported version or byte order");
+    if(header.netlistHash != netlistHash || header.numGates != info->numGates)
+        reportInvalidBinaryFaultList("saved for a different netlist");
+    if(header.count < 0 ||
+       size != sizeof(header) + (size_t) header.count * sizeof(BINARY_FAULT_RECORD))
+        reportInvalidBinaryFaultList("wrong number of fault records");
+
+    allocateFaultList(faultList, header.count);
+
+    const BINARY_FAULT_RECORD* records = (const BINARY_FAULT_RECORD*) (data + sizeof(header));
+    int K;
+    for(K = 0; K < header.count; K++)
+    {
+        if(records[K].gate < 0 || records[K].gate >= info->numGates ||
+           records[K].branch < -1 || records[K].branch >= (int) NUM_FANOUT(circuit, records[K].gate) ||
+           records[K].type > ST_1)
+            reportInvalidBinaryFaultList("fault record out of range");
+
+        appendFault(faultList, records[K].gate,
+                    (records[K].branch < 0) ? -1 : FANOUT(circuit, records[K].gate, records[K].branch),
+                    (FAULT_TYPE) records[K].type);
+        if(records[K].detected) SET_FAULT_STATUS(faultList, K, FAULT_DETECTED);
+    }
+
+    return TRUE;
+}
+
+/*
+ *  Checks if <filename> names a binary fault list
+ *
+ *  @param  char*   filename - the fault list's filename
+ *  @return BOOLEAN - TRUE if the filename has the binary fault list extension,
+ *                    compressed or not
+ */
+BOOLEAN isBinaryFaultListFilename( char* filename )
+{
+    size_t len = strlen(filename), extLen = strlen(BINARY_FAULT_FILE_EXTENSION);
+
+    // The extension is looked for before the compressed file extension
+    if(isCompressedFilename(filename)) len -= strlen(COMPRESSED_FILE_EXTENSION);
+    return (len >= extLen && strncmp(filename + len - extLen, BINARY_FAULT_FILE_EXTENSION, extLen) == 0);
+}
+
+/*
+ *  Saves the faults of a fault list in the ISCAS89 text format
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  char*   filename        - the fault list's filename
+ *  @param  BOOLEAN isUndetectedOnly - TRUE to save the undetected faults only
+ *  @return BOOLEAN - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN saveFaultList( CIRCUIT* circuit, FAULT_LIST* faultList, char* filename,
+                       BOOLEAN isUndetectedOnly )
+{
+    FILE* fp = openDataFile(filename, "w");
+    if(fp == NULL) return FALSE;
+
+    FAULT* fault;
+    int K;
+    for(K = 0; K < faultList->count; K++)
+    {
+        fault = &faultList->faults[K];
+        if(isUndetectedOnly && IS_DETECTED(faultList, K)) continue;
+
+        if(fault->indexOut < 0)
+            fprintf(fp, "%s /%c\n", GATE_NAME(circuit, fault->index),
+                        (fault->type == ST_1 ? '1':'0'));
+        else
+            fprintf(fp, "%s->%s /%c\n", GATE_NAME(circuit, fault->index),
+                GATE_NAME(circuit, fault->indexOut),
+                (fault->type == ST_1 ? '1':'0'));
+    }
+
+    return (fclose(fp) == 0);
+}
+
+/*
+ *  Saves the faults of a fault list in the binary format, referring to the
+ *  gates by their ids
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  char*   filename        - the fault list's filename
+ *  @param  BOOLEAN isUndetectedOnly - TRUE to save the undetected faults only
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return BOOLEAN - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN saveBinaryFaultList( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                             char* filename, BOOLEAN isUndetectedOnly, uint64_t netlistHash )
+{
+    BINARY_FAULT_LIST_HEADER header;
+    bzero(&header, sizeof(header));
+    memcpy(header.magic, BINARY_FAULT_LIST_MAGIC, sizeof(BINARY_FAULT_LIST_MAGIC));
+    header.version     = BINARY_FAULT_LIST_VERSION;
+    header.byteOrder   = BINARY_FAULT_LIST_BYTE_ORDER;
+    header.netlistHash = netlistHash;
+    header.numGates    = info->numGates;
+
+    BINARY_FAULT_RECORD* records = (BINARY_FAULT_RECORD*)
+        malloc((faultList->count > 0 ? faultList->count : 1) * sizeof(BINARY_FAULT_RECORD));
+    if(records == NULL) return FALSE;
+
+    BRANCH_INDEX branches;
+    bzero(&branches, sizeof(BRANCH_INDEX));
+
+    BOOLEAN status = TRUE;
+    FAULT* fault;
+    int K, slot;
+    for(K = 0; K < faultList->count && status == TRUE; K++)
+    {
+        fault = &faultList->faults[K];
+        if(isUndetectedOnly && IS_DETECTED(faultList, K)) continue;
+
+        slot = -1;
+        if(fault->indexOut >= 0)
+        {
+            if(branches.capacity == 0) buildBranchIndex(circuit, info->numGates, &branches);
+            slot = findBranchSlot(&branches, fault->index, fault->indexOut);
+            if(slot < 0 || slot > INT16_MAX) status = FALSE;
+        }
+
+        records[header.count].gate     = fault->index;
+        records[header.count].branch   = (int16_t) slot;
+        records[header.count].type     = (uint8_t) fault->type;
+        records[header.count].detected = (uint8_t) IS_DETECTED(faultList, K);
+        header.count++;
+    }
+    releaseBranchIndex(&branches);
+
+    FILE* fp = (status == TRUE) ? openDataFile(filename, "wb") : NULL;
+    if(fp != NULL)
+    {
+        status = (fwrite(&header, sizeof(header), 1, fp) == 1 &&
+                  fwrite(records, sizeof(BINARY_FAULT_RECORD), header.count, fp) == (size_t) header.count);
+        if(fclose(fp) != 0) status = FALSE;
+    }
+    else status = FALSE;
+
+    free(records);
+    return status;
+}
+
+/*
+ *  Releases the faults of a fault list and empties it
+ *
+ *  @param  FAULT_LIST* faultList - the fault list
+ *  @return nothing
+ */
+void clearFaultList( FAULT_LIST* faultList )
+{
+    free(faultList->block);
+    free(faultList->gateStart);
+    free(faultList->byGate);
+    bzero(faultList, sizeof(FAULT_LIST));
+}
@@ -0,0 +1,235 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  fault_list.h
+ *
+ *    Description:  Fault list database and fault list files loader
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef FAULT_LIST_H
+#define FAULT_LIST_H
+
+
+/*
+ *  Binary fault list file identification
+ */
+#define BINARY_FAULT_LIST_MAGIC         "ATPGBFL"
+#define BINARY_FAULT_LIST_VERSION       1
+#define BINARY_FAULT_LIST_BYTE_ORDER    0x01020304
+
+/*
+ *  Header of a binary fault list file, followed by <count> fault records
+ */
+typedef struct
+{
+    char     magic[8];          // BINARY_FAULT_LIST_MAGIC
+    uint32_t version;           // BINARY_FAULT_LIST_VERSION
+    uint32_t byteOrder;         // BINARY_FAULT_LIST_BYTE_ORDER as written
+    uint64_t netlistHash;       // Hash of the .bench file the gate ids refer to
+    int32_t  numGates;          // Number of gates of the netlist
+    int32_t  count;             // Number of fault records
+} BINARY_FAULT_LIST_HEADER;
+
+/*
+ *  A fault record of a binary fault list
+ */
+typedef struct
+{
+    int32_t gate;       // Id of the faulty gate (the stem of a fan out branch)
+    int16_t branch;     // Position of the branch in the stem's out[] list, -1 for the stem
+    uint8_t type;       // FAULT_TYPE
+    uint8_t detected;   // 1 -> the fault was detected
+} BINARY_FAULT_RECORD;
+
+
+/*
+ *  Allocates the faults of an empty fault list and their statuses in a single
+ *  block, all the faults being undetected
+ *
+ *  @param  FAULT_LIST* faultList   - an empty fault list
+ *  @param  int     capacity        - the number of faults the list must hold
+ *  @return nothing
+ */
+void allocateFaultList( FAULT_LIST* faultList, int capacity );
+
+/*
+ *  Appends a fault to a fault list
+ *
+ *  @param  FAULT_LIST* faultList   - an allocated fault list
+ *  @param  int     index           - the faulty gate (the stem of a fan out branch)
+ *  @param  int     indexOut        - the gate driven by the faulty fan out branch,
+ *                                    -1 for the main segment
+ *  @param  FAULT_TYPE type         - the stuck-at value
+ *  @return int - the position of the fault in the fault list
+ */
+int appendFault( FAULT_LIST* faultList, int index, int indexOut, FAULT_TYPE type );
+
+/*
+ *  Indexes the faults of a fault list by gate, the faults of the main segment
+ *  of every gate before the ones of its fan out segments
+ *
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  int     numGates        - total number of gates in the circuit
+ *  @return nothing
+ */
+void indexFaultsByGate( FAULT_LIST* faultList, int numGates );
+
+/*
+ *  Counts the faults of a fault list having a status
+ *
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  FAULT_STATUS status     - the status
+ *  @return int - the number of faults with the status
+ */
+int countFaults( FAULT_LIST* faultList, FAULT_STATUS status );
+
+/*
+ *  Computes the memory taken by the faults of a fault list, their statuses
+ *  and their index by gate
+ *
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @return size_t - the number of bytes allocated
+ */
+size_t getFaultListMemoryUsage( FAULT_LIST* faultList );
+
+/*
+ *  Indexes every fan out branch of the <circuit> by its (stem, sink) pair
+ *
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  int     numGates    - total number of gates in the circuit
+ *  @param  BRANCH_INDEX* index - an empty index to be populated
+ *  @return nothing
+ */
+void buildBranchIndex( CIRCUIT* circuit, int numGates, BRANCH_INDEX* index );
+
+/*
+ *  Finds the position of <sink> in the fan out list of <stem>
+ *
+ *  @param  BRANCH_INDEX* index - the branches index
+ *  @param  int     stem        - the gate driving the branch
+ *  @param  int     sink        - the gate driven by the branch
+ *  @return int - the first position of <sink> in the out[] list of <stem>, -1 if
+ *                the two gates are not connected
+ */
+int findBranchSlot( BRANCH_INDEX* index, int stem, int sink );
+
+/*
+ *  Releases the memory of a branches index and empties it
+ *
+ *  @param  BRANCH_INDEX* index - the branches index
+ *  @return nothing
+ */
+void releaseBranchIndex( BRANCH_INDEX* index );
+
+/*
+ *  Reads the faults stored in <filename> by mapping the file into memory, or
+ *  by decompressing it for *.gz files. Text and binary fault lists are told
+ *  apart by their content.
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - an empty fault list to be populated
+ *  @param  char*   filename        - the filename storing the faults
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return BOOLEAN - TRUE if the file was read, FALSE otherwise
+ */
+BOOLEAN loadFaultList( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                       char* filename, uint64_t netlistHash );
+
+/*
+ *  Parses a fault list held in memory in the ISCAS89 format:
+ *      <gate name> [/0] [/1]                       (stem faults)
+ *      <stem gate name> -> <sink gate name> [/0] [/1]  (fan out branch faults)
+ *  Gate names are resolved in place through the gate names table and all the
+ *  faults are allocated in a single block. Branches that do not exist in the
+ *  circuit are ignored.
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - an empty fault list to be populated
+ *  @param  const char* data        - the fault list's text
+ *  @param  size_t  size            - number of characters in <data>
+ *  @return BOOLEAN - TRUE if the faults were parsed, FALSE otherwise
+ */
+BOOLEAN parseFaultListBuffer( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                              const char* data, size_t size );
+
+/*
+ *  Reads the faults of a binary fault list held in memory. The list is
+ *  rejected if it was saved for a different netlist.
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - an empty fault list to be populated
+ *  @param  const char* data        - the binary fault list
+ *  @param  size_t  size            - number of bytes in <data>
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return BOOLEAN - TRUE if the faults were read, FALSE otherwise
+ */
+BOOLEAN parseBinaryFaultList( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                              const char* data, size_t size, uint64_t netlistHash );
+
+/*
+ *  Checks if <filename> names a binary fault list
+ *
+ *  @param  char*   filename - the fault list's filename
+ *  @return BOOLEAN - TRUE if the filename has the binary fault list extension,
+ *                    compressed or not
+ */
+BOOLEAN isBinaryFaultListFilename( char* filename );
+
+/*
+ *  Saves the faults of a fault list in the ISCAS89 text format
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  char*   filename        - the fault list's filename
+ *  @param  BOOLEAN isUndetectedOnly - TRUE to save the undetected faults only
+ *  @return BOOLEAN - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN saveFaultList( CIRCUIT* circuit, FAULT_LIST* faultList, char* filename,
+                       BOOLEAN isUndetectedOnly );
+
+/*
+ *  Saves the faults of a fault list in the binary format, referring to the
+ *  gates by their ids
+ *
+ *  @param  CIRCUIT* circuit        - the circuit the faults belong to
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  char*   filename        - the fault list's filename
+ *  @param  BOOLEAN isUndetectedOnly - TRUE to save the undetected faults only
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return BOOLEAN - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN saveBinaryFaultList( CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST* faultList,
+                             char* filename, BOOLEAN isUndetectedOnly, uint64_t netlistHash );
+
+/*
+ *  Releases the faults of a fault list and empties it
+ *
+ *  @param  FAULT_LIST* faultList - the fault list
+ *  @return nothing
+ */
+void clearFaultList( FAULT_LIST* faultList );
+
+#endif
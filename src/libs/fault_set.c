@@ -0,0 +1,321 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  fault_set.c
+ *
+ *    Description:  The faults tracked by the fault simulators keeping a fault
+ *                  list per gate: the simulated, excited and detected faults
+ *                  of a test vector, and the merging of the gates' lists
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* realloc, qsort, free, exit */
+#include <stdlib.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+#include "fault_set.h"
+#include "test_cube.h"
+#include "test_generator.h"
+
+
+/*
+ *  Resizes an array of a fault simulator, quitting when memory runs out
+ *
+ *  @param  void*   items   - the array
+ *  @param  size_t  count   - the number of items it must hold
+ *  @param  size_t  size    - the size of one item
+ *  @return void* - the resized array
+ */
+void* growFaultArray( void* items, size_t count, size_t size )
+{
+    items = realloc(items, (count > 0 ? count : 1) * size);
+    if(items == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    return items;
+}
+
+/*
+ *  Makes room for a number of fault list entries, at least doubling the room
+ *  when it grows
+ *
+ *  @param  int32_t** ids       - the faults of the entries
+ *  @param  uint8_t** values    - the values of the entries
+ *  @param  size_t* capacity    - the entries the arrays hold
+ *  @param  size_t  count       - the entries the arrays must hold
+ *  @return nothing
+ */
+void reserveEntries( int32_t** ids, uint8_t** values, size_t* capacity, size_t count )
+{
+    if(count <= *capacity) return;
+    if(count < 2 * *capacity) count = 2 * *capacity;
+    *ids      = (int32_t*) growFaultArray(*ids, count, sizeof(int32_t));
+    *values   = (uint8_t*) growFaultArray(*values, count, sizeof(uint8_t));
+    *capacity = count;
+}
+
+/*
+ *  Compares two fault positions
+ *
+ *  @param  const void* left    - the left position
+ *  @param  const void* right   - the right position
+ *  @return int - negative, 0 or positive as the left one is lower, equal or higher
+ */
+int cmpFaultIds( const void* left, const void* right )
+{
+    int32_t l = *(const int32_t*) left, r = *(const int32_t*) right;
+    return (l > r) - (l < r);
+}
+
+/*
+ *  Starts a test vector, sizing the set for the fault list and the output gates
+ *  first. Growing the set leaves every fault inactive.
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @return BOOLEAN TRUE if the set grew and FALSE otherwise
+ */
+BOOLEAN startFaultSet( FAULT_SET* set, CIRCUIT_INFO* info, FAULT_LIST* fList )
+{
+    BOOLEAN isGrown = FALSE;
+
+    if(info->numPO > set->numOutputs)
+    {
+        set->outputs    = growFaultArray(set->outputs, info->numPO, sizeof(FAULT_PIN));
+        set->numOutputs = info->numPO;
+    }
+    if(fList->count > set->numFaults)
+    {
+        set->own            = growFaultArray(set->own, fList->count, sizeof(int32_t));
+        set->excited        = growFaultArray(set->excited, fList->count, sizeof(int32_t));
+        set->detected       = growFaultArray(set->detected, fList->count, sizeof(int32_t));
+        set->unknownOutputs = growFaultArray(set->unknownOutputs, fList->count, sizeof(int32_t));
+        set->faultStamp     = growFaultArray(set->faultStamp, fList->count, sizeof(uint32_t));
+        set->active         = growFaultArray(set->active, FAULT_STATUS_WORDS(fList->count), sizeof(uint64_t));
+        bzero(set->faultStamp, fList->count * sizeof(uint32_t));
+        bzero(set->active, FAULT_STATUS_WORDS(fList->count) * sizeof(uint64_t));
+        set->numFaults = fList->count;
+        set->stamp = 0;
+        isGrown = TRUE;
+    }
+    if(++set->stamp == 0)
+    {
+        bzero(set->faultStamp, set->numFaults * sizeof(uint32_t));
+        set->stamp = 1;
+    }
+    return isGrown;
+}
+
+/*
+ *  Simulates the faults of a part of the fault list not detected yet, and no
+ *  other fault
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @param  int     first       - the first position of the part
+ *  @param  int     last        - the position past the part
+ *  @return BOOLEAN TRUE if every fault was simulated before and FALSE otherwise
+ */
+BOOLEAN activateFaults( FAULT_SET* set, FAULT_LIST* fList, int first, int last )
+{
+    uint64_t word;
+    BOOLEAN isSubset = TRUE;
+    int W, low;
+
+    for(W = 0; W < FAULT_STATUS_WORDS(fList->count); W++)
+    {
+        low  = W * 64;
+        word = ~fList->status[FAULT_DETECTED][W];
+        if(low + 64 <= first || low >= last) word = 0;
+        else
+        {
+            if(first > low) word &= ~(uint64_t) 0 << (first - low);
+            if(last < low + 64) word &= ((uint64_t) 1 << (last - low)) - 1;
+        }
+        if(word & ~set->active[W]) isSubset = FALSE;
+        set->active[W] = word;
+    }
+    return isSubset;
+}
+
+/*
+ *  Merges the excited faults of the fan out branch from <stem> to a gate into
+ *  the fault list of the stem, read by an input of the gate. The merged list
+ *  is kept in the set's branch lists, which must have room for it.
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate
+ *  @param  int     gate        - the gate
+ *  @param  int     stem        - the gate driving the input
+ *  @param  LOGIC_VALUE good    - the stem's fault-free value
+ *  @param  FAULT_PIN* pin      - the stem's fault list, given the merged one
+ *  @param  size_t* branchSize  - entries used in the branch lists of the gate
+ *  @return nothing
+ */
+void readBranchFaults( FAULT_SET* set, CIRCUIT* circuit, FAULT_LIST* fList, int gate, int stem,
+                       LOGIC_VALUE good, FAULT_PIN* pin, size_t* branchSize )
+{
+    int32_t* ids = set->branchIds + *branchSize;
+    uint8_t* values = set->branchValues + *branchSize;
+    LOGIC_VALUE value;
+    BOOLEAN hasBranchFaults = FALSE;
+    int K, N = 0, count = 0, id;
+
+    if(NUM_FANOUT(circuit, stem) < 2) return;
+
+    for(K = fList->branchStart[stem]; K < fList->gateStart[stem + 1]; K++)
+    {
+        id = fList->byGate[K];
+        if(fList->faults[id].indexOut != gate || isActiveFault(set, id) == FALSE) continue;
+        value = exciteValue(fList->faults[id].type, good);
+        if(value == X) continue;
+
+        while(N < pin->count && pin->ids[N] < id)
+        {
+            ids[count] = pin->ids[N];
+            values[count++] = pin->values[N++];
+        }
+        ids[count] = id;
+        values[count++] = value;
+        hasBranchFaults = TRUE;
+    }
+    if(hasBranchFaults == FALSE) return;
+
+    for(; N < pin->count; N++)
+    {
+        ids[count] = pin->ids[N];
+        values[count++] = pin->values[N];
+    }
+    pin->ids    = ids;
+    pin->values = values;
+    pin->count  = count;
+    *branchSize += count;
+}
+
+/*
+ *  Adds a fault to the ones detected by the test vector, once
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  int     id          - the fault
+ *  @return nothing
+ */
+static void markDetectedFault( FAULT_SET* set, int id )
+{
+    if(set->faultStamp[id] == set->stamp) return;
+    set->faultStamp[id] = set->stamp;
+    set->detected[set->numDetected++] = id;
+}
+
+/*
+ *  Drops the active faults listed as D or B at an output gate. Where the
+ *  fault-free outputs contradict the expected ones, the serial fault simulator
+ *  also detects every excited fault leaving one of those outputs 0 or 1. The
+ *  faults are reported in the order the serial fault simulator does.
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector, holding the lists
+ *                                of the output gates
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @param  TEST_VECTOR* tv     - test vector object
+ *  @param  const uint8_t* good - the fault-free value of every gate
+ *  @param  int     first       - the first position of the faults simulated
+ *  @param  int     last        - the position past the faults simulated
+ *  @return nothing
+ */
+void dropDetectedFaults( FAULT_SET* set, CIRCUIT_INFO* info, FAULT_LIST* fList, TEST_VECTOR* tv,
+                         const uint8_t* good, int first, int last )
+{
+    FAULT_PIN* list;
+    LOGIC_VALUE value, expected;
+    int K, E, numConflicts = 0;
+
+    set->numDetected = 0;
+    for(K = 0; K < info->numPO; K++)
+    {
+        list = &set->outputs[K];
+        for(E = 0; E < list->count; E++)
+            if((list->values[E] == D || list->values[E] == B) && isActiveFault(set, list->ids[E]) == TRUE)
+                markDetectedFault(set, list->ids[E]);
+    }
+
+    // Count the contradicted outputs every excited fault leaves unknown
+    for(K = 0; K < info->numPO; K++)
+    {
+        value = good[info->outputs[K]];
+        expected = CUBE_VALUE(&tv->output, K);
+        if((value == I && expected == O) || (value == O && expected == I)) numConflicts++;
+    }
+    if(numConflicts > 0)
+    {
+        set->numExcited = 0;
+        for(K = first; K < last; K++)
+            if(isActiveFault(set, K) == TRUE && exciteValue(fList->faults[K].type, good[fList->faults[K].index]) != X)
+            {
+                set->excited[set->numExcited++] = K;
+                set->unknownOutputs[K] = 0;
+            }
+        for(K = 0; K < info->numPO; K++)
+        {
+            value = good[info->outputs[K]];
+            expected = CUBE_VALUE(&tv->output, K);
+            if((value != I || expected != O) && (value != O || expected != I)) continue;
+
+            list = &set->outputs[K];
+            for(E = 0; E < list->count; E++)
+                if(list->values[E] == X && isActiveFault(set, list->ids[E]) == TRUE)
+                    set->unknownOutputs[list->ids[E]]++;
+        }
+        for(K = 0; K < set->numExcited; K++)
+            if(set->unknownOutputs[set->excited[K]] < numConflicts) markDetectedFault(set, set->excited[K]);
+    }
+
+    // Report the faults and leave them out of the simulation from now on
+    qsort(set->detected, set->numDetected, sizeof(int32_t), cmpFaultIds);
+    for(K = 0; K < set->numDetected; K++)
+    {
+        addTestVectorFault(tv, set->detected[K]);
+        SET_FAULT_STATUS(fList, set->detected[K], FAULT_DETECTED);
+        set->active[set->detected[K] >> 6] &= ~((uint64_t) 1 << (set->detected[K] & 63));
+    }
+}
+
+/*
+ *  Frees the memory of the set
+ *
+ *  @param  FAULT_SET* set      - the set
+ *  @return nothing
+ */
+void releaseFaultSet( FAULT_SET* set )
+{
+    free(set->active);
+    free(set->own);
+    free(set->excited);
+    free(set->detected);
+    free(set->unknownOutputs);
+    free(set->faultStamp);
+    free(set->branchIds);
+    free(set->branchValues);
+    free(set->outputs);
+    bzero(set, sizeof(FAULT_SET));
+}
@@ -0,0 +1,222 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  fault_set.h
+ *
+ *    Description:  The faults tracked by the fault simulators keeping a fault
+ *                  list per gate: the simulated, excited and detected faults
+ *                  of a test vector, and the merging of the gates' lists
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef FAULT_SET_H
+#define FAULT_SET_H
+
+
+/*
+ *  The fault list of a gate read in order, such as the list of an input of the
+ *  gate being evaluated. Every listed fault gives the gate another value than
+ *  in the fault-free circuit: D or B, or X where it leaves the gate unknown.
+ */
+typedef struct
+{
+    const int32_t* ids;         // Positions of the faults in the fault list, ascending
+    const uint8_t* values;      // The gate's value with every fault
+    int        count;
+    int        next;            // The first fault not merged yet
+    BOOLEAN    isBinary;        // TRUE if every value is D or B
+} FAULT_PIN;
+
+/*
+ *  The faults of a test vector. Only the active faults are simulated; the
+ *  ones detected at the output gates are reported once and made inactive.
+ */
+typedef struct
+{
+    int        numFaults;       // Number of faults the arrays can hold
+    uint64_t*  active;          // 1 bit per fault simulated
+
+    int32_t*   own;             // The faults of a gate excited by the test vector
+    int32_t*   excited;         // Every active fault excited by the test vector
+    int        numExcited;
+    int32_t*   detected;        // Faults detected by the test vector
+    int        numDetected;
+    int32_t*   unknownOutputs;  // Contradicted output gates every fault leaves unknown
+    uint32_t*  faultStamp;      // Test vector that detected every fault
+    uint32_t   stamp;           // The current test vector, never 0
+
+    int32_t*   branchIds;       // Fault lists of the fan out branches feeding a gate
+    uint8_t*   branchValues;
+    size_t     branchCapacity;
+
+    FAULT_PIN* outputs;         // The fault lists of the output gates
+    int        numOutputs;      // Number of output gates <outputs> can hold
+} FAULT_SET;
+
+
+/*
+ *  Gives the value of a gate with a stuck-at fault, as exciteFault does
+ *
+ *  @param  FAULT_TYPE type     - the stuck-at value
+ *  @param  LOGIC_VALUE good    - the gate's value in the fault-free circuit
+ *  @return LOGIC_VALUE D or B if the fault is excited and X otherwise
+ */
+static inline LOGIC_VALUE exciteValue( FAULT_TYPE type, LOGIC_VALUE good )
+{
+    if(type == ST_0 && good == I) return D;
+    if(type == ST_1 && good == O) return B;
+    return X;
+}
+
+/*
+ *  Tells whether a fault is simulated
+ *
+ *  @param  const FAULT_SET* set - the faults of the test vector
+ *  @param  int     id          - the position of the fault
+ *  @return BOOLEAN TRUE if the fault is simulated and FALSE otherwise
+ */
+static inline BOOLEAN isActiveFault( const FAULT_SET* set, int id )
+{
+    return ((set->active[id >> 6] >> (id & 63)) & 1) ? TRUE : FALSE;
+}
+
+/*
+ *  Gives the lowest active fault not merged yet among the fault lists of the
+ *  inputs of a gate, skipping the faults dropped since the lists were made
+ *
+ *  @param  const FAULT_SET* set - the faults of the test vector
+ *  @param  FAULT_PIN* pins     - the inputs' fault lists
+ *  @param  int     numIn       - the number of inputs
+ *  @return int - the fault, -1 once every list is merged
+ */
+static inline int nextFault( const FAULT_SET* set, FAULT_PIN* pins, int numIn )
+{
+    FAULT_PIN* pin;
+    int K, id = -1;
+    for(K = 0; K < numIn; K++)
+    {
+        pin = &pins[K];
+        while(pin->next < pin->count && isActiveFault(set, pin->ids[pin->next]) == FALSE) pin->next++;
+        if(pin->next < pin->count && (id < 0 || pin->ids[pin->next] < id)) id = pin->ids[pin->next];
+    }
+    return id;
+}
+
+/*
+ *  Resizes an array of a fault simulator, quitting when memory runs out
+ *
+ *  @param  void*   items   - the array
+ *  @param  size_t  count   - the number of items it must hold
+ *  @param  size_t  size    - the size of one item
+ *  @return void* - the resized array
+ */
+void* growFaultArray( void* items, size_t count, size_t size );
+
+/*
+ *  Makes room for a number of fault list entries, at least doubling the room
+ *  when it grows
+ *
+ *  @param  int32_t** ids       - the faults of the entries
+ *  @param  uint8_t** values    - the values of the entries
+ *  @param  size_t* capacity    - the entries the arrays hold
+ *  @param  size_t  count       - the entries the arrays must hold
+ *  @return nothing
+ */
+void reserveEntries( int32_t** ids, uint8_t** values, size_t* capacity, size_t count );
+
+/*
+ *  Compares two fault positions
+ *
+ *  @param  const void* left    - the left position
+ *  @param  const void* right   - the right position
+ *  @return int - negative, 0 or positive as the left one is lower, equal or higher
+ */
+int cmpFaultIds( const void* left, const void* right );
+
+/*
+ *  Starts a test vector, sizing the set for the fault list and the output gates
+ *  first. Growing the set leaves every fault inactive.
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @return BOOLEAN TRUE if the set grew and FALSE otherwise
+ */
+BOOLEAN startFaultSet( FAULT_SET* set, CIRCUIT_INFO* info, FAULT_LIST* fList );
+
+/*
+ *  Simulates the faults of a part of the fault list not detected yet, and no
+ *  other fault
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @param  int     first       - the first position of the part
+ *  @param  int     last        - the position past the part
+ *  @return BOOLEAN TRUE if every fault was simulated before and FALSE otherwise
+ */
+BOOLEAN activateFaults( FAULT_SET* set, FAULT_LIST* fList, int first, int last );
+
+/*
+ *  Merges the excited faults of the fan out branch from <stem> to a gate into
+ *  the fault list of the stem, read by an input of the gate. The merged list
+ *  is kept in the set's branch lists, which must have room for it.
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  FAULT_LIST* fList   - fault list object, indexed by gate
+ *  @param  int     gate        - the gate
+ *  @param  int     stem        - the gate driving the input
+ *  @param  LOGIC_VALUE good    - the stem's fault-free value
+ *  @param  FAULT_PIN* pin      - the stem's fault list, given the merged one
+ *  @param  size_t* branchSize  - entries used in the branch lists of the gate
+ *  @return nothing
+ */
+void readBranchFaults( FAULT_SET* set, CIRCUIT* circuit, FAULT_LIST* fList, int gate, int stem,
+                       LOGIC_VALUE good, FAULT_PIN* pin, size_t* branchSize );
+
+/*
+ *  Drops the active faults listed as D or B at an output gate. Where the
+ *  fault-free outputs contradict the expected ones, the serial fault simulator
+ *  also detects every excited fault leaving one of those outputs 0 or 1. The
+ *  faults are reported in the order the serial fault simulator does.
+ *
+ *  @param  FAULT_SET* set      - the faults of the test vector, holding the lists
+ *                                of the output gates
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @param  TEST_VECTOR* tv     - test vector object
+ *  @param  const uint8_t* good - the fault-free value of every gate
+ *  @param  int     first       - the first position of the faults simulated
+ *  @param  int     last        - the position past the faults simulated
+ *  @return nothing
+ */
+void dropDetectedFaults( FAULT_SET* set, CIRCUIT_INFO* info, FAULT_LIST* fList, TEST_VECTOR* tv,
+                         const uint8_t* good, int first, int last );
+
+/*
+ *  Frees the memory of the set
+ *
+ *  @param  FAULT_SET* set      - the set
+ *  @return nothing
+ */
+void releaseFaultSet( FAULT_SET* set );
+
+#endif
@@ -24,129 +24,184 @@
 #include <stdio.h>
 #include <time.h>
 #include <sys/queue.h>
+#include <assert.h>
 
 #include "atpg_types.h"
 #include "logic_tables.h"
 #include "fault_simulation.h"
 #include "test_generator.h"
 #include "parser_netlist.h"
-#include "pqueue.h"
+#include "event_queue.h"
+#include "test_cube.h"
 
 
 /*
- *  Generates output gates output from the given pattern
+ *  Checks in debug builds that no gate name was searched since <lookups> were
+ *  counted, as simulation only ever handles gate numbers
+ */
+#ifdef NDEBUG
+#define ASSERT_NO_NAME_LOOKUPS(circuit, lookups)    ((void) (lookups))
+#else
+#define ASSERT_NO_NAME_LOOKUPS(circuit, lookups)    assert((circuit)->names.lookups == (lookups))
+#endif
+
+/*
+ *  Computes the output of a gate from the values of the gates driving its
+ *  inputs, through the kernel chosen for it when the netlist was built
+ *
+ *  @param  circuit - the circuit
+ *  @param  gate 	- the gate to evaluate
+ *  @return LOGIC_VALUE the gate's output
+ */
+static LOGIC_VALUE evaluateGate(CIRCUIT* circuit, int gate)
+{
+	return evaluateGateKernel(circuit->kernel[gate], circuit->value,
+							  circuit->fanin + circuit->faninStart[gate], NUM_FANIN(circuit, gate));
+}
+
+/*
+ *  Applies a stuck-at fault to the value computed for its gate
+ *
+ *  @param	fault 	- the fault
+ *  @param  value 	- the gate's value, replaced by D or B when the fault is excited
+ *  @param  wasFaultExcited - set to TRUE if the fault was excited and FALSE otherwise
+ *  @return BOOLEAN TRUE if the fault was excited and FALSE otherwise
+ */
+static BOOLEAN exciteFault(FAULT* fault, LOGIC_VALUE* value, BOOLEAN* wasFaultExcited)
+{
+	if(fault->type == ST_0 && (*value == I || *value == D))
+		*value = D;
+	else if(fault->type == ST_1 && (*value == O || *value == B))
+		*value = B;
+	else
+	{
+		*wasFaultExcited = FALSE;
+		return FALSE;
+	}
+
+	*wasFaultExcited = TRUE;
+	return TRUE;
+}
+
+/*
+ *  Gives a gate its new value and schedules the gates it drives if the value
+ *  changed
  *
  *  @param  circuit - the circuit
+ *  @param  gate 	- the gate
+ *  @param  value 	- the gate's new value
+ *  @return nothing
+ */
+static void updateGate(CIRCUIT* circuit, int gate, LOGIC_VALUE value)
+{
+	LOGIC_VALUE previous = circuit->value[gate];
+	if(previous == value) return;
+	circuit->value[gate] = value;
+
+	int L, sink;
+	for(L = circuit->fanoutStart[gate]; L < circuit->fanoutStart[gate + 1]; L++)
+	{
+		sink = circuit->fanout[L];
+
+		// Wide gates count their input values instead of reading them all again
+		if(KERNEL_ARITY(circuit->kernel[sink]) == KERNEL_MANY)
+		{
+			INPUT_COUNTS(circuit, sink)[previous]--;
+			INPUT_COUNTS(circuit, sink)[value]++;
+		}
+		scheduleEvent(&circuit->events, sink, circuit->level[sink]);
+	}
+}
+
+/*
+ *  Applies the given pattern to the input gates and evaluates, level by level,
+ *  only the gates that have an input whose value changed. Gates of more than
+ *  four inputs are evaluated from the counts of their input values.
+ *
+ *  @param  circuit - the circuit, holding the values of the previous event-driven
+ *  				  simulation or cleared with clearPropagationValuesCircuit
  *  @param  info 	- gate information object
  *  @param  inPattern - input gates' values
- *  @param	fault 	- the fault to be excited as the pattern is generated
+ *  @param	fault 	- the fault to be excited, or NULL to simulate the fault-free circuit
  *  @param  wasFaultExcited - for keeping track if the fault was excited during the execution
- *  @return SIM_RESULTS the simulation results
+ *  @return BOOLEAN FALSE if the pattern cannot excite the fault and TRUE otherwise
  */
-SIM_RESULT test_pattern(CIRCUIT circuit, CIRCUIT_INFO* info, char* inPattern, 
+static BOOLEAN simulateEvents(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern,
 						FAULT* fault, BOOLEAN* wasFaultExcited)
 {
-	SIM_RESULT results;
-
-	//printf("Pattern: %s\n", inPattern);
-	// Initialize the propagation priority queue list
-	PQueue *pqList = pqueue_new(cmpGateLevels, 3*MAX_GATES);
+	LOGIC_VALUE tValue;
+	int K, gate;
 
 	// Assign test pattern to input gates
-	int K, L;
 	for(K = 0; K < info->numPI; K++)
 	{
-		switch(inPattern[K])
+		gate = info->inputs[K];
+		tValue = CUBE_VALUE(inPattern, K);
+		if(fault != NULL && gate == fault->index && exciteFault(fault, &tValue, wasFaultExcited) == FALSE)
 		{
-			case 'I':
-			case '1': circuit[info->inputs[K]]->value = I; break;
-			case 'O':
-			case '0': circuit[info->inputs[K]]->value = O; break;
-			case 'D': circuit[info->inputs[K]]->value = D; break;
-			case 'B': circuit[info->inputs[K]]->value = B; break;
-			case 'x': circuit[info->inputs[K]]->value = X; break;
+			clearEventQueue(&circuit->events);
+			return FALSE;
 		}
-
-		// Add gate to the queue
-		pqueue_enqueue(pqList, circuit[info->inputs[K]]);
+		updateGate(circuit, gate, tValue);
 	}
 
-	//printf("Value: %c\n", logicName(circuit[faultLine]->value));
-
-	// generate output values
-	LOGIC_VALUE tValue;
-	GATE * gate;
-	while(!is_empty(pqList))
+	// Evaluate the scheduled gates, the ones with the least level first
+	while((gate = nextEvent(&circuit->events)) >= 0)
 	{
-		// Select the next gate to propagate the values (i.e. the gate with the least level)
-		gate = (GATE*) pqueue_dequeue(pqList);
-
-		int index = findIndex(circuit, &info->numGates, gate->name, FALSE);
-
-		// Determine the gate's new logical value
-		if(gate->type == PI)
-			tValue = gate->value;
+		if(KERNEL_ARITY(circuit->kernel[gate]) == KERNEL_MANY)
+			tValue = countGateOutput(circuit->kernel[gate], INPUT_COUNTS(circuit, gate));
 		else
-			tValue = computeGateOutput(circuit, index);
-
-		// Check if this gate is the one stuck-at fault and see if the fault was excited
-		if(index == fault->index)
-		{
-			if(fault->type == ST_0 && (tValue == I || tValue == D))
-			{
-				*wasFaultExcited = TRUE;
-				tValue = D;
-			}
-			else if(fault->type == ST_1 && (tValue == O || tValue == B))
-			{
-				*wasFaultExcited = TRUE;
-				tValue = B;
-			}
-			else
-			{
-				*wasFaultExcited = FALSE;
-				// Stop execution, the fault cannot be excited with the current pattern
-				//printf("\nFault %s /%d cannon be excited\n", )
-				return results;
-			}
-		}
+			tValue = evaluateGate(circuit, gate);
 
-		gate->value = tValue;
-
-		/*
-		printf("\n\t--->%s (%+d): %c", gate->name, gate->level, logicName(tValue));
-		if(gate->level >= 0)
+		// Stop execution if the fault cannot be excited with the current pattern
+		if(fault != NULL && gate == fault->index && exciteFault(fault, &tValue, wasFaultExcited) == FALSE)
 		{
-			for(L=0; L<gate->numIn; L++) printf(" (%s=%c) ", circuit[gate->in[L]]->name, logicName(circuit[gate->in[L]]->value));
-			//printf(" %d, %s, %s --> ", index, circuit[4]->name, gate->name);
-		}
-		*/
-
-		// Add new output lines into the queue
-		for(L = 0; L < gate->numOut; L++)
-		{
-			if(circuit[gate->out[L]]->value == X)
-			{
-				circuit[gate->out[L]]->value = tValue;
-				pqueue_enqueue(pqList, circuit[gate->out[L]]);
-			}
+			clearEventQueue(&circuit->events);
+			return FALSE;
 		}
+		updateGate(circuit, gate, tValue);
 	}
+	return TRUE;
+}
 
-	//printf("\nDONE\n");
-	// Clear the priority list heap
-	pqueue_delete(pqList);
-
-	// Retrieve output results;
+/*
+ *  Retrieves the fault-free values of the output gates
+ *
+ *  @param  circuit - the circuit
+ *  @param  info 	- gate information object
+ *  @param  outPattern - receives the output gates' values, D as 1 and B as 0
+ *  @return nothing
+ */
+static void collectOutputs(CIRCUIT* circuit, CIRCUIT_INFO* info, TEST_CUBE* outPattern)
+{
+	int K;
+	clearCube(outPattern, info->numPO);
 	for(K = 0; K < info->numPO; K++)
-		results.output[K] = logicName(circuit[info->outputs[K]]->value, FALSE);
-	results.output[K] = '\0';
+		setCubeValue(outPattern, K, circuit->value[info->outputs[K]]);
+}
 
-	// Retrieve input values
-	for(K = 0; K < info->numPI; K++)
-		results.input[K] = logicName(circuit[info->inputs[K]]->value, FALSE);
-	results.input[K] = '\0';
+/*
+ *  Generates output gates output from the given pattern. The output values are
+ *  the fault-free ones, D reading as 1 and B as 0.
+ *
+ *  @param  circuit - the circuit
+ *  @param  info 	- gate information object
+ *  @param  inPattern - input gates' values
+ *  @param	fault 	- the fault to be excited as the pattern is generated
+ *  @param  wasFaultExcited - for keeping track if the fault was excited during the execution
+ *  @param  outPattern - receives the output gates' values, or NULL
+ *  @return BOOLEAN FALSE if the pattern cannot excite the fault and TRUE otherwise
+ */
+BOOLEAN test_pattern(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern, 
+						FAULT* fault, BOOLEAN* wasFaultExcited, TEST_CUBE* outPattern)
+{
+	int lookups = circuit->names.lookups;
 
+	BOOLEAN results = simulateEvents(circuit, info, inPattern, fault, wasFaultExcited);
+	if(results == TRUE && outPattern != NULL)
+		collectOutputs(circuit, info, outPattern);
+
+	ASSERT_NO_NAME_LOOKUPS(circuit, lookups);
 	return results;
 }
 
@@ -157,113 +212,238 @@ SIM_RESULT test_pattern(CIRCUIT circuit, CIRCUIT_INFO* info, char* inPattern,
  *  @param  circuit - the circuit
  *  @param  info 	- gate information object
  *  @param  inPattern - input gates' values
- *  @return SIM_RESULTS the simulation results
+ *  @param  outPattern - receives the output gates' values
+ *  @return nothing
  */
-SIM_RESULT generate_output(CIRCUIT circuit, CIRCUIT_INFO* info, char* inPattern)
+void generate_output(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern, TEST_CUBE* outPattern)
 {
-	SIM_RESULT results;
+	int lookups = circuit->names.lookups;
 
-	// TODO take fanout into consideration
+	simulateEvents(circuit, info, inPattern, NULL, NULL);
+	collectOutputs(circuit, info, outPattern);
 
-	//printf("Pattern: %s\n", inPattern);
-	// Initialize the propagation priority queue list
-	PQueue *pqList = pqueue_new(cmpGateLevels, 3*MAX_GATES);
+	ASSERT_NO_NAME_LOOKUPS(circuit, lookups);
+}
 
+/*
+ *  Applies the given pattern to the input gates and evaluates every gate once
+ *  in the circuit's evaluation order
+ *
+ *  @param  circuit - the circuit
+ *  @param  info 	- gate information object
+ *  @param  inPattern - input gates' values
+ *  @param	fault 	- the fault to be excited, or NULL to simulate the fault-free circuit
+ *  @param  wasFaultExcited - for keeping track if the fault was excited during the execution
+ *  @return BOOLEAN FALSE if the pattern cannot excite the fault and TRUE otherwise
+ */
+static BOOLEAN sweepGates(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern,
+						FAULT* fault, BOOLEAN* wasFaultExcited)
+{
 	// Assign test pattern to input gates
-	int K, L;
+	int K;
 	for(K = 0; K < info->numPI; K++)
-	{
-		switch(inPattern[K])
-		{
-			case '1': circuit[info->inputs[K]]->value = I; break;
-			case '0': circuit[info->inputs[K]]->value = O; break;
-			case 'd':
-			case 'D': circuit[info->inputs[K]]->value = D; break;
-			case 'b':
-			case 'B': circuit[info->inputs[K]]->value = B; break;
-			case 'x':
-			case 'X': circuit[info->inputs[K]]->value = X; break;
-		}
-
-		// Add gate to the queue
-		pqueue_enqueue(pqList, circuit[info->inputs[K]]);
-	}
+		circuit->value[info->inputs[K]] = CUBE_VALUE(inPattern, K);
 
-	// generate output values
+	// Evaluate the gates after all of their inputs
 	LOGIC_VALUE tValue;
-	GATE * gate;
-	while(!is_empty(pqList))
+	int gate;
+	for(K = 0; K < info->numGates; K++)
 	{
-		// Select the next gate to propagate the values (i.e. the gate with the least level)
-		gate = (GATE*) pqueue_dequeue(pqList);
+		gate = circuit->order[K];
 
-		int index = findIndex(circuit, &info->numGates, gate->name, FALSE);
-
-		// Determine the gate's new logical value
-		if(gate->type == PI)
-			tValue = gate->value;
+		if(circuit->type[gate] == PI)
+			tValue = circuit->value[gate];
 		else
-			tValue = computeGateOutput(circuit, index);
-
-		gate->value = tValue;
+			tValue = evaluateGate(circuit, gate);
 
-		/*
-		printf("\n\t--->%s (%+d): %c", gate->name, gate->level, logicName(tValue, FALSE));
-		if(gate->level >= 0)
-		{
-			for(L=0; L<gate->numIn; L++) printf(" (%s=%c) ", circuit[gate->in[L]]->name, logicName(circuit[gate->in[L]]->value, FALSE));
-			//printf(" [%d, %s, %s --> ", index, circuit[4]->name, gate->name);
-		}
-		*/
-		
+		// Stop execution if the fault cannot be excited with the current pattern
+		if(fault != NULL && gate == fault->index && exciteFault(fault, &tValue, wasFaultExcited) == FALSE)
+			return FALSE;
 
-		// Add new output lines into the queue
-		for(L = 0; L < gate->numOut; L++)
-		{
-			if(circuit[gate->out[L]]->value == X)
-			{
-				circuit[gate->out[L]]->value = tValue;
-				pqueue_enqueue(pqList, circuit[gate->out[L]]);
-			}
-		}
+		circuit->value[gate] = tValue;
 	}
+	return TRUE;
+}
 
-	//printf("\nDONE\n");
-	// Clear the priority list heap
-	pqueue_delete(pqList);
-
-	// Retrieve output results;
-	for(K = 0; K < info->numPO; K++)
-		results.output[K] = logicName(circuit[info->outputs[K]]->value, TRUE);
-	results.output[K] = '\0';
+/*
+ *  Generates output gates output from the given pattern by evaluating every
+ *  gate once in the circuit's evaluation order. Nothing is queued or allocated
+ *  and every gate is overwritten, so the circuit need not be cleared first.
+ *
+ *  @param  circuit - the circuit
+ *  @param  info 	- gate information object
+ *  @param  inPattern - input gates' values
+ *  @param	fault 	- the fault to be excited, or NULL to simulate the fault-free circuit
+ *  @param  wasFaultExcited - for keeping track if the fault was excited during the execution
+ *  @param  outPattern - receives the output gates' values, or NULL
+ *  @return BOOLEAN FALSE if the pattern cannot excite the fault and TRUE otherwise
+ */
+BOOLEAN sweep_pattern(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern,
+						FAULT* fault, BOOLEAN* wasFaultExcited, TEST_CUBE* outPattern)
+{
+	int lookups = circuit->names.lookups;
 
-	// Retrieve input values
-	for(K = 0; K < info->numPI; K++)
-		results.input[K] = logicName(circuit[info->inputs[K]]->value, TRUE);
-	results.input[K] = '\0';
+	BOOLEAN results = sweepGates(circuit, info, inPattern, fault, wasFaultExcited);
+	if(results == TRUE && outPattern != NULL)
+		collectOutputs(circuit, info, outPattern);
 
+	ASSERT_NO_NAME_LOOKUPS(circuit, lookups);
 	return results;
 }
 
 /*
- *  Compares the levels of two gates
+ *  Compares the levels of two gates. Gates are queued by the address of their
+ *  entry in the circuit's level array.
  *
- *  @param  lg 	- left gate's index
- *  @param  rg 	- right gate's index
+ *  @param  lg 	- left gate's level
+ *  @param  rg 	- right gate's level
  *  @return 0 if gate levels are the same, 1 if level of leftIndex is higher and
  *			-1 if the level of the right index is higher
  */
 int cmpGateLevels(const void *lg, const void *rg)
 {
-	GATE *leftGate = (GATE*) lg;
-	GATE *rightGate = (GATE*) rg;
-	if(leftGate->level == rightGate->level) return 0;
-	else if(leftGate->level > rightGate->level) return -1;
+	int32_t leftLevel  = *(const int32_t*) lg;
+	int32_t rightLevel = *(const int32_t*) rg;
+	if(leftLevel == rightLevel) return 0;
+	else if(leftLevel > rightLevel) return -1;
 	else return 1;
 }
 
+/*  Replaces the don't-cares of a test vector's inputs according to the
+ *  don't-care filling option
+ *
+ *  @param  info 	- gate information object
+ *  @param  tv 		- test vector object
+ *  @return nothing
+ */
+void fillDontCares(CIRCUIT_INFO* info, TEST_VECTOR* tv)
+{
+	extern COMMAND_LINE_OPTIONS options;
+	if(options.dontCareFilling == RANDOM) srand(time(NULL));
+	fillCube(&tv->input, options.dontCareFilling);
+}
+
+/*
+ *  Checks whether the simulated fault reaches an output gate, either as D or B
+ *  or as a value opposite to the fault-free one
+ *
+ *  @param  circuit - the circuit, holding the values of the faulty circuit
+ *  @param  info 	- gate information object
+ *  @param  goodOutput - the output gates' values of the fault-free circuit
+ *  @return BOOLEAN TRUE if the fault is observed and FALSE otherwise
+ */
+static BOOLEAN isFaultObserved(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* goodOutput)
+{
+	int L;
+	for(L = 0; L < info->numPO; L++)
+		switch(circuit->value[info->outputs[L]])
+		{
+			case I:
+				if(CUBE_VALUE(goodOutput, L) == O) return TRUE;
+				break;
+			case O:
+				if(CUBE_VALUE(goodOutput, L) == I) return TRUE;
+				break;
+			case D:
+			case B:
+				return TRUE;
+			default:
+				break;
+		}
+	return FALSE;
+}
+
+/*
+ *  Gives a gate its value in the faulty circuit and schedules the gates it
+ *  drives if the value changed. A D or B value adds its fan out connections
+ *  to the ones still carrying the fault's effect.
+ *
+ *  @param  circuit - the circuit, holding the values of the faulty circuit
+ *  @param  gate 	- the gate
+ *  @param  value 	- the gate's value with the fault
+ *  @param  numTouched - the number of gates whose value changed so far
+ *  @param  liveEffects - the fan out connections carrying D or B whose sinks are
+ *  					  not evaluated yet
+ *  @return nothing
+ */
+static void updateFaultyGate(CIRCUIT* circuit, int gate, LOGIC_VALUE value, int* numTouched, int* liveEffects)
+{
+	if(circuit->value[gate] == value) return;
+	circuit->value[gate] = value;
+	circuit->touched[(*numTouched)++] = gate;
+	if(value == D || value == B) *liveEffects += NUM_FANOUT(circuit, gate);
+
+	int L;
+	for(L = circuit->fanoutStart[gate]; L < circuit->fanoutStart[gate + 1]; L++)
+		scheduleEvent(&circuit->events, circuit->fanout[L], circuit->level[circuit->fanout[L]]);
+}
+
+/*
+ *  Simulates a fault from the fault-free values of the gates, only evaluating
+ *  the gates whose inputs it changes. The fault is injected at its gate, or
+ *  only on the input of <indexOut> for a fan out branch. The values are those
+ *  a simulation of the whole circuit with the fault gives, but for the gates
+ *  left unevaluated once no D or B is left to propagate when the fault-free
+ *  outputs agree with the expected ones, as nothing else can then detect it.
+ *
+ *  @param  circuit - the circuit, holding the fault-free values in both <value>
+ *  				  and <goodValue>, which are restored before returning
+ *  @param  info 	- gate information object
+ *  @param  fault 	- the fault
+ *  @param  goodOutput - the expected output gates' values
+ *  @param  isConsistent - TRUE if the fault-free output gates' values agree with
+ *  					   <goodOutput>
+ *  @return BOOLEAN TRUE if the fault is detected and FALSE otherwise
+ */
+static BOOLEAN simulateFaultCone(CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT* fault,
+						const TEST_CUBE* goodOutput, BOOLEAN isConsistent)
+{
+	LOGIC_VALUE value = circuit->value[fault->index];
+	BOOLEAN wasFaultExcited, isDetected = FALSE;
+	int K, gate, site = fault->index, numTouched = 0, liveEffects = 0;
+
+	// Excite the fault where its gate holds the opposite value
+	if(exciteFault(fault, &value, &wasFaultExcited) == FALSE) return FALSE;
+
+	// A fan out branch only gives the fault to the gate it drives
+	if(fault->indexOut >= 0 && NUM_FANOUT(circuit, fault->index) > 1)
+	{
+		circuit->value[fault->index] = value;
+		site = fault->indexOut;
+		value = evaluateGate(circuit, site);
+		circuit->value[fault->index] = circuit->goodValue[fault->index];
+	}
+	updateFaultyGate(circuit, site, value, &numTouched, &liveEffects);
+
+	// Evaluate the gates reached by the fault, the ones with the least level first
+	while((isConsistent == FALSE || liveEffects > 0) && (gate = nextEvent(&circuit->events)) >= 0)
+	{
+		for(K = circuit->faninStart[gate]; K < circuit->faninStart[gate + 1]; K++)
+			if(circuit->value[circuit->fanin[K]] == D || circuit->value[circuit->fanin[K]] == B)
+				liveEffects--;
+		updateFaultyGate(circuit, gate, evaluateGate(circuit, gate), &numTouched, &liveEffects);
+	}
+	clearEventQueue(&circuit->events);
+
+	// Only the output gates the fault reached can detect it, unless the
+	// fault-free outputs already contradict the expected ones. Gates flagged as
+	// outputs but missing from the output list do not count.
+	for(K = 0; K < numTouched && isDetected == FALSE; K++)
+		if(circuit->PO[circuit->touched[K]] && (circuit->value[circuit->touched[K]] == D ||
+		   circuit->value[circuit->touched[K]] == B))
+			isDetected = TRUE;
+	if(isDetected == TRUE || isConsistent == FALSE)
+		isDetected = isFaultObserved(circuit, info, goodOutput);
+
+	// Restore the fault-free values
+	for(K = 0; K < numTouched; K++)
+		circuit->value[circuit->touched[K]] = circuit->goodValue[circuit->touched[K]];
+	return isDetected;
+}
+
 /*  Simulates a given test vector to drop all the faults that can be detected
- *  using it.
+ *  using it. The fault-free circuit is simulated once, then every fault from
+ *  its values, as far as its effect goes.
  *
  *  @param  circuit - the circuit
  *  @param  info 	- gate information object
@@ -272,90 +452,39 @@ int cmpGateLevels(const void *lg, const void *rg)
  *  @param  start 	- starting point in the fault list
  *  @return nothing
  */
-void simulateTestVector(CIRCUIT circuit, CIRCUIT_INFO* info, FAULT_LIST * fList,
+void simulateTestVector(CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST * fList,
 						TEST_VECTOR* tv, int start)
 {	
 	// Remove Don't-Cares
 	int K;
-	extern COMMAND_LINE_OPTIONS options;
-	if(options.dontCareFilling == ONES)
-	{
-		for(K = 0; K < info->numPI; K++)
-			if( tv->input[K] == 'x') tv->input[K] = '1';
-	}
-	else if(options.dontCareFilling == ZEROS)
-	{
-		for(K = 0; K < info->numPI; K++)
-			if( tv->input[K] == 'x') tv->input[K] = '0';
-	}
-	else
-	{
-		srand(time(NULL));
-		for(K = 0; K < info->numPI; K++)
-			if( tv->input[K] == 'x')
-			{
-				if(rand() % 2)	tv->input[K] = '1';
-				else tv->input[K] = '0';
-			}
-	}
+	fillDontCares(info, tv);
+
+	// Simulate the fault-free circuit
+	int lookups = circuit->names.lookups;
+	sweepGates(circuit, info, &tv->input, NULL, NULL);
+	memcpy(circuit->goodValue, circuit->value, info->numGates * sizeof(uint8_t));
+	BOOLEAN isConsistent = (isFaultObserved(circuit, info, &tv->output) == TRUE) ? FALSE : TRUE;
 
 	// Simulate all remaining faults using the current pattern
-	BOOLEAN wasFaultExcited;
-	//printf("\nSimulate %s stuck at %d\n", circuit[fList->list[K]->index]->name, fList->list[K]->type);
 	for(K = start; K < fList->count; K++)
 	{
-		if(fList->list[K]->detected == FALSE)
+		// Skip 64 detected faults at once
+		if((K & 63) == 0 && fList->status[FAULT_DETECTED][K >> 6] == ~(uint64_t) 0)
 		{
-			// Prepare the circuit for simulation
-			//printf("\nSimulate %s stuck at %d", circuit[fList->list[K]->index]->name, fList->list[K]->type);
-			clearPropagationValuesCircuit(circuit, info->numGates);
-
-			// Simulate the fault
-			wasFaultExcited = FALSE;
-			SIM_RESULT results = test_pattern(circuit, info, tv->input, fList->list[K], &wasFaultExcited);
-
-			//if(wasFaultExcited == TRUE)	printf("\t%s -> %s\n", results.input, results.output);
-
-			// Remove fault from list if it can be detected
-			if(wasFaultExcited == TRUE)
-			{ 
-				int L;
-				BOOLEAN valid = FALSE;
-				for(L = 0; L < strlen(results.output) && valid == FALSE; L++)
-				{
-					//printf("[%s->%s, %s->%s] ", tv->input, tv->output, results.input, results.output);
-					switch(results.output[L])
-					{
-						case '1':
-						case 'I':
-							if(tv->output[L] == '0' || tv->output[L] == 'B') valid = TRUE;
-							break;
-						case '0':
-						case 'O':
-							if(tv->output[L] == '1' || tv->output[L] == 'D') valid = TRUE;
-							break;
-						case 'D':
-						case 'B':
-							valid = TRUE;
-							break;
-					}
-				}
-
-				if(valid == TRUE)
-				{
-					// Add the fault into the patterns fault list first
-					tv->faults_list[tv->faults_count] = (FAULT*) malloc(sizeof(FAULT));
-					tv->faults_list[tv->faults_count]->index 	= fList->list[K]->index;
-					tv->faults_list[tv->faults_count]->indexOut = fList->list[K]->indexOut;
-					tv->faults_list[tv->faults_count]->type 	= fList->list[K]->type;
-					tv->faults_count = tv->faults_count + 1;
-
-					// Remove the fault from the list of undetected faults
-					//printf("\t[%s]: Collapsed!\n", circuit[fList->list[K]->index]->name);
-					fList->list[K]->detected = TRUE;
-				}
-			}
+			K += 63;
+			continue;
+		}
+
+		// Remove fault from list if it can be detected
+		if(IS_DETECTED(fList, K) == FALSE &&
+		   simulateFaultCone(circuit, info, &fList->faults[K], &tv->output, isConsistent) == TRUE)
+		{
+			// Add the fault into the patterns fault list first
+			addTestVectorFault(tv, K);
+
+			// Remove the fault from the list of undetected faults
+			SET_FAULT_STATUS(fList, K, FAULT_DETECTED);
 		}
 	}
-	//printf("\n");
-}	
\ No newline at end of file
+	ASSERT_NO_NAME_LOOKUPS(circuit, lookups);
+}
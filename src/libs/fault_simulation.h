@@ -28,17 +28,19 @@
 
 
 /*
- *  Generates output gates output from the given pattern
+ *  Generates output gates output from the given pattern. The output values are
+ *  the fault-free ones, D reading as 1 and B as 0.
  *
  *  @param  circuit - the circuit
  *  @param  info 	- gate information object
  *  @param  inPattern - input gates' values
  *  @param	fault 	- the fault to be excited as the pattern is generated
  *  @param  wasFaultExcited - for keeping track if the fault was excited during the execution
- *  @return SIM_RESULTS the simulation results
+ *  @param  outPattern - receives the output gates' values, or NULL
+ *  @return BOOLEAN FALSE if the pattern cannot excite the fault and TRUE otherwise
  */
-SIM_RESULT test_pattern(CIRCUIT circuit, CIRCUIT_INFO* info, char* inPattern, 
-						FAULT* fault, BOOLEAN* wasFaultExcited);
+BOOLEAN test_pattern(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern, 
+						FAULT* fault, BOOLEAN* wasFaultExcited, TEST_CUBE* outPattern);
 
 /*
  *  Generates output gates output from the given pattern
@@ -46,24 +48,55 @@ SIM_RESULT test_pattern(CIRCUIT circuit, CIRCUIT_INFO* info, char* inPattern,
  *  @param  circuit - the circuit
  *  @param  info 	- gate information object
  *  @param  inPattern - input gates' values
- *  @return SIM_RESULTS the simulation results
+ *  @param  outPattern - receives the output gates' values
+ *  @return nothing
+ */
+void generate_output(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern, TEST_CUBE* outPattern);
+
+
+/*
+ *  Generates output gates output from the given pattern by evaluating every
+ *  gate once in the circuit's evaluation order. Nothing is queued or allocated
+ *  and every gate is overwritten, so the circuit need not be cleared first.
+ *
+ *  @param  circuit - the circuit
+ *  @param  info 	- gate information object
+ *  @param  inPattern - input gates' values
+ *  @param	fault 	- the fault to be excited, or NULL to simulate the fault-free circuit
+ *  @param  wasFaultExcited - for keeping track if the fault was excited during the execution
+ *  @param  outPattern - receives the output gates' values, or NULL
+ *  @return BOOLEAN FALSE if the pattern cannot excite the fault and TRUE otherwise
  */
-SIM_RESULT generate_output(CIRCUIT circuit, CIRCUIT_INFO* info, char* inPattern);
+BOOLEAN sweep_pattern(CIRCUIT* circuit, CIRCUIT_INFO* info, const TEST_CUBE* inPattern,
+						FAULT* fault, BOOLEAN* wasFaultExcited, TEST_CUBE* outPattern);
 
 
 /*
- *  Compares the levels of two gates
+ *  Compares the levels of two gates. Gates are queued by the address of their
+ *  entry in the circuit's level array.
  *
- *  @param  lg 	- left gate's index
- *  @param  rg 	- right gate's index
+ *  @param  lg 	- left gate's level
+ *  @param  rg 	- right gate's level
  *  @return 0 if gate levels are the same, -1 if level of leftIndex is higher and
  *			1 if the level of the right index is higher
  */
 int cmpGateLevels(const void *lg, const void *rg);
 
 
+/*  Replaces the don't-cares of a test vector's inputs according to the
+ *  don't-care filling option
+ *
+ *  @param  info 	- gate information object
+ *  @param  tv 		- test vector object
+ *  @return nothing
+ */
+void fillDontCares(CIRCUIT_INFO* info, TEST_VECTOR* tv);
+
+
 /*  Simulates a given test vector to drop all the faults that can be detected
- *  using it.
+ *  using it. The fault-free circuit is simulated once, then every fault from
+ *  its values, as far as its effect goes. Fan out branch faults are injected
+ *  on the input of the gate their branch drives only.
  *
  *  @param  circuit - the circuit
  *  @param  info 	- gate information object
@@ -72,7 +105,7 @@ int cmpGateLevels(const void *lg, const void *rg);
  *  @param  start 	- starting point in the fault list
  *  @return nothing
  */
-void simulateTestVector(CIRCUIT circuit, CIRCUIT_INFO* info, FAULT_LIST * fList,
+void simulateTestVector(CIRCUIT* circuit, CIRCUIT_INFO* info, FAULT_LIST * fList,
 						TEST_VECTOR* tv, int start);
 
 #endif
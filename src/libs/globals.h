@@ -20,7 +20,6 @@
  */
 
 #include "atpg_types.h"
-#include "hash.h"
 
 
 #ifndef GLOBALS_H
@@ -31,7 +30,5 @@ char ERROR_MESSAGE[MAX_LINE_LENGTH];    // Holds custom error messages
 
 volatile COMMAND_LINE_OPTIONS options;   // Command line options
 
-HASH_ENTRY hashTableGates[MAX_GATES];	// hash table of gate names
-
 
 #endif
@@ -40,7 +40,36 @@
  */
 int hashStringToInt( char* key, int size )
 {
-    uint32_t hash, K, len = strlen(key);
+    return hashBytesToInt(key, strlen(key), size);
+}
+
+/*
+ *  Hashes the first <len> characters of <key> to an whole number bounded by
+ *  <size>. The key does not need to be null terminated which allows hashing
+ *  names in place inside a netlist buffer.
+ *
+ *  @param  const char* key  - characters to be hashed
+ *  @param  int         len  - number of characters in <key>
+ *  @param  int         size - the size of the hash list
+ *  @return int         hashed value for the given <key>
+ */
+int hashBytesToInt( const char* key, int len, int size )
+{
+    return (hashBytesToUInt32(key, len) % size);
+}
+
+/*
+ *  Hashes the first <len> characters of <key> into a 32 bit value using
+ *  Jenkin's one-at-a-time hash
+ *
+ *  @param  const char* key  - characters to be hashed
+ *  @param  int         len  - number of characters in <key>
+ *  @return uint32_t    hashed value for the given <key>
+ */
+uint32_t hashBytesToUInt32( const char* key, int len )
+{
+    uint32_t hash;
+    int K;
     for(hash = K = 0; K < len; K++)
     {
         hash += key[K];
@@ -51,5 +80,26 @@ int hashStringToInt( char* key, int size )
     hash ^= (hash >> 11);
     hash += (hash << 15);
 
-    return (hash % size);
+    return hash;
+}
+
+/*
+ *  Hashes <len> bytes of <data> into a 64 bit value using the FNV-1a hash
+ *  (By Glenn Fowler, Landon Curt Noll and Phong Vo
+ *  <http://www.isthe.com/chongo/tech/comp/fnv/> )
+ *
+ *  @param  const char* data - bytes to be hashed
+ *  @param  size_t      len  - number of bytes in <data>
+ *  @return uint64_t    hashed value for the given <data>
+ */
+uint64_t hashBytesToUInt64( const char* data, size_t len )
+{
+    uint64_t hash = 14695981039346656037ULL;
+    size_t K;
+    for(K = 0; K < len; K++)
+    {
+        hash ^= (unsigned char) data[K];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
 }
@@ -19,6 +19,12 @@
  * =====================================================================================
  */
 
+/*  uint64_t */
+#include <stdint.h>
+
+/*  size_t */
+#include <stddef.h>
+
 #include "defines.h"
 
 #ifndef HASH_H
@@ -36,5 +42,37 @@
  */
 int hashStringToInt( char* key, int size );
 
+/*
+ *  Hashes the first <len> characters of <key> to an whole number bounded by
+ *  <size>. The key does not need to be null terminated.
+ *
+ *  @param  const char* key  - characters to be hashed
+ *  @param  int         len  - number of characters in <key>
+ *  @param  int         size - the size of the hash list
+ *  @return int         hashed value for the given <key>
+ */
+int hashBytesToInt( const char* key, int len, int size );
+
+/*
+ *  Hashes the first <len> characters of <key> into a 32 bit value using
+ *  Jenkin's one-at-a-time hash
+ *
+ *  @param  const char* key  - characters to be hashed
+ *  @param  int         len  - number of characters in <key>
+ *  @return uint32_t    hashed value for the given <key>
+ */
+uint32_t hashBytesToUInt32( const char* key, int len );
+
+/*
+ *  Hashes <len> bytes of <data> into a 64 bit value using the FNV-1a hash
+ *  (By Glenn Fowler, Landon Curt Noll and Phong Vo
+ *  <http://www.isthe.com/chongo/tech/comp/fnv/> )
+ *
+ *  @param  const char* data - bytes to be hashed
+ *  @param  size_t      len  - number of bytes in <data>
+ *  @return uint64_t    hashed value for the given <data>
+ */
+uint64_t hashBytesToUInt64( const char* data, size_t len );
+
 
 #endif
@@ -22,148 +22,312 @@
 #include "logic_tables.h"
 
 #include <stdio.h>
+#include <strings.h>
+
+
+/*
+ *  Five valued operators computed from the true and faulty circuit values of
+ *  their operands, for generating the gate kernel tables at compile time
+ */
+#define GOOD_VALUE(v)       ((v) == I || (v) == D)
+#define FAULTY_VALUE(v)     ((v) == I || (v) == B)
+#define PAIR_VALUE(g, f)    ((g) ? ((f) ? I : D) : ((f) ? B : O))
+#define NOT_VALUE(a)        ((a) == X ? X : PAIR_VALUE(!GOOD_VALUE(a), !FAULTY_VALUE(a)))
+#define AND_VALUE(a, b)     ((a) == O || (b) == O ? O : (a) == X || (b) == X ? X : \
+                             PAIR_VALUE(GOOD_VALUE(a) && GOOD_VALUE(b), FAULTY_VALUE(a) && FAULTY_VALUE(b)))
+#define OR_VALUE(a, b)      ((a) == I || (b) == I ? I : (a) == X || (b) == X ? X : \
+                             PAIR_VALUE(GOOD_VALUE(a) || GOOD_VALUE(b), FAULTY_VALUE(a) || FAULTY_VALUE(b)))
+#define XOR_VALUE(a, b)     ((a) == X || (b) == X ? X : \
+                             PAIR_VALUE(GOOD_VALUE(a) != GOOD_VALUE(b), FAULTY_VALUE(a) != FAULTY_VALUE(b)))
+#define NAND_VALUE(a, b)    NOT_VALUE(AND_VALUE(a, b))
+#define NOR_VALUE(a, b)     NOT_VALUE(OR_VALUE(a, b))
+#define XNOR_VALUE(a, b)    NOT_VALUE(XOR_VALUE(a, b))
+
+#define KERNEL_ROW(op, a)   { op(a, O), op(a, I), op(a, D), op(a, B), op(a, X) }
+#define KERNEL_TABLE(op)    { KERNEL_ROW(op, O), KERNEL_ROW(op, I), KERNEL_ROW(op, D), \
+                              KERNEL_ROW(op, B), KERNEL_ROW(op, X) }
+
+/*
+ *  The same operators on reduction states, the true and faulty circuit values
+ *  being 0, 1 or 2 for unknown
+ */
+#define TERNARY_GOOD(v)         ((v) == X ? 2 : GOOD_VALUE(v))
+#define TERNARY_FAULTY(v)       ((v) == X ? 2 : FAULTY_VALUE(v))
+#define TERNARY_NOT(a)          ((a) == 2 ? 2 : 1 - (a))
+#define TERNARY_AND(a, b)       ((a) == 0 || (b) == 0 ? 0 : ((a) == 2 || (b) == 2 ? 2 : 1))
+#define TERNARY_OR(a, b)        ((a) == 1 || (b) == 1 ? 1 : ((a) == 2 || (b) == 2 ? 2 : 0))
+#define TERNARY_XOR(a, b)       ((a) == 2 || (b) == 2 ? 2 : (a) != (b))
+#define STATE_GOOD(s)           ((s) / 3)
+#define STATE_FAULTY(s)         ((s) % 3)
+#define STATE_VALUE(g, f)       ((g) == 2 || (f) == 2 ? X : PAIR_VALUE(g, f))
+#define NOT_STATE_VALUE(g, f)   STATE_VALUE(TERNARY_NOT(g), TERNARY_NOT(f))
+#define VALUE_STATE(v)          (TERNARY_GOOD(v) * 3 + TERNARY_FAULTY(v))
+#define STEP_STATE(op, s, v)    (op(STATE_GOOD(s), TERNARY_GOOD(v)) * 3 + op(STATE_FAULTY(s), TERNARY_FAULTY(v)))
+#define STEP_VALUE(op, s, v)    STATE_VALUE(op(STATE_GOOD(s), TERNARY_GOOD(v)), op(STATE_FAULTY(s), TERNARY_FAULTY(v)))
+#define STEP_NOT_VALUE(op, s, v) NOT_STATE_VALUE(op(STATE_GOOD(s), TERNARY_GOOD(v)), \
+                                                 op(STATE_FAULTY(s), TERNARY_FAULTY(v)))
+
+#define STEP_ROW(step, op, s)   { step(op, s, O), step(op, s, I), step(op, s, D), step(op, s, B), step(op, s, X) }
+#define PAIR_TABLE(op)      { STEP_ROW(STEP_STATE, op, VALUE_STATE(O)), STEP_ROW(STEP_STATE, op, VALUE_STATE(I)), \
+                              STEP_ROW(STEP_STATE, op, VALUE_STATE(D)), STEP_ROW(STEP_STATE, op, VALUE_STATE(B)), \
+                              STEP_ROW(STEP_STATE, op, VALUE_STATE(X)) }
+#define STATE_TABLE(step, op)   { STEP_ROW(step, op, 0), STEP_ROW(step, op, 1), STEP_ROW(step, op, 2), \
+                                  STEP_ROW(step, op, 3), STEP_ROW(step, op, 4), STEP_ROW(step, op, 5), \
+                                  STEP_ROW(step, op, 6), STEP_ROW(step, op, 7), STEP_ROW(step, op, 8) }
+
+/*
+ *  Two input tables of every gate function
+ */
+const uint8_t GATE_TABLES[MAX_GATE_FUNCTIONS][MAX_LOGIC_VALUES][MAX_LOGIC_VALUES] =
+{
+    KERNEL_TABLE(AND_VALUE),    KERNEL_TABLE(NAND_VALUE),
+    KERNEL_TABLE(OR_VALUE),     KERNEL_TABLE(NOR_VALUE),
+    KERNEL_TABLE(XOR_VALUE),    KERNEL_TABLE(XNOR_VALUE)
+};
+
+/*
+ *  Reduction state of the first two inputs of a gate
+ */
+const uint8_t PAIR_STATES[MAX_GATE_FUNCTIONS / 2][MAX_LOGIC_VALUES][MAX_LOGIC_VALUES] =
+{
+    PAIR_TABLE(TERNARY_AND),    PAIR_TABLE(TERNARY_OR),     PAIR_TABLE(TERNARY_XOR)
+};
+
+/*
+ *  Reduction state after one more input
+ */
+const uint8_t REDUCE_STATES[MAX_GATE_FUNCTIONS / 2][MAX_REDUCTION_STATES][MAX_LOGIC_VALUES] =
+{
+    STATE_TABLE(STEP_STATE, TERNARY_AND),
+    STATE_TABLE(STEP_STATE, TERNARY_OR),
+    STATE_TABLE(STEP_STATE, TERNARY_XOR)
+};
+
+/*
+ *  Output of a gate from the reduction state and its last input
+ */
+const uint8_t LAST_STATES[MAX_GATE_FUNCTIONS][MAX_REDUCTION_STATES][MAX_LOGIC_VALUES] =
+{
+    STATE_TABLE(STEP_VALUE, TERNARY_AND),   STATE_TABLE(STEP_NOT_VALUE, TERNARY_AND),
+    STATE_TABLE(STEP_VALUE, TERNARY_OR),    STATE_TABLE(STEP_NOT_VALUE, TERNARY_OR),
+    STATE_TABLE(STEP_VALUE, TERNARY_XOR),   STATE_TABLE(STEP_NOT_VALUE, TERNARY_XOR)
+};
+
+/*
+ *  Value of a reduction state, without and with inversion
+ */
+#define STATE_ROW(value)    { value(0, 0), value(0, 1), value(0, 2), value(1, 0), value(1, 1), \
+                              value(1, 2), value(2, 0), value(2, 1), value(2, 2) }
+const uint8_t STATE_VALUES[2][MAX_REDUCTION_STATES] =
+{
+    STATE_ROW(STATE_VALUE), STATE_ROW(NOT_STATE_VALUE)
+};
 
 
 /*
  *  Extracts a logic value from the given gate
  *
- * 	@param  CIRCUIT circuit - the circuit containing the gates
+ * 	@param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int 	index 	- the target gate
  *  @return LOGIC_VALUE	- the results of the operation
  */
-inline LOGIC_VALUE getLogicValue( CIRCUIT circuit, int index, int inPos)
+inline LOGIC_VALUE getLogicValue( CIRCUIT* circuit, int index, int inPos)
 {
-	int L;
-	if(circuit[circuit[index]->in[inPos]]->numOut > 1)
+	if(NUM_FANOUT(circuit, FANIN(circuit, index, inPos)) > 1)
 	{
-		//printf("In: ");
-		for(L = 0; L < circuit[circuit[index]->in[inPos]]->numOut; L++)
-		{
-			//printf("%s(%c) ", circuit[circuit[circuit[index]->in[inPos]]->out[L]]->name, logicName(circuit[circuit[circuit[index]->in[inPos]]->out[L]]->value, FALSE));
-			if(circuit[circuit[index]->in[inPos]]->out[L] == index) break;
-		}
-		//printf("\n");
-		return circuit[circuit[circuit[index]->in[inPos]]->out[L]]->value;
-		//return circuit[circuit[index]->in[inPos]]->values[L];
+		// The fan out segment feeding this input is known without a search
+		int branch = FANIN_BRANCH(circuit, index, inPos);
+		return circuit->value[circuit->fanout[branch]];
+		//return circuit->branchValue[branch];
 	}
 	else
-		return circuit[circuit[index]->in[inPos]]->value;
+		return circuit->value[FANIN(circuit, index, inPos)];
 }
 
 /*
  *  Sets a logic value to the given gate's input line
  *
- * 	@param  CIRCUIT circuit - the circuit containing the gates
+ * 	@param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int 	index 	- the target gate
  *  @return LOGIC_VALUE	- the results of the operation
  */
-inline void setInputLogicValue( CIRCUIT circuit, int index, int inIndex, LOGIC_VALUE log_val)
+inline void setInputLogicValue( CIRCUIT* circuit, int index, int inIndex, LOGIC_VALUE log_val)
+{
+	if(NUM_FANOUT(circuit, FANIN(circuit, index, inIndex)) > 1)
+		circuit->branchValue[FANIN_BRANCH(circuit, index, inIndex)] = log_val;
+	else
+		setGateValue(circuit, FANIN(circuit, index, inIndex), log_val);
+}
+
+/*
+ *  Finds the fan out segment of the gate at <index> that feeds the gate at
+ *  <indexOut>. Only the inputs of <indexOut> are searched.
+ *
+ * 	@param  CIRCUIT* circuit - the circuit containing the gates
+ *  @param  int 	index 	- the driving gate
+ *  @param  int 	indexOut - the driven gate
+ *  @return int - the segment's position in the circuit's fanout list or -1 if
+ *				  the gates are not connected
+ */
+int findFanoutBranch( CIRCUIT* circuit, int index, int indexOut )
 {
-	int L;
-	if(circuit[circuit[index]->in[inIndex]]->numOut > 1)
+	int K;
+	for(K = 0; K < NUM_FANIN(circuit, indexOut); K++)
+		if(FANIN(circuit, indexOut, K) == index) return FANIN_BRANCH(circuit, indexOut, K);
+	return -1;
+}
+
+/*
+ *  Chooses the kernel evaluating a gate. Buffers and gates of a single input
+ *  evaluate as AND gates, and gates of other types or without inputs as X.
+ *
+ *  @param  GATE_TYPE type  - the gate's type
+ *  @param  BOOLEAN inv     - TRUE if the gate is inverted
+ *  @param  int     numIn   - the number of inputs of the gate
+ *  @return uint8_t - the GATE_KERNEL of the gate
+ */
+uint8_t selectGateKernel( GATE_TYPE type, BOOLEAN inv, int numIn )
+{
+	GATE_FUNCTION function;
+	if(numIn == 0) return GATE_KERNEL(FUNCTION_AND, 0);
+
+	switch(type)
 	{
-		for(L = 0; L < circuit[circuit[index]->in[inIndex]]->numOut; L++)
-			if(circuit[circuit[index]->in[inIndex]]->out[L] == index) break;
-		circuit[circuit[index]->in[inIndex]]->values[L] = log_val;
+		case AND: function = FUNCTION_AND; break;
+		case OR:  function = FUNCTION_OR;  break;
+		case XOR: function = FUNCTION_XOR; break;
+		case BUF: function = FUNCTION_AND; numIn = 1; break;
+		default:  return GATE_KERNEL(FUNCTION_AND, 0);
+	}
+	if(numIn == 1) function = FUNCTION_AND;
+	if(inv == TRUE) function++;
+
+	return GATE_KERNEL(function, (numIn > 4) ? KERNEL_MANY : numIn);
+}
+
+/*
+ *  Marks every input of a gate as X in the counts of its input values, which
+ *  are only kept for gates of more than four inputs. The number of inputs fed
+ *  by fan out segments is kept.
+ *
+ * 	@param  CIRCUIT* circuit - the circuit containing the gates
+ *  @param  int 	index 	- the target gate
+ *  @return nothing
+ */
+void resetInputCounts( CIRCUIT* circuit, int index )
+{
+	if(KERNEL_ARITY(circuit->kernel[index]) != KERNEL_MANY) return;
+
+	int32_t* count = INPUT_COUNTS(circuit, index);
+	bzero(count, MAX_LOGIC_VALUES * sizeof(int32_t));
+	count[X] = NUM_FANIN(circuit, index);
+}
+
+/*
+ *  Gives a gate its value during test generation and moves the input values
+ *  counted by the wide gates that read it, as getLogicValue reads them: the
+ *  single gate a stem drives, and the gate itself on its inputs fed by fan out
+ *  segments
+ *
+ * 	@param  CIRCUIT* circuit - the circuit containing the gates
+ *  @param  int 	index 	- the target gate
+ *  @param  LOGIC_VALUE value - the gate's new value
+ *  @return nothing
+ */
+void setGateValue( CIRCUIT* circuit, int index, LOGIC_VALUE value )
+{
+	LOGIC_VALUE previous = (LOGIC_VALUE) circuit->value[index];
+	if(previous == value) return;
+	circuit->value[index] = value;
+
+	int32_t* count;
+	if(NUM_FANOUT(circuit, index) == 1)
+	{
+		int sink = FANOUT(circuit, index, 0);
+		if(KERNEL_ARITY(circuit->kernel[sink]) == KERNEL_MANY)
+		{
+			count = INPUT_COUNTS(circuit, sink);
+			count[previous]--;
+			count[value]++;
+		}
+	}
+
+	if(KERNEL_ARITY(circuit->kernel[index]) == KERNEL_MANY)
+	{
+		count = INPUT_COUNTS(circuit, index);
+		count[previous] -= count[BRANCH_INPUTS];
+		count[value]    += count[BRANCH_INPUTS];
 	}
-	else
-		circuit[circuit[index]->in[inIndex]]->value = log_val;
 }
 
 /*
  *  Computes the logic value of the inputs on passing through the gate
  *
- * 	@param  CIRCUIT circuit - the circuit containing the gates
+ * 	@param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int 	index 	- the target gate
  *  @return LOGIC_VALUE	- the results of the operation
  */
-LOGIC_VALUE computeGateOutput( CIRCUIT circuit, int index )
+LOGIC_VALUE computeGateOutput( CIRCUIT* circuit, int index )
 {
+	int32_t count[MAX_LOGIC_VALUES] = { 0 };
 	int K;
-	LOGIC_VALUE result, temp;
-	switch(circuit[index]->type)
-	{
-		case AND:
-			K = 0;
-			//printf("\n\tYees (%s): ", circuit[index]->name);
-			result = getLogicValue(circuit, index, K);
-			while(++K < circuit[index]->numIn)
-			{	
-				//printf("[%c,", logicName(result, FALSE));
-				temp = getLogicValue(circuit, index, K);
-				//printf("%c]=", logicName(temp, FALSE));
-				result = TABLE_AND[result][temp];
-				//printf("%c, ", logicName(result, FALSE));
-			}
 
-			if(circuit[index]->inv == TRUE)	// NAND Gate
-				return negate(result, TRUE);
-			else	// AND Gate
-				return result;
-		case OR:
-			K = 0;
-			result = getLogicValue(circuit, index, K);
-			while(++K < circuit[index]->numIn)
-			{
-				temp = getLogicValue(circuit, index, K);
-				result = TABLE_OR[result][temp];
-			}
+	if(KERNEL_ARITY(circuit->kernel[index]) == 0) return X;
+	if(circuit->type[index] == BUF)
+		return (negate(circuit->value[FANIN(circuit, index, 0)], circuit->inv[index]));
 
-			if(circuit[index]->inv == TRUE)	// NOR Gate
-				return negate(result, TRUE);
-			else	// OR Gate
-				return result;
+	// Wide gates keep their counts up to date as values are set
+	if(KERNEL_ARITY(circuit->kernel[index]) == KERNEL_MANY)
+		return countGateOutput(circuit->kernel[index], INPUT_COUNTS(circuit, index));
 
-		case BUF:
-			return (negate(circuit[circuit[index]->in[0]]->value, circuit[index]->inv));
-		default:
-			// TODO: Implement XOR and other gate types
-			return X;
-	}
+	// Count the input values in one pass and derive the output as the kernel would
+	for(K = 0; K < NUM_FANIN(circuit, index); K++)
+		count[getLogicValue(circuit, index, K)]++;
+	return countGateOutput(circuit->kernel[index], count);
 }
 
 /*
  *  Checks if it is possible to generate the given output by manipulating 
  *  the Don't-Cares (X) input lines
  *
- *	@param  CIRCUIT circuit - the circuit containing the gates
+ *	@param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int         index   - the target gate
  * 	@param  LOGIC_VALUE output - the logical value output of interest 
  *  @return BOOLEAN TRUE if it is possible and FALSE otherwise
  */
-BOOLEAN isOutputPossible( CIRCUIT circuit, int index, LOGIC_VALUE output )
+BOOLEAN isOutputPossible( CIRCUIT* circuit, int index, LOGIC_VALUE output )
 {
 	int K;
 	BOOLEAN result = FALSE;
 
 	// Check if there are any Don't-Cares to manipulate and set them to their probable values
-	for(K = 0; K < circuit[index]->numIn; K++)
+	for(K = 0; K < NUM_FANIN(circuit, index); K++)
 		if(getLogicValue(circuit, index, K) == X)
 		{
 			// Check for the special cases of AND/NAND and OR/NOR gates
 			if(result == FALSE)
 			{
-				if(circuit[index]->type == AND)
+				if(circuit->type[index] == AND)
 				{
-					if(circuit[index]->inv == FALSE && (output == O || output == B))
+					if(circuit->inv[index] == FALSE && (output == O || output == B))
 					{
 						setInputLogicValue(circuit, index, K, O);
 						return TRUE;
 					}
-					if(circuit[index]->inv == TRUE && (output == I || output == D))
+					if(circuit->inv[index] == TRUE && (output == I || output == D))
 					{
 						setInputLogicValue(circuit, index, K, O);
 						return TRUE;
 					}
 				}
-				if(circuit[index]->type == OR)
+				if(circuit->type[index] == OR)
 				{
-					if(circuit[index]->inv == FALSE && (output == I || output == D))
+					if(circuit->inv[index] == FALSE && (output == I || output == D))
 					{
 						setInputLogicValue(circuit, index, K, I);
 						return TRUE;
 					}
-					if(circuit[index]->inv == FALSE && (output == O || output == B))
+					if(circuit->inv[index] == FALSE && (output == O || output == B))
 					{
 						setInputLogicValue(circuit, index, K, I);
 						return TRUE;
@@ -173,18 +337,18 @@ BOOLEAN isOutputPossible( CIRCUIT circuit, int index, LOGIC_VALUE output )
 
 			// Other cases
 			result = TRUE;
-			switch(circuit[index]->type)
+			switch(circuit->type[index])
 			{
 				case AND: 
-					if(circuit[index]->inv == FALSE) setInputLogicValue(circuit, index, K, I);
+					if(circuit->inv[index] == FALSE) setInputLogicValue(circuit, index, K, I);
 					else setInputLogicValue(circuit, index, K, O); 
 					break;
 				case OR:  
-					if(circuit[index]->inv == FALSE) setInputLogicValue(circuit, index, K, O);
+					if(circuit->inv[index] == FALSE) setInputLogicValue(circuit, index, K, O);
 					else setInputLogicValue(circuit, index, K, I);
 					break;
 				case BUF: setInputLogicValue(circuit, index, K, negate(output, 
-					circuit[circuit[index]->in[K]]->inv)); break;
+					circuit->inv[FANIN(circuit, index, K)])); break;
 				default: break;
 			}
 		}
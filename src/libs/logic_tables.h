@@ -80,43 +80,181 @@ static const                        //  O   I   D   B   X
 LOGIC_VALUE TABLE_INV [5]    =  {       I,  O,  B,  D,  X   };
 
 
+/*
+ *  Inputs reduced so far are kept as a reduction state holding the true and
+ *  the faulty circuit values apart, each 0, 1 or unknown, so that a gate's
+ *  output does not depend on the order of its inputs: D, B and X on an AND
+ *  gate always give O. A state is three times its true value plus its faulty
+ *  value, 2 standing for unknown.
+ */
+#define MAX_REDUCTION_STATES    9
+
+/*
+ *  Gate kernel tables, indexed by GATE_FUNCTION or, for the tables reducing
+ *  inputs without inversion, by half of it
+ */
+extern const uint8_t GATE_TABLES[MAX_GATE_FUNCTIONS][MAX_LOGIC_VALUES][MAX_LOGIC_VALUES];
+extern const uint8_t PAIR_STATES[MAX_GATE_FUNCTIONS / 2][MAX_LOGIC_VALUES][MAX_LOGIC_VALUES];
+extern const uint8_t REDUCE_STATES[MAX_GATE_FUNCTIONS / 2][MAX_REDUCTION_STATES][MAX_LOGIC_VALUES];
+extern const uint8_t LAST_STATES[MAX_GATE_FUNCTIONS][MAX_REDUCTION_STATES][MAX_LOGIC_VALUES];
+extern const uint8_t STATE_VALUES[2][MAX_REDUCTION_STATES];
+
+
+/*
+ *  Evaluates a gate with its kernel. One or two inputs are looked up in the
+ *  two input table of the gate's function. More inputs are paired into a
+ *  reduction state, reduced without inversion, and the last one is combined
+ *  through the table of the function itself, which applies the inversion.
+ *
+ *  @param  uint8_t kernel  - the GATE_KERNEL of the gate
+ *  @param  const uint8_t* value - the LOGIC_VALUE of every gate
+ *  @param  const int32_t* in   - the gates driving the gate's inputs
+ *  @param  int     numIn   - the number of inputs of the gate
+ *  @return LOGIC_VALUE - the gate's output
+ */
+static inline LOGIC_VALUE evaluateGateKernel( uint8_t kernel, const uint8_t* value,
+                                              const int32_t* in, int numIn )
+{
+    const uint8_t (*pair)[MAX_LOGIC_VALUES]   = PAIR_STATES[KERNEL_FUNCTION(kernel) >> 1];
+    const uint8_t (*reduce)[MAX_LOGIC_VALUES] = REDUCE_STATES[KERNEL_FUNCTION(kernel) >> 1];
+    const uint8_t (*last)[MAX_LOGIC_VALUES]   = LAST_STATES[KERNEL_FUNCTION(kernel)];
+    uint8_t state;
+    int K;
+
+    switch(KERNEL_ARITY(kernel))
+    {
+        case 1:     // Single inputs are AND gates, I leaving them unchanged
+            return GATE_TABLES[KERNEL_FUNCTION(kernel)][value[in[0]]][I];
+        case 2:
+            return GATE_TABLES[KERNEL_FUNCTION(kernel)][value[in[0]]][value[in[1]]];
+        case 3:
+            return last[pair[value[in[0]]][value[in[1]]]][value[in[2]]];
+        case 4:
+            return last[reduce[pair[value[in[0]]][value[in[1]]]][value[in[2]]]][value[in[3]]];
+        case KERNEL_MANY:
+            state = pair[value[in[0]]][value[in[1]]];
+            for(K = 2; K < numIn - 1; K++) state = reduce[state][value[in[K]]];
+            return last[state][value[in[numIn - 1]]];
+        default:
+            return X;
+    }
+}
+
+/*
+ *  Evaluates a gate from the number of its inputs holding every logic value,
+ *  giving the same output as its kernel
+ *
+ *  @param  uint8_t kernel  - the GATE_KERNEL of the gate
+ *  @param  const int32_t* count - MAX_LOGIC_VALUES counts of the input values
+ *  @return LOGIC_VALUE - the gate's output
+ */
+static inline LOGIC_VALUE countGateOutput( uint8_t kernel, const int32_t* count )
+{
+    int good, faulty;
+    if(KERNEL_ARITY(kernel) == 0) return X;
+
+    switch(KERNEL_FUNCTION(kernel) >> 1)
+    {
+        case FUNCTION_AND >> 1:     // 0 controls the output, then X
+            good   = (count[O] + count[B]) ? 0 : (count[X] ? 2 : 1);
+            faulty = (count[O] + count[D]) ? 0 : (count[X] ? 2 : 1);
+            break;
+        case FUNCTION_OR >> 1:      // 1 controls the output, then X
+            good   = (count[I] + count[D]) ? 1 : (count[X] ? 2 : 0);
+            faulty = (count[I] + count[B]) ? 1 : (count[X] ? 2 : 0);
+            break;
+        default:                    // The parity of the 1s unless an input is X
+            good   = count[X] ? 2 : ((count[I] + count[D]) & 1);
+            faulty = count[X] ? 2 : ((count[I] + count[B]) & 1);
+            break;
+    }
+    return STATE_VALUES[KERNEL_FUNCTION(kernel) & 1][good * 3 + faulty];
+}
+
 /*
  *  Extracts a logic value from the given gate
  *
- *  @param  CIRCUIT circuit - the circuit containing the gates
+ *  @param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int         index   - the target gate
  *  @return LOGIC_VALUE - the results of the operation
  */
-inline LOGIC_VALUE getLogicValue( CIRCUIT circuit, int index, int inIndex);
+inline LOGIC_VALUE getLogicValue( CIRCUIT* circuit, int index, int inIndex);
 
 /*
  *  Sets a logic value to the given gate's input line
  *
- *   @param  CIRCUIT circuit - the circuit containing the gates
+ *   @param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int         index   - the target gate
  *  @return LOGIC_VALUE - the results of the operation
  */
-inline void setInputLogicValue( CIRCUIT circuit, int index, int inIndex, LOGIC_VALUE log_val);
+inline void setInputLogicValue( CIRCUIT* circuit, int index, int inIndex, LOGIC_VALUE log_val);
+
+/*
+ *  Finds the fan out segment of the gate at <index> that feeds the gate at
+ *  <indexOut>. Only the inputs of <indexOut> are searched.
+ *
+ *   @param  CIRCUIT* circuit - the circuit containing the gates
+ *  @param  int         index   - the driving gate
+ *  @param  int         indexOut - the driven gate
+ *  @return int - the segment's position in the circuit's fanout list or -1 if
+ *                the gates are not connected
+ */
+int findFanoutBranch( CIRCUIT* circuit, int index, int indexOut );
+
+/*
+ *  Chooses the kernel evaluating a gate. Buffers and gates of a single input
+ *  evaluate as AND gates, and gates of other types or without inputs as X.
+ *
+ *  @param  GATE_TYPE type  - the gate's type
+ *  @param  BOOLEAN inv     - TRUE if the gate is inverted
+ *  @param  int     numIn   - the number of inputs of the gate
+ *  @return uint8_t - the GATE_KERNEL of the gate
+ */
+uint8_t selectGateKernel( GATE_TYPE type, BOOLEAN inv, int numIn );
+
+/*
+ *  Marks every input of a gate as X in the counts of its input values, which
+ *  are only kept for gates of more than four inputs. The number of inputs fed
+ *  by fan out segments is kept.
+ *
+ *  @param  CIRCUIT* circuit - the circuit containing the gates
+ *  @param  int         index   - the target gate
+ *  @return nothing
+ */
+void resetInputCounts( CIRCUIT* circuit, int index );
+
+/*
+ *  Gives a gate its value during test generation and moves the input values
+ *  counted by the wide gates that read it, as getLogicValue reads them: the
+ *  single gate a stem drives, and the gate itself on its inputs fed by fan out
+ *  segments
+ *
+ *  @param  CIRCUIT* circuit - the circuit containing the gates
+ *  @param  int         index   - the target gate
+ *  @param  LOGIC_VALUE value   - the gate's new value
+ *  @return nothing
+ */
+void setGateValue( CIRCUIT* circuit, int index, LOGIC_VALUE value );
 
 /*
  *  Computes the logic value of the inputs on passing through the gate
  *
- *  @param  CIRCUIT circuit - the circuit containing the gates
+ *  @param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int 	index 	- the target gate
  *  @return LOGIC_VALUE	- the results of the operation
  */
-LOGIC_VALUE computeGateOutput( CIRCUIT circuit, int index );
+LOGIC_VALUE computeGateOutput( CIRCUIT* circuit, int index );
 
 /*
  *  Checks if it is possible to generate the given output by manipulating 
  *  the Don't-Cares (X) input lines
  *
- *  @param  CIRCUIT circuit - the circuit containing the gates
+ *  @param  CIRCUIT* circuit - the circuit containing the gates
  *  @param  int         index   - the target gate
  *  @param  LOGIC_VALUE output - the logical value output of interest 
  *  @return BOOLEAN TRUE if it is possible and FALSE otherwise
  */
-BOOLEAN isOutputPossible( CIRCUIT circuit, int index, LOGIC_VALUE output );
+BOOLEAN isOutputPossible( CIRCUIT* circuit, int index, LOGIC_VALUE output );
 
 /*
  *  Negates or passes the value as it is depending on the flag <inv>
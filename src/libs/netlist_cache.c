@@ -0,0 +1,388 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  netlist_cache.c
+ *
+ *    Description:  Compiled binary netlists cached next to the parsed .bench
+ *                  files so that later runs can skip parsing
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* FILE, fopen, fwrite, fclose, snprintf, rename, remove */
+#include <stdio.h>
+
+/* malloc, free, calloc */
+#include <stdlib.h>
+
+/* memcpy, memcmp, memset */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* open, O_RDONLY */
+#include <fcntl.h>
+
+/* close, getpid */
+#include <unistd.h>
+
+/* mmap, munmap */
+#include <sys/mman.h>
+
+/* fstat */
+#include <sys/stat.h>
+
+#include "netlist_cache.h"
+#include "parser_netlist.h"
+#include "symbol_table.h"
+#include "hash.h"
+#include "event_queue.h"
+#include "data_file.h"
+
+
+/*
+ *  Rounds a section offset up to the next multiple of 8 bytes
+ */
+#define ALIGN_SECTION(offset)   (((offset) + 7) & ~((uint64_t) 7))
+
+
+/*
+ *  Maps the whole file <filename> copy-on-write into memory, so that the
+ *  mapping can be written without changing the file
+ *
+ *  @param  char*   filename - the file to be mapped
+ *  @param  size_t* size     - receives the size of the mapping
+ *  @return char* - the mapped file or NULL if it could not be mapped
+ */
+static char* mapFile( char* filename, size_t* size )
+{
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0) return NULL;
+
+    struct stat st;
+    if(fstat(fd, &st) < 0 || st.st_size == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    char* data = (char*) mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) return NULL;
+
+    *size = st.st_size;
+    return data;
+}
+
+/*
+ *  Computes the size of every section of a compiled netlist from the counts
+ *  of its header
+ *
+ *  @param  const COMPILED_NETLIST_HEADER* header - the header
+ *  @param  uint64_t* sizes - receives COMPILED_SECTION_COUNT sizes in bytes
+ *  @return nothing
+ */
+static void getSectionSizes( const COMPILED_NETLIST_HEADER* header, uint64_t* sizes )
+{
+    uint64_t gates = (uint64_t) header->numGates, edges = (uint64_t) header->numEdges;
+
+    sizes[SECTION_NAME_OFFSET]  = gates * sizeof(uint32_t);
+    sizes[SECTION_TYPE]         = gates * sizeof(uint8_t);
+    sizes[SECTION_INV]          = gates * sizeof(uint8_t);
+    sizes[SECTION_KERNEL]       = gates * sizeof(uint8_t);
+    sizes[SECTION_PO]           = gates * sizeof(uint8_t);
+    sizes[SECTION_PPO]          = gates * sizeof(uint8_t);
+    sizes[SECTION_LEVEL]        = gates * sizeof(int32_t);
+    sizes[SECTION_ORDER]        = gates * sizeof(int32_t);
+    sizes[SECTION_VALUE]        = gates * sizeof(uint8_t);
+    sizes[SECTION_INPUT_COUNT]  = gates * INPUT_COUNT_SLOTS * sizeof(int32_t);
+    sizes[SECTION_FANIN_START]  = (gates + 1) * sizeof(int32_t);
+    sizes[SECTION_FANIN]        = edges * sizeof(int32_t);
+    sizes[SECTION_FANIN_BRANCH] = edges * sizeof(int32_t);
+    sizes[SECTION_FANOUT_START] = (gates + 1) * sizeof(int32_t);
+    sizes[SECTION_FANOUT]       = edges * sizeof(int32_t);
+    sizes[SECTION_BRANCH_VALUE] = edges * sizeof(uint8_t);
+    sizes[SECTION_BUCKET_START] = ((uint64_t) header->numLevels + 1) * sizeof(int32_t);
+    sizes[SECTION_SYMBOL_SLOTS] = (uint64_t) header->symbolCapacity * sizeof(SYMBOL_SLOT);
+    sizes[SECTION_SYMBOL_NAMES] = header->symbolArenaSize;
+    sizes[SECTION_INPUTS]       = (uint64_t) header->numPI * sizeof(int32_t);
+    sizes[SECTION_OUTPUTS]      = (uint64_t) header->numPO * sizeof(int32_t);
+}
+
+/*
+ *  Lists the arrays of a circuit stored in every section of a compiled netlist
+ *
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  void*** sections    - receives COMPILED_SECTION_COUNT array pointers
+ *  @return nothing
+ */
+static void getCircuitSections( CIRCUIT* circuit, CIRCUIT_INFO* info, void*** sections )
+{
+    sections[SECTION_NAME_OFFSET]  = (void**) &circuit->nameOffset;
+    sections[SECTION_TYPE]         = (void**) &circuit->type;
+    sections[SECTION_INV]          = (void**) &circuit->inv;
+    sections[SECTION_KERNEL]       = (void**) &circuit->kernel;
+    sections[SECTION_PO]           = (void**) &circuit->PO;
+    sections[SECTION_PPO]          = (void**) &circuit->PPO;
+    sections[SECTION_LEVEL]        = (void**) &circuit->level;
+    sections[SECTION_ORDER]        = (void**) &circuit->order;
+    sections[SECTION_VALUE]        = (void**) &circuit->value;
+    sections[SECTION_INPUT_COUNT]  = (void**) &circuit->inputCount;
+    sections[SECTION_FANIN_START]  = (void**) &circuit->faninStart;
+    sections[SECTION_FANIN]        = (void**) &circuit->fanin;
+    sections[SECTION_FANIN_BRANCH] = (void**) &circuit->faninBranch;
+    sections[SECTION_FANOUT_START] = (void**) &circuit->fanoutStart;
+    sections[SECTION_FANOUT]       = (void**) &circuit->fanout;
+    sections[SECTION_BRANCH_VALUE] = (void**) &circuit->branchValue;
+    sections[SECTION_BUCKET_START] = (void**) &circuit->events.bucketStart;
+    sections[SECTION_SYMBOL_SLOTS] = (void**) &circuit->names.slots;
+    sections[SECTION_SYMBOL_NAMES] = (void**) &circuit->names.arena;
+    sections[SECTION_INPUTS]       = (void**) &info->inputs;
+    sections[SECTION_OUTPUTS]      = (void**) &info->outputs;
+}
+
+/*
+ *  Computes the hash used to key compiled netlists from the content of the
+ *  given source file
+ *
+ *  @param  char*     filename - the netlist source file
+ *  @param  uint64_t* hash     - receives the file's hash
+ *  @param  uint64_t* size     - receives the file's size
+ *  @return BOOLEAN - TRUE if the file could be read, FALSE otherwise
+ */
+BOOLEAN hashNetlistFile( char* filename, uint64_t* hash, uint64_t* size )
+{
+    // Compressed netlists are keyed by their decompressed content
+    DATA_FILE file;
+    if(loadDataFile(&file, filename) == FALSE || file.size == 0) return FALSE;
+
+    *hash = hashBytesToUInt64(file.data, file.size);
+    *size = file.size;
+
+    releaseDataFile(&file);
+    return TRUE;
+}
+
+/*
+ *  Builds the name of the compiled netlist file for the given source file
+ *
+ *  @param  char*   filename      - the netlist source file
+ *  @param  char*   cacheFilename - receives the compiled netlist's filename
+ *  @param  int     size          - the capacity of <cacheFilename>
+ *  @return nothing
+ */
+void getCompiledNetlistFilename( char* filename, char* cacheFilename, int size )
+{
+    snprintf(cacheFilename, size, "%s%s", filename, COMPILED_NETLIST_EXTENSION);
+}
+
+/*
+ *  Saves a parsed circuit, including its gate levels, evaluation order and
+ *  kernels, as a compiled netlist
+ *
+ *  @param  CIRCUIT* circuit    - the parsed circuit
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the compiled netlist's filename
+ *  @param  uint64_t sourceHash - hash of the netlist source file
+ *  @param  uint64_t sourceSize - size of the netlist source file
+ *  @return BOOLEAN - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN saveCompiledNetlist( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename,
+                             uint64_t sourceHash, uint64_t sourceSize )
+{
+    SYMBOL_TABLE* gateNames = &circuit->names;
+    uint64_t sizes[COMPILED_SECTION_COUNT], offset;
+    void** sections[COMPILED_SECTION_COUNT];
+    int K;
+
+    // Lay out the sections
+    COMPILED_NETLIST_HEADER header;
+    bzero(&header, sizeof(header));
+    memcpy(header.magic, COMPILED_NETLIST_MAGIC, sizeof(COMPILED_NETLIST_MAGIC));
+    header.version      = COMPILED_NETLIST_VERSION;
+    header.byteOrder    = COMPILED_NETLIST_BYTE_ORDER;
+    header.sourceHash   = sourceHash;
+    header.sourceSize   = sourceSize;
+    header.numGates     = info->numGates;
+    header.numPI        = info->numPI;
+    header.numPO        = info->numPO;
+    header.numPPI       = info->numPPI;
+    header.numPPO       = info->numPPO;
+    header.numEdges     = circuit->numEdges;
+    header.numLevels    = circuit->events.numLevels;
+    header.symbolCapacity   = gateNames->capacity;
+    header.symbolCount      = gateNames->count;
+    header.symbolArenaSize  = gateNames->arenaSize;
+
+    getSectionSizes(&header, sizes);
+    offset = ALIGN_SECTION(sizeof(header));
+    for(K = 0; K < COMPILED_SECTION_COUNT; K++)
+    {
+        header.sectionOffset[K] = offset;
+        offset = ALIGN_SECTION(offset + sizes[K]);
+    }
+    header.fileSize = offset;
+
+    // Build the whole image in memory and write it at once. The arrays are
+    // saved as they are; gates refer to their interned names, which gates
+    // sharing a name have in common.
+    char* image = (char*) calloc(1, header.fileSize);
+    if(image == NULL) return FALSE;
+    memcpy(image, &header, sizeof(header));
+
+    getCircuitSections(circuit, info, sections);
+    for(K = 0; K < COMPILED_SECTION_COUNT; K++)
+        if(sizes[K] > 0)
+            memcpy(image + header.sectionOffset[K], *sections[K], sizes[K]);
+
+    // A loaded circuit starts with every wire X, as counted on the wide gates
+    int32_t* counts = (int32_t*) (image + header.sectionOffset[SECTION_INPUT_COUNT]);
+    memset(image + header.sectionOffset[SECTION_VALUE], X, sizes[SECTION_VALUE]);
+    memset(image + header.sectionOffset[SECTION_BRANCH_VALUE], X, sizes[SECTION_BRANCH_VALUE]);
+    bzero(counts, sizes[SECTION_INPUT_COUNT]);
+    for(K = 0; K < info->numGates; K++)
+        if(KERNEL_ARITY(circuit->kernel[K]) == KERNEL_MANY)
+        {
+            counts[K * INPUT_COUNT_SLOTS + X] = NUM_FANIN(circuit, K);
+            counts[K * INPUT_COUNT_SLOTS + BRANCH_INPUTS] = INPUT_COUNTS(circuit, K)[BRANCH_INPUTS];
+        }
+
+    // The sections are hashed as written, before any loaded circuit changes them
+    header.sectionHash = hashBytesToUInt64(image + sizeof(header), header.fileSize - sizeof(header));
+    memcpy(image, &header, sizeof(header));
+
+    // Write into a temporary file first so that concurrent runs never see a
+    // partially written netlist
+    char tempFilename[MAX_LINE_LENGTH];
+    snprintf(tempFilename, sizeof(tempFilename), "%s.%d", filename, (int) getpid());
+
+    BOOLEAN status = FALSE;
+    FILE* fp = fopen(tempFilename, "wb");
+    if(fp != NULL)
+    {
+        status = (fwrite(image, 1, header.fileSize, fp) == header.fileSize);
+        if(fclose(fp) != 0) status = FALSE;
+
+        if(status == TRUE && rename(tempFilename, filename) != 0) status = FALSE;
+        if(status == FALSE) remove(tempFilename);
+    }
+
+    free(image);
+    return status;
+}
+
+/*
+ *  Checks that the section [offset, offset + size) lies in the file
+ */
+static BOOLEAN isSectionValid( uint64_t offset, uint64_t size, uint64_t fileSize )
+{
+    return (offset % 8 == 0 && offset <= fileSize && size <= fileSize - offset);
+}
+
+/*
+ *  Populates an empty circuit from a compiled netlist. The file is rejected if
+ *  it was compiled from a different source or by an incompatible build, or if
+ *  its sections were changed since it was written. The
+ *  circuit's arrays are the sections of the file, mapped copy-on-write, until
+ *  clearCircuit unmaps them.
+ *
+ *  @param  CIRCUIT* circuit    - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the compiled netlist's filename
+ *  @param  uint64_t sourceHash - hash of the netlist source file
+ *  @param  uint64_t sourceSize - size of the netlist source file
+ *  @return BOOLEAN - TRUE if the circuit was loaded, FALSE otherwise
+ */
+BOOLEAN loadCompiledNetlist( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename,
+                             uint64_t sourceHash, uint64_t sourceSize )
+{
+    uint64_t sizes[COMPILED_SECTION_COUNT];
+    void** sections[COMPILED_SECTION_COUNT];
+    int K;
+
+    if(circuit->names.count > 0 || circuit->capacity > 0) return FALSE;
+
+    size_t size;
+    char* image = mapFile(filename, &size);
+    if(image == NULL) return FALSE;
+
+    // Reject stale or incompatible files, and corrupted ones: the sections were
+    // checked when the source was parsed and are trusted as long as they hash
+    // as they were written
+    const COMPILED_NETLIST_HEADER* header = (const COMPILED_NETLIST_HEADER*) image;
+    BOOLEAN isValid = (size >= sizeof(COMPILED_NETLIST_HEADER) &&
+        memcmp(header->magic, COMPILED_NETLIST_MAGIC, sizeof(COMPILED_NETLIST_MAGIC)) == 0 &&
+        header->version   == COMPILED_NETLIST_VERSION &&
+        header->byteOrder == COMPILED_NETLIST_BYTE_ORDER &&
+        header->sourceHash == sourceHash && header->sourceSize == sourceSize &&
+        header->fileSize == size && header->numGates >= 0 &&
+        header->numPI >= 0 && header->numPO >= 0 && header->numEdges >= 0 &&
+        header->numLevels >= 0 && header->symbolCapacity >= 0 && header->symbolCount >= 0 &&
+        header->symbolArenaSize < UINT32_MAX);
+    if(isValid)
+    {
+        getSectionSizes(header, sizes);
+        for(K = 0; K < COMPILED_SECTION_COUNT && isValid; K++)
+            isValid = isSectionValid(header->sectionOffset[K], sizes[K], size);
+    }
+    if(isValid)
+        isValid = (hashBytesToUInt64(image + sizeof(COMPILED_NETLIST_HEADER), size - sizeof(COMPILED_NETLIST_HEADER))
+                   == header->sectionHash);
+    if(isValid == FALSE)
+    {
+        munmap(image, size);
+        return FALSE;
+    }
+
+    // Point the circuit at the sections; nothing is parsed, hashed, leveled
+    // or indexed again
+    getCircuitSections(circuit, info, sections);
+    for(K = 0; K < COMPILED_SECTION_COUNT; K++)
+        *sections[K] = image + header->sectionOffset[K];
+    circuit->image     = image;
+    circuit->imageSize = size;
+    circuit->capacity  = header->numGates;
+    circuit->numEdges  = header->numEdges;
+
+    circuit->names.capacity      = header->symbolCapacity;
+    circuit->names.count         = header->symbolCount;
+    circuit->names.arenaSize     = header->symbolArenaSize;
+    circuit->names.arenaCapacity = header->symbolArenaSize;
+
+    info->numGates = header->numGates;
+    info->numPI    = header->numPI;
+    info->numPO    = header->numPO;
+    info->numPPI   = header->numPPI;
+    info->numPPO   = header->numPPO;
+    info->inputCapacity  = header->numPI;
+    info->outputCapacity = header->numPO;
+
+    // Only the working state of the simulations starts out empty
+    size_t numGates = (size_t) header->numGates + 1;
+    circuit->goodValue  = (uint8_t*) calloc(numGates, sizeof(uint8_t));
+    circuit->touched    = (int32_t*) calloc(numGates, sizeof(int32_t));
+    circuit->justified  = (JUST_OBJECT*) calloc(numGates * MAX_LOGIC_VALUES, sizeof(JUST_OBJECT));
+    circuit->propagated = (PROP_OBJECT*) calloc(numGates * MAX_LOGIC_VALUES, sizeof(PROP_OBJECT));
+    if(circuit->goodValue == NULL || circuit->touched == NULL ||
+       circuit->justified == NULL || circuit->propagated == NULL)
+    {
+        clearCircuit(circuit, info);
+        return FALSE;
+    }
+    openEventQueue(&circuit->events, circuit->events.bucketStart, header->numLevels, header->numGates);
+
+    return TRUE;
+}
@@ -0,0 +1,149 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  netlist_cache.h
+ *
+ *    Description:  Compiled binary netlists cached next to the parsed .bench
+ *                  files so that later runs can skip parsing
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef NETLIST_CACHE_H
+#define NETLIST_CACHE_H
+
+
+/*
+ *  Compiled netlist file identification
+ */
+#define COMPILED_NETLIST_MAGIC      "ATPGCNL"
+#define COMPILED_NETLIST_VERSION    6
+#define COMPILED_NETLIST_BYTE_ORDER 0x01020304
+
+/*
+ *  Sections of a compiled netlist, the arrays of a built circuit as they are
+ *  used once loaded
+ */
+typedef enum
+{
+    SECTION_NAME_OFFSET,    // uint32_t[numGates]
+    SECTION_TYPE,           // uint8_t[numGates]
+    SECTION_INV,            // uint8_t[numGates]
+    SECTION_KERNEL,         // uint8_t[numGates]
+    SECTION_PO,             // uint8_t[numGates]
+    SECTION_PPO,            // uint8_t[numGates]
+    SECTION_LEVEL,          // int32_t[numGates]
+    SECTION_ORDER,          // int32_t[numGates]
+    SECTION_VALUE,          // uint8_t[numGates], all X
+    SECTION_INPUT_COUNT,    // int32_t[numGates * INPUT_COUNT_SLOTS], every input X
+    SECTION_FANIN_START,    // int32_t[numGates + 1]
+    SECTION_FANIN,          // int32_t[numEdges]
+    SECTION_FANIN_BRANCH,   // int32_t[numEdges]
+    SECTION_FANOUT_START,   // int32_t[numGates + 1]
+    SECTION_FANOUT,         // int32_t[numEdges]
+    SECTION_BRANCH_VALUE,   // uint8_t[numEdges], all X
+    SECTION_BUCKET_START,   // int32_t[numLevels + 1] of the event queue
+    SECTION_SYMBOL_SLOTS,   // SYMBOL_SLOT[symbolCapacity]
+    SECTION_SYMBOL_NAMES,   // char[symbolArenaSize]
+    SECTION_INPUTS,         // int32_t[numPI]
+    SECTION_OUTPUTS,        // int32_t[numPO]
+    COMPILED_SECTION_COUNT
+} COMPILED_SECTION;
+
+/*
+ *  Header of a compiled netlist file. Every section offset is relative to the
+ *  start of the file and aligned to 8 bytes.
+ */
+typedef struct
+{
+    char     magic[8];          // COMPILED_NETLIST_MAGIC
+    uint32_t version;           // COMPILED_NETLIST_VERSION
+    uint32_t byteOrder;         // COMPILED_NETLIST_BYTE_ORDER as written
+    uint64_t sourceHash;        // Hash of the .bench file the netlist was compiled from
+    uint64_t sourceSize;        // Size of the .bench file
+    int32_t  numGates;          // CIRCUIT_INFO details
+    int32_t  numPI;
+    int32_t  numPO;
+    int32_t  numPPI;
+    int32_t  numPPO;
+    int32_t  numEdges;          // Total fanin (and fanout) connections
+    int32_t  numLevels;         // Levels of the event queue
+    int32_t  symbolCapacity;    // Slots of the gate names table
+    int32_t  symbolCount;       // Names in the gate names table
+    int32_t  reserved;
+    uint64_t symbolArenaSize;   // Bytes of interned names
+    uint64_t sectionOffset[COMPILED_SECTION_COUNT];
+    uint64_t fileSize;          // Total size of the file
+    uint64_t sectionHash;       // Hash of every byte after the header
+} COMPILED_NETLIST_HEADER;
+
+
+/*
+ *  Computes the hash used to key compiled netlists from the content of the
+ *  given source file
+ *
+ *  @param  char*     filename - the netlist source file
+ *  @param  uint64_t* hash     - receives the file's hash
+ *  @param  uint64_t* size     - receives the file's size
+ *  @return BOOLEAN - TRUE if the file could be read, FALSE otherwise
+ */
+BOOLEAN hashNetlistFile( char* filename, uint64_t* hash, uint64_t* size );
+
+/*
+ *  Builds the name of the compiled netlist file for the given source file
+ *
+ *  @param  char*   filename      - the netlist source file
+ *  @param  char*   cacheFilename - receives the compiled netlist's filename
+ *  @param  int     size          - the capacity of <cacheFilename>
+ *  @return nothing
+ */
+void getCompiledNetlistFilename( char* filename, char* cacheFilename, int size );
+
+/*
+ *  Saves a parsed circuit, including its gate levels, evaluation order and
+ *  kernels, as a compiled netlist
+ *
+ *  @param  CIRCUIT* circuit    - the parsed circuit
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the compiled netlist's filename
+ *  @param  uint64_t sourceHash - hash of the netlist source file
+ *  @param  uint64_t sourceSize - size of the netlist source file
+ *  @return BOOLEAN - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN saveCompiledNetlist( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename,
+                             uint64_t sourceHash, uint64_t sourceSize );
+
+/*
+ *  Populates an empty circuit from a compiled netlist. The file is rejected if
+ *  it was compiled from a different source or by an incompatible build, or if
+ *  its sections were changed since it was written. The
+ *  circuit's arrays are the sections of the file, mapped copy-on-write, until
+ *  clearCircuit unmaps them.
+ *
+ *  @param  CIRCUIT* circuit    - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the compiled netlist's filename
+ *  @param  uint64_t sourceHash - hash of the netlist source file
+ *  @param  uint64_t sourceSize - size of the netlist source file
+ *  @return BOOLEAN - TRUE if the circuit was loaded, FALSE otherwise
+ */
+BOOLEAN loadCompiledNetlist( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename,
+                             uint64_t sourceHash, uint64_t sourceSize );
+
+#endif
@@ -0,0 +1,327 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  output_stage.c
+ *
+ *    Description:  Asynchronous writer of test patterns and fault lists
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* FILE, fflush, ferror, stdout */
+#include <stdio.h>
+
+/* malloc, free, exit */
+#include <stdlib.h>
+
+/* memcpy, strlen, strncpy */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+/* pthread_create, pthread_join, pthread_mutex_*, pthread_cond_* */
+#include <pthread.h>
+
+#include "output_stage.h"
+#include "fault_list.h"
+#include "test_generator.h"
+#include "test_cube.h"
+
+
+/*
+ *  Allocates memory for a record or quits
+ *
+ *  @param  size_t  size - number of bytes to allocate
+ *  @return void* - the allocated memory
+ */
+static void* allocateRecordMemory( size_t size )
+{
+    void* memory = malloc(size > 0 ? size : 1);
+    if(memory == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    return memory;
+}
+
+/*
+ *  Adds a record to the queue, waiting while the queue is full
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @param  OUTPUT_RECORD* record   - the record
+ *  @return nothing
+ */
+static void queueRecord( OUTPUT_STAGE* stage, OUTPUT_RECORD* record )
+{
+    pthread_mutex_lock(&stage->lock);
+    while(stage->count == OUTPUT_QUEUE_CAPACITY)
+        pthread_cond_wait(&stage->notFull, &stage->lock);
+
+    stage->records[(stage->head + stage->count) % OUTPUT_QUEUE_CAPACITY] = *record;
+    stage->count++;
+    pthread_cond_signal(&stage->notEmpty);
+    pthread_mutex_unlock(&stage->lock);
+}
+
+/*
+ *  Formats and writes a record into its destinations, then releases it
+ *
+ *  @param  OUTPUT_STAGE* stage     - the output stage
+ *  @param  OUTPUT_RECORD* record   - the record
+ *  @return nothing
+ */
+static void writeRecord( OUTPUT_STAGE* stage, OUTPUT_RECORD* record )
+{
+    BOOLEAN saved;
+    switch(record->type)
+    {
+        case OUTPUT_TEST_VECTOR:
+            if(stage->isDisplayed)
+                printTestVector(stage->circuit, stage->faultList, stdout, record->number, &record->input, &record->output,
+                                record->faultsCount, record->faults);
+            if(stage->text != NULL)
+                printTestVector(stage->circuit, stage->faultList, stage->text, record->number, &record->input, &record->output,
+                                record->faultsCount, record->faults);
+            if(stage->binary != NULL &&
+               writePatternCubes(stage->binary, &record->input, &record->output,
+                                 record->faultsCount, record->faults) == FALSE)
+                stage->isFailed = TRUE;
+            if(stage->stream != NULL &&
+               writePatternCubes(stage->stream, &record->input, &record->output,
+                                 record->faultsCount, record->faults) == FALSE)
+                stage->isFailed = TRUE;
+
+            releaseCube(&record->input);
+            releaseCube(&record->output);
+            free(record->faults);
+            break;
+
+        case OUTPUT_FAULT_LIST:
+            if(record->isBinary)
+                saved = saveBinaryFaultList(stage->circuit, record->info, record->faultList, record->filename,
+                                            record->isUndetectedOnly, record->netlistHash);
+            else
+                saved = saveFaultList(stage->circuit, record->faultList, record->filename,
+                                      record->isUndetectedOnly);
+
+            if(saved == FALSE && stage->failedFilename[0] == '\0')
+            {
+                strncpy(stage->failedFilename, record->filename, sizeof(stage->failedFilename) - 1);
+                stage->isFailed = TRUE;
+            }
+            free(record->filename);
+            break;
+    }
+}
+
+/*
+ *  Writer thread: writes the queued records in order until the stage closes
+ *
+ *  @param  void*   arg - the output stage
+ *  @return void* - nothing
+ */
+static void* runOutputStage( void* arg )
+{
+    OUTPUT_STAGE* stage = (OUTPUT_STAGE*) arg;
+    OUTPUT_RECORD record;
+
+    pthread_mutex_lock(&stage->lock);
+    while(TRUE)
+    {
+        while(stage->count == 0 && !stage->isClosing)
+            pthread_cond_wait(&stage->notEmpty, &stage->lock);
+        if(stage->count == 0) break;
+
+        // Take the oldest record
+        record = stage->records[stage->head];
+        stage->head = (stage->head + 1) % OUTPUT_QUEUE_CAPACITY;
+        stage->count--;
+        stage->isWriting = TRUE;
+        pthread_cond_signal(&stage->notFull);
+        pthread_mutex_unlock(&stage->lock);
+
+        writeRecord(stage, &record);
+
+        // Hand the stream every pattern written so far once the generator is ahead
+        pthread_mutex_lock(&stage->lock);
+        if(stage->count == 0 && stage->stream != NULL)
+        {
+            pthread_mutex_unlock(&stage->lock);
+            if(flushPatternWriter(stage->stream) == FALSE) stage->isFailed = TRUE;
+            pthread_mutex_lock(&stage->lock);
+        }
+
+        stage->isWriting = FALSE;
+        if(stage->count == 0) pthread_cond_broadcast(&stage->drained);
+    }
+    pthread_mutex_unlock(&stage->lock);
+
+    return NULL;
+}
+
+/*
+ *  Starts the writer thread of an output stage
+ *
+ *  @param  OUTPUT_STAGE* stage     - the output stage
+ *  @param  CIRCUIT* circuit        - the circuit the test vectors belong to
+ *  @param  FAULT_LIST* faultList   - the fault list the detected faults belong to
+ *  @param  FILE*   text            - the text test patterns file
+ *  @param  BOOLEAN isDisplayed     - TRUE to also print the test vectors on stdout
+ *  @param  PATTERN_WRITER* binary  - the binary test patterns file, NULL for none
+ *  @param  PATTERN_WRITER* stream  - the binary test patterns stream, NULL for none
+ *  @return BOOLEAN - TRUE if the thread was started, FALSE otherwise
+ */
+BOOLEAN startOutputStage( OUTPUT_STAGE* stage, CIRCUIT* circuit, FAULT_LIST* faultList, FILE* text,
+                          BOOLEAN isDisplayed,
+                          PATTERN_WRITER* binary, PATTERN_WRITER* stream )
+{
+    bzero(stage, sizeof(OUTPUT_STAGE));
+    stage->circuit     = circuit;
+    stage->faultList   = faultList;
+    stage->text        = text;
+    stage->isDisplayed = isDisplayed;
+    stage->binary      = binary;
+    stage->stream      = stream;
+
+    pthread_mutex_init(&stage->lock, NULL);
+    pthread_cond_init(&stage->notEmpty, NULL);
+    pthread_cond_init(&stage->notFull, NULL);
+    pthread_cond_init(&stage->drained, NULL);
+
+    if(pthread_create(&stage->thread, NULL, runOutputStage, stage) != 0)
+    {
+        pthread_mutex_destroy(&stage->lock);
+        pthread_cond_destroy(&stage->notEmpty);
+        pthread_cond_destroy(&stage->notFull);
+        pthread_cond_destroy(&stage->drained);
+        return FALSE;
+    }
+
+    stage->isStarted = TRUE;
+    return TRUE;
+}
+
+/*
+ *  Queues a test vector to be written
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @param  TEST_VECTOR* tv         - the test vector
+ *  @param  int     tpCount         - the test vector's number
+ *  @return nothing
+ */
+void submitTestVector( OUTPUT_STAGE* stage, TEST_VECTOR* tv, int tpCount )
+{
+    OUTPUT_RECORD record;
+
+    bzero(&record, sizeof(OUTPUT_RECORD));
+    record.type   = OUTPUT_TEST_VECTOR;
+    record.number = tpCount;
+    copyCube(&record.input, &tv->input);
+    copyCube(&record.output, &tv->output);
+
+    record.faultsCount = tv->faults_count;
+    record.faults = (int32_t*) allocateRecordMemory(tv->faults_count * sizeof(int32_t));
+    memcpy(record.faults, tv->faults_list, tv->faults_count * sizeof(int32_t));
+
+    queueRecord(stage, &record);
+}
+
+/*
+ *  Queues a fault list to be saved. The fault list must not change until the
+ *  stage is flushed or closed.
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  char*   filename        - the fault list's filename
+ *  @param  BOOLEAN isBinary        - TRUE to save the binary fault list format
+ *  @param  BOOLEAN isUndetectedOnly - TRUE to save the undetected faults only
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return nothing
+ */
+void submitFaultList( OUTPUT_STAGE* stage, CIRCUIT_INFO* info, FAULT_LIST* faultList, char* filename,
+                      BOOLEAN isBinary, BOOLEAN isUndetectedOnly, uint64_t netlistHash )
+{
+    OUTPUT_RECORD record;
+    size_t length = strlen(filename);
+
+    bzero(&record, sizeof(OUTPUT_RECORD));
+    record.type        = OUTPUT_FAULT_LIST;
+    record.info        = info;
+    record.faultList   = faultList;
+    record.filename    = (char*) allocateRecordMemory(length + 1);
+    memcpy(record.filename, filename, length + 1);
+    record.isBinary    = isBinary;
+    record.isUndetectedOnly = isUndetectedOnly;
+    record.netlistHash = netlistHash;
+
+    queueRecord(stage, &record);
+}
+
+/*
+ *  Waits until every queued record is written and flushes the destinations
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN flushOutputStage( OUTPUT_STAGE* stage )
+{
+    pthread_mutex_lock(&stage->lock);
+    while(stage->count > 0 || stage->isWriting)
+        pthread_cond_wait(&stage->drained, &stage->lock);
+
+    // The writer thread is idle until the next record
+    if(stage->isDisplayed && fflush(stdout) != 0) stage->isFailed = TRUE;
+    if(stage->text != NULL && (fflush(stage->text) != 0 || ferror(stage->text))) stage->isFailed = TRUE;
+    if(stage->binary != NULL && flushPatternWriter(stage->binary) == FALSE) stage->isFailed = TRUE;
+    if(stage->stream != NULL && flushPatternWriter(stage->stream) == FALSE) stage->isFailed = TRUE;
+
+    BOOLEAN status = stage->isFailed ? FALSE : TRUE;
+    pthread_mutex_unlock(&stage->lock);
+
+    return status;
+}
+
+/*
+ *  Writes every queued record, flushes the destinations and stops the writer
+ *  thread. The destinations are left open.
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @return BOOLEAN - TRUE if every record was written, FALSE otherwise
+ */
+BOOLEAN closeOutputStage( OUTPUT_STAGE* stage )
+{
+    if(stage->isStarted == FALSE) return FALSE;
+
+    BOOLEAN status = flushOutputStage(stage);
+
+    pthread_mutex_lock(&stage->lock);
+    stage->isClosing = TRUE;
+    pthread_cond_signal(&stage->notEmpty);
+    pthread_mutex_unlock(&stage->lock);
+    pthread_join(stage->thread, NULL);
+
+    pthread_mutex_destroy(&stage->lock);
+    pthread_cond_destroy(&stage->notEmpty);
+    pthread_cond_destroy(&stage->notFull);
+    pthread_cond_destroy(&stage->drained);
+    stage->isStarted = FALSE;
+
+    return status;
+}
@@ -0,0 +1,163 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  output_stage.h
+ *
+ *    Description:  Asynchronous writer of test patterns and fault lists
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "atpg_types.h"
+#include "pattern_file.h"
+
+
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
+
+
+/*
+ *  Number of records the output queue holds before the producer waits
+ */
+#define OUTPUT_QUEUE_CAPACITY   256
+
+/*
+ *  Kinds of output records
+ */
+typedef enum
+{
+    OUTPUT_TEST_VECTOR,     // A generated test vector
+    OUTPUT_FAULT_LIST       // A fault list to be saved
+} OUTPUT_RECORD_TYPE;
+
+/*
+ *  A record of the output queue
+ */
+typedef struct
+{
+    OUTPUT_RECORD_TYPE type;
+
+    // OUTPUT_TEST_VECTOR
+    int     number;             // Number of the test vector
+    TEST_CUBE input;            // Input gates values, owned by the record
+    TEST_CUBE output;           // Output gates values, owned by the record
+    int     faultsCount;
+    int32_t* faults;            // Positions of the detected faults, owned by the record
+
+    // OUTPUT_FAULT_LIST
+    CIRCUIT_INFO* info;
+    FAULT_LIST* faultList;
+    char*   filename;           // Owned by the record
+    BOOLEAN isBinary;
+    BOOLEAN isUndetectedOnly;
+    uint64_t netlistHash;
+} OUTPUT_RECORD;
+
+/*
+ *  Output stage formatting and writing records on its own thread. The records
+ *  go through a bounded queue: the producer only waits when the writer thread
+ *  falls OUTPUT_QUEUE_CAPACITY records behind.
+ */
+typedef struct
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  notEmpty;       // Signaled when a record is queued or the stage closes
+    pthread_cond_t  notFull;        // Signaled when a record is taken
+    pthread_cond_t  drained;        // Signaled when the queue is empty and no record is written
+
+    OUTPUT_RECORD records[OUTPUT_QUEUE_CAPACITY];
+    int     head;                   // Position of the oldest record
+    int     count;                  // Number of queued records
+    BOOLEAN isWriting;              // TRUE while the writer thread handles a record
+    BOOLEAN isClosing;
+    BOOLEAN isStarted;
+
+    // Destinations of the test vectors, NULL when unused
+    CIRCUIT* circuit;
+    FAULT_LIST* faultList;          // Fault list the detected faults belong to
+    FILE*   text;                   // Text test patterns file
+    BOOLEAN isDisplayed;            // TRUE to also print the test vectors on stdout
+    PATTERN_WRITER* binary;         // Binary test patterns file
+    PATTERN_WRITER* stream;         // Binary test patterns stream, flushed whenever the queue empties
+
+    BOOLEAN isFailed;               // TRUE once a write failed
+    char    failedFilename[MAX_LINE_LENGTH];    // Fault list that could not be saved
+} OUTPUT_STAGE;
+
+
+/*
+ *  Starts the writer thread of an output stage
+ *
+ *  @param  OUTPUT_STAGE* stage     - the output stage
+ *  @param  CIRCUIT* circuit        - the circuit the test vectors belong to
+ *  @param  FAULT_LIST* faultList   - the fault list the detected faults belong to
+ *  @param  FILE*   text            - the text test patterns file
+ *  @param  BOOLEAN isDisplayed     - TRUE to also print the test vectors on stdout
+ *  @param  PATTERN_WRITER* binary  - the binary test patterns file, NULL for none
+ *  @param  PATTERN_WRITER* stream  - the binary test patterns stream, NULL for none
+ *  @return BOOLEAN - TRUE if the thread was started, FALSE otherwise
+ */
+BOOLEAN startOutputStage( OUTPUT_STAGE* stage, CIRCUIT* circuit, FAULT_LIST* faultList, FILE* text,
+                          BOOLEAN isDisplayed,
+                          PATTERN_WRITER* binary, PATTERN_WRITER* stream );
+
+/*
+ *  Queues a test vector to be written
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @param  TEST_VECTOR* tv         - the test vector
+ *  @param  int     tpCount         - the test vector's number
+ *  @return nothing
+ */
+void submitTestVector( OUTPUT_STAGE* stage, TEST_VECTOR* tv, int tpCount );
+
+/*
+ *  Queues a fault list to be saved. The fault list must not change until the
+ *  stage is flushed or closed.
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  FAULT_LIST* faultList   - the fault list
+ *  @param  char*   filename        - the fault list's filename
+ *  @param  BOOLEAN isBinary        - TRUE to save the binary fault list format
+ *  @param  BOOLEAN isUndetectedOnly - TRUE to save the undetected faults only
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @return nothing
+ */
+void submitFaultList( OUTPUT_STAGE* stage, CIRCUIT_INFO* info, FAULT_LIST* faultList, char* filename,
+                      BOOLEAN isBinary, BOOLEAN isUndetectedOnly, uint64_t netlistHash );
+
+/*
+ *  Waits until every queued record is written and flushes the destinations
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN flushOutputStage( OUTPUT_STAGE* stage );
+
+/*
+ *  Writes every queued record, flushes the destinations and stops the writer
+ *  thread. The destinations are left open.
+ *
+ *  @param  OUTPUT_STAGE* stage     - a started output stage
+ *  @return BOOLEAN - TRUE if every record was written, FALSE otherwise
+ */
+BOOLEAN closeOutputStage( OUTPUT_STAGE* stage );
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parallel_kernel.h
+ *
+ *    Description:  Fault simulation kernel of the parallel-pattern simulator,
+ *                  instantiated once per word count and instruction set
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/*
+ *  Included once by every parallel_kernel_*.c file, which defines:
+ *
+ *      KERNEL_WORDS        - the words of a rail, 1, 4 or 8
+ *      KERNEL_INSTANCE(f)  - the name of the instance of the function f
+ *      KERNEL_NAME         - the name of the kernel
+ *      KERNEL_DESCRIPTOR   - the PARALLEL_KERNEL object of the kernel
+ *      KERNEL_SUPPORTED    - an expression TRUE if the CPU runs the kernel
+ *
+ *  The file selects the instruction set with a target pragma. The rails are
+ *  GCC vectors of KERNEL_WORDS words, so the same code compiles to scalar,
+ *  AVX2 or AVX-512 instructions, or to as many SSE2 instructions as a vector
+ *  takes without a target. The rails of a gate are contiguous, 64 byte aligned when their
+ *  size is a multiple of it.
+ */
+
+#include <string.h>
+
+#include "parallel_simulation.h"
+#include "event_queue.h"
+
+
+#if KERNEL_WORDS == 1
+typedef uint64_t LANES;
+#else
+typedef uint64_t LANES __attribute__ ((vector_size (KERNEL_WORDS * 8)));
+#endif
+
+/*
+ *  The rail of a gate
+ */
+#define GATE_RAIL(values, gate, rail)   \
+            (*(LANES*) ((values) + ((size_t) (gate) * NUM_RAILS + (rail)) * KERNEL_WORDS))
+
+/*
+ *  Lanes on which a serial simulation reads the given output value as
+ *  detecting a fault, as DETECTING_LANES of parallel_simulation.c
+ */
+#define KERNEL_DETECTING_LANES(good, faulty, unknown, one, zero)  \
+            (((good) ^ (faulty)) | ((good) & (faulty) & (zero)) | (~((good) | (faulty) | (unknown)) & (one)))
+
+
+/*
+ *  Gives the position of the first lane set
+ *
+ *  @param  const LANES* lanes  - the lanes
+ *  @return int - the position of the lane, -1 if none is set
+ */
+static inline int KERNEL_INSTANCE(firstLane)( const LANES* lanes )
+{
+#if KERNEL_WORDS == 1
+    return *lanes ? __builtin_ctzll(*lanes) : -1;
+#else
+    int K;
+    for(K = 0; K < KERNEL_WORDS; K++)
+        if((*lanes)[K]) return 64 * K + __builtin_ctzll((*lanes)[K]);
+    return -1;
+#endif
+}
+
+/*
+ *  Evaluates a gate on every lane, as evaluateDualRailKernel does for a word
+ *
+ *  @param  uint8_t kernel      - the GATE_KERNEL of the gate
+ *  @param  const uint64_t* values - the rails of every gate
+ *  @param  const int32_t* in   - the gates driving the inputs
+ *  @param  int     numIn       - the number of inputs
+ *  @param  LANES*  out         - receives the good, faulty and unknown rails
+ *  @return nothing
+ */
+static inline void KERNEL_INSTANCE(evaluateGate)( uint8_t kernel, const uint64_t* values,
+                                                  const int32_t* in, int numIn, LANES* out )
+{
+    LANES goodOne, goodZero, faultyOne, faultyZero, good, faulty, unknown;
+    LANES none = { 0 };
+    int K;
+
+    if(KERNEL_ARITY(kernel) == 0)
+    {
+        out[RAIL_GOOD] = out[RAIL_FAULTY] = none;
+        out[RAIL_UNKNOWN] = ~none;
+        return;
+    }
+    switch(KERNEL_FUNCTION(kernel) >> 1)
+    {
+        case FUNCTION_AND >> 1:     // 1 if every input is 1, 0 if one of them is 0
+            goodOne = faultyOne = ~none;
+            goodZero = faultyZero = none;
+            for(K = 0; K < numIn; K++)
+            {
+                good    = GATE_RAIL(values, in[K], RAIL_GOOD);
+                faulty  = GATE_RAIL(values, in[K], RAIL_FAULTY);
+                unknown = GATE_RAIL(values, in[K], RAIL_UNKNOWN);
+                goodOne    &= good;
+                faultyOne  &= faulty;
+                goodZero   |= ~(good | unknown);
+                faultyZero |= ~(faulty | unknown);
+            }
+            break;
+        case FUNCTION_OR >> 1:      // 1 if one of the inputs is 1, 0 if every one is 0
+            goodOne = faultyOne = none;
+            goodZero = faultyZero = ~none;
+            for(K = 0; K < numIn; K++)
+            {
+                good    = GATE_RAIL(values, in[K], RAIL_GOOD);
+                faulty  = GATE_RAIL(values, in[K], RAIL_FAULTY);
+                unknown = GATE_RAIL(values, in[K], RAIL_UNKNOWN);
+                goodOne    |= good;
+                faultyOne  |= faulty;
+                goodZero   &= ~(good | unknown);
+                faultyZero &= ~(faulty | unknown);
+            }
+            break;
+        default:                    // The parity of the 1s unless an input is X
+            goodOne = faultyOne = goodZero = none;
+            for(K = 0; K < numIn; K++)
+            {
+                goodOne   ^= GATE_RAIL(values, in[K], RAIL_GOOD);
+                faultyOne ^= GATE_RAIL(values, in[K], RAIL_FAULTY);
+                goodZero  |= GATE_RAIL(values, in[K], RAIL_UNKNOWN);
+            }
+            goodZero = faultyZero = ~goodZero;
+            goodOne   &= goodZero;
+            faultyOne &= faultyZero;
+            break;
+    }
+
+    unknown = ~((goodOne | goodZero) & (faultyOne | faultyZero));
+    good    = goodOne & ~unknown;
+    faulty  = faultyOne & ~unknown;
+    if(KERNEL_FUNCTION(kernel) & 1)
+    {
+        good   = ~(good | unknown);
+        faulty = ~(faulty | unknown);
+    }
+    out[RAIL_GOOD]    = good;
+    out[RAIL_FAULTY]  = faulty;
+    out[RAIL_UNKNOWN] = unknown;
+}
+
+/*
+ *  Evaluates every gate but the input gates for the fault-free circuit, in the
+ *  evaluation order, and copies the values to the faulty circuit
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator, holding the input gates' values
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @return nothing
+ */
+static void KERNEL_INSTANCE(sweep)( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info )
+{
+    int K, gate;
+    for(K = 0; K < info->numGates; K++)
+    {
+        gate = circuit->order[K];
+        if(circuit->type[gate] != PI)
+            KERNEL_INSTANCE(evaluateGate)(circuit->kernel[gate], sim->good,
+                                          circuit->fanin + circuit->faninStart[gate], NUM_FANIN(circuit, gate),
+                                          &GATE_RAIL(sim->good, gate, 0));
+    }
+    memcpy(sim->faulty, sim->good, (size_t) info->numGates * NUM_RAILS * KERNEL_WORDS * sizeof(uint64_t));
+}
+
+/*
+ *  Gives a gate its values with the fault and schedules the gates it drives
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  int     gate        - the gate
+ *  @param  const LANES* rails  - the gate's values with the fault
+ *  @return nothing
+ */
+static inline void KERNEL_INSTANCE(updateFaultyGate)( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, int gate,
+                                                      const LANES* rails )
+{
+    GATE_RAIL(sim->faulty, gate, RAIL_GOOD)    = rails[RAIL_GOOD];
+    GATE_RAIL(sim->faulty, gate, RAIL_FAULTY)  = rails[RAIL_FAULTY];
+    GATE_RAIL(sim->faulty, gate, RAIL_UNKNOWN) = rails[RAIL_UNKNOWN];
+    sim->touched[sim->numTouched++] = gate;
+
+    int L;
+    for(L = circuit->fanoutStart[gate]; L < circuit->fanoutStart[gate + 1]; L++)
+        scheduleEvent(&circuit->events, circuit->fanout[L], circuit->level[circuit->fanout[L]]);
+}
+
+/*
+ *  Simulates a fault for the block of test vectors, as simulateParallelFault
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator, holding the simulated block
+ *                                    and the expected outputs
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const FAULT* fault  - the fault
+ *  @return int - the lane of the first test vector detecting the fault, -1 for none
+ */
+static int KERNEL_INSTANCE(simulateFault)( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                                           const FAULT* fault )
+{
+    LANES rails[NUM_RAILS], mask, conflicts, excited, changed, one, zero, detected = { 0 };
+    int K, gate;
+
+    memcpy(&mask, sim->laneMask, sizeof(LANES));
+    memcpy(&conflicts, sim->conflicts, sizeof(LANES));
+    rails[RAIL_GOOD]    = GATE_RAIL(sim->good, fault->index, RAIL_GOOD);
+    rails[RAIL_FAULTY]  = GATE_RAIL(sim->good, fault->index, RAIL_FAULTY);
+    rails[RAIL_UNKNOWN] = GATE_RAIL(sim->good, fault->index, RAIL_UNKNOWN);
+
+    // Excite the fault where the gate holds the opposite value
+    if(fault->type == ST_0)
+    {
+        excited = rails[RAIL_GOOD] & mask;
+        rails[RAIL_FAULTY] &= ~excited;
+    }
+    else
+    {
+        excited = ~(rails[RAIL_GOOD] | rails[RAIL_UNKNOWN]) & mask;
+        rails[RAIL_FAULTY] |= excited;
+    }
+    if(KERNEL_INSTANCE(firstLane)(&excited) < 0) return -1;
+
+    // Evaluate the gates reached by the fault, the ones with the least level first
+    sim->numTouched = 0;
+    if(fault->indexOut >= 0 && NUM_FANOUT(circuit, fault->index) > 1)
+    {
+        // A fan out branch only gives the fault to the gate it drives, which
+        // only the faulty rail of the excited lanes tells apart
+        gate = fault->indexOut;
+        GATE_RAIL(sim->faulty, fault->index, RAIL_FAULTY) = rails[RAIL_FAULTY];
+        KERNEL_INSTANCE(evaluateGate)(circuit->kernel[gate], sim->faulty,
+                                      circuit->fanin + circuit->faninStart[gate], NUM_FANIN(circuit, gate), rails);
+        GATE_RAIL(sim->faulty, fault->index, RAIL_FAULTY) = GATE_RAIL(sim->good, fault->index, RAIL_FAULTY);
+        changed = rails[RAIL_FAULTY] ^ GATE_RAIL(sim->faulty, gate, RAIL_FAULTY);
+        if(KERNEL_INSTANCE(firstLane)(&changed) >= 0)
+            KERNEL_INSTANCE(updateFaultyGate)(sim, circuit, gate, rails);
+    }
+    else
+        KERNEL_INSTANCE(updateFaultyGate)(sim, circuit, fault->index, rails);
+    while((gate = nextEvent(&circuit->events)) >= 0)
+    {
+        KERNEL_INSTANCE(evaluateGate)(circuit->kernel[gate], sim->faulty,
+                                      circuit->fanin + circuit->faninStart[gate], NUM_FANIN(circuit, gate), rails);
+        changed = (rails[RAIL_GOOD] ^ GATE_RAIL(sim->faulty, gate, RAIL_GOOD)) |
+                  (rails[RAIL_FAULTY] ^ GATE_RAIL(sim->faulty, gate, RAIL_FAULTY)) |
+                  (rails[RAIL_UNKNOWN] ^ GATE_RAIL(sim->faulty, gate, RAIL_UNKNOWN));
+        if(KERNEL_INSTANCE(firstLane)(&changed) >= 0)
+            KERNEL_INSTANCE(updateFaultyGate)(sim, circuit, gate, rails);
+    }
+
+    // A serial simulation also detects the fault where an output gate the fault
+    // does not reach contradicts the expected outputs
+    conflicts &= excited;
+    if(KERNEL_INSTANCE(firstLane)(&conflicts) >= 0)
+    {
+        for(K = 0; K < info->numPO; K++)
+        {
+            gate = info->outputs[K];
+            memcpy(&one, sim->expectedOne + (size_t) K * KERNEL_WORDS, sizeof(LANES));
+            memcpy(&zero, sim->expectedZero + (size_t) K * KERNEL_WORDS, sizeof(LANES));
+            detected |= KERNEL_DETECTING_LANES(GATE_RAIL(sim->faulty, gate, RAIL_GOOD),
+                                               GATE_RAIL(sim->faulty, gate, RAIL_FAULTY),
+                                               GATE_RAIL(sim->faulty, gate, RAIL_UNKNOWN), one, zero);
+        }
+        detected &= excited;
+    }
+    else
+    {
+        for(K = 0; K < sim->numTouched; K++)
+            if(sim->isOutput[sim->touched[K]])
+                detected |= (GATE_RAIL(sim->faulty, sim->touched[K], RAIL_GOOD) ^
+                             GATE_RAIL(sim->faulty, sim->touched[K], RAIL_FAULTY)) & mask;
+    }
+
+    // Restore the fault-free values
+    for(K = 0; K < sim->numTouched; K++)
+    {
+        gate = sim->touched[K];
+        GATE_RAIL(sim->faulty, gate, RAIL_GOOD)    = GATE_RAIL(sim->good, gate, RAIL_GOOD);
+        GATE_RAIL(sim->faulty, gate, RAIL_FAULTY)  = GATE_RAIL(sim->good, gate, RAIL_FAULTY);
+        GATE_RAIL(sim->faulty, gate, RAIL_UNKNOWN) = GATE_RAIL(sim->good, gate, RAIL_UNKNOWN);
+    }
+    sim->numTouched = 0;
+    return KERNEL_INSTANCE(firstLane)(&detected);
+}
+
+/*
+ *  Tells whether the CPU runs the kernel
+ *
+ *  @return BOOLEAN TRUE if it does, FALSE otherwise
+ */
+static BOOLEAN KERNEL_INSTANCE(isSupported)( void )
+{
+    return (KERNEL_SUPPORTED) ? TRUE : FALSE;
+}
+
+const PARALLEL_KERNEL KERNEL_DESCRIPTOR =
+{
+    KERNEL_NAME,
+    64 * KERNEL_WORDS,
+    KERNEL_INSTANCE(isSupported),
+    KERNEL_INSTANCE(sweep),
+    KERNEL_INSTANCE(simulateFault)
+};
@@ -0,0 +1,49 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parallel_kernel_avx512.c
+ *
+ *    Description:  Fault simulation kernel of 512 test vectors on AVX-512
+ *                  instructions
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include "parallel_simulation.h"
+
+#define KERNEL_WORDS        8
+#define KERNEL_INSTANCE(f)  f##Avx512
+#define KERNEL_NAME         "avx512"
+#define KERNEL_DESCRIPTOR   avx512ParallelKernel
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/* Only the kernel is compiled for AVX-512, the CPU is checked before it runs */
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define KERNEL_SUPPORTED    __builtin_cpu_supports("avx512f")
+#include "parallel_kernel.h"
+#pragma GCC pop_options
+
+#else
+
+/* Other CPUs never run the kernel */
+static BOOLEAN KERNEL_INSTANCE(isSupported)( void )
+{
+    return FALSE;
+}
+
+const PARALLEL_KERNEL KERNEL_DESCRIPTOR = { KERNEL_NAME, 64 * KERNEL_WORDS, KERNEL_INSTANCE(isSupported), NULL, NULL };
+
+#endif
@@ -0,0 +1,28 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parallel_kernel_scalar.c
+ *
+ *    Description:  Fault simulation kernel of 64 test vectors, one word to a rail
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#define KERNEL_WORDS        1
+#define KERNEL_INSTANCE(f)  f##Scalar
+#define KERNEL_NAME         "scalar"
+#define KERNEL_DESCRIPTOR   scalarParallelKernel
+#define KERNEL_SUPPORTED    TRUE
+
+#include "parallel_kernel.h"
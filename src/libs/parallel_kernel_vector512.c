@@ -0,0 +1,29 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parallel_kernel_vector512.c
+ *
+ *    Description:  Fault simulation kernel of 512 test vectors on generic vectors,
+ *                  running on any CPU
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#define KERNEL_WORDS        8
+#define KERNEL_INSTANCE(f)  f##Vector512
+#define KERNEL_NAME         "vector512"
+#define KERNEL_DESCRIPTOR   vector512ParallelKernel
+#define KERNEL_SUPPORTED    TRUE
+
+#include "parallel_kernel.h"
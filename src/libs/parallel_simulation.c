@@ -0,0 +1,407 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parallel_simulation.c
+ *
+ *    Description:  Parallel-pattern single-fault propagation: 64 to 512 test
+ *                  vectors fault simulated at once, one fault at a time
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* realloc, posix_memalign, free, exit */
+#include <stdlib.h>
+
+/* strcmp */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+#include "parallel_simulation.h"
+#include "dual_rail.h"
+#include "test_cube.h"
+#include "test_generator.h"
+
+
+/*
+ *  Lanes of a word of signals on which a serial simulation reads the given
+ *  output value as detecting a fault: D or B, or 1 and 0 opposite to the
+ *  expected output values
+ */
+#define DETECTING_LANES(w, one, zero)   (((w).good ^ (w).faulty) | ((w).good & (w).faulty & (zero)) | \
+                                         (~((w).good | (w).faulty | (w).unknown) & (one)))
+
+
+const PARALLEL_KERNEL* const PARALLEL_KERNELS[NUM_PARALLEL_KERNELS] =
+{
+    &scalarParallelKernel, &vector256ParallelKernel, &vector512ParallelKernel,
+    &avx2ParallelKernel, &avx512ParallelKernel
+};
+
+/*
+ *  Looks up a kernel by name. Without a name, the kernel given to the compiler
+ *  as FAULT_SIMULATION_KERNEL is picked, or else the widest one the CPU supports
+ *  among the AVX-512, AVX2 and scalar kernels.
+ *
+ *  @param  const char* name    - the name of the kernel, or NULL
+ *  @return const PARALLEL_KERNEL* - the kernel, NULL if no kernel has the name
+ */
+const PARALLEL_KERNEL* findParallelKernel( const char* name )
+{
+    int K;
+
+#ifdef FAULT_SIMULATION_KERNEL
+    if(name == NULL) name = FAULT_SIMULATION_KERNEL;
+#endif
+    if(name == NULL)
+    {
+        if(avx512ParallelKernel.isSupported() == TRUE) return &avx512ParallelKernel;
+        if(avx2ParallelKernel.isSupported() == TRUE) return &avx2ParallelKernel;
+        return &scalarParallelKernel;
+    }
+
+    for(K = 0; K < NUM_PARALLEL_KERNELS; K++)
+        if(strcmp(PARALLEL_KERNELS[K]->name, name) == 0) return PARALLEL_KERNELS[K];
+    return NULL;
+}
+
+/*
+ *  Resizes an array of the simulator, quitting when memory runs out
+ *
+ *  @param  void*   items   - the array
+ *  @param  int     count   - the number of items it must hold
+ *  @param  size_t  size    - the size of one item
+ *  @return void* - the resized array
+ */
+static void* growSimulatorArray( void* items, int count, size_t size )
+{
+    items = realloc(items, (size_t) (count > 0 ? count : 1) * size);
+    if(items == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    return items;
+}
+
+/*
+ *  Allocates the rails of every gate again, aligned for the vector loads of
+ *  the kernels, quitting when memory runs out
+ *
+ *  @param  uint64_t* values    - the former rails
+ *  @param  int     numGates    - the number of gates
+ *  @param  int     numWords    - the words of a rail
+ *  @return uint64_t* - the rails, whose values are not set
+ */
+static uint64_t* allocateRails( uint64_t* values, int numGates, int numWords )
+{
+    void* rails;
+    free(values);
+    if(posix_memalign(&rails, 64, (size_t) (numGates > 0 ? numGates : 1) * NUM_RAILS *
+                      numWords * sizeof(uint64_t)) != 0)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    return (uint64_t*) rails;
+}
+
+/*
+ *  Sets the words of a gate with the lanes of a word of signals
+ *
+ *  @param  uint64_t* values    - the rails of every gate
+ *  @param  int     numWords    - the words of a rail
+ *  @param  int     gate        - the gate
+ *  @param  int     lane        - the first lane of the word
+ *  @param  DUAL_RAIL word      - the signals
+ *  @return nothing
+ */
+static void setGateWord( uint64_t* values, int numWords, int gate, int lane, DUAL_RAIL word )
+{
+    RAIL_WORD(values, numWords, gate, RAIL_GOOD, lane)    = word.good;
+    RAIL_WORD(values, numWords, gate, RAIL_FAULTY, lane)  = word.faulty;
+    RAIL_WORD(values, numWords, gate, RAIL_UNKNOWN, lane) = word.unknown;
+}
+
+/*
+ *  Gives the word of signals of a gate holding a lane
+ *
+ *  @param  const uint64_t* values - the rails of every gate
+ *  @param  int     numWords    - the words of a rail
+ *  @param  int     gate        - the gate
+ *  @param  int     lane        - a lane of the word
+ *  @return DUAL_RAIL - the signals
+ */
+static DUAL_RAIL getGateWord( const uint64_t* values, int numWords, int gate, int lane )
+{
+    DUAL_RAIL word;
+    word.good    = RAIL_WORD(values, numWords, gate, RAIL_GOOD, lane);
+    word.faulty  = RAIL_WORD(values, numWords, gate, RAIL_FAULTY, lane);
+    word.unknown = RAIL_WORD(values, numWords, gate, RAIL_UNKNOWN, lane);
+    return word;
+}
+
+/*
+ *  Sizes the simulator for a circuit whose levels are computed. The storage of
+ *  a simulator that was built before is reused.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const PARALLEL_KERNEL* kernel - the kernel of the blocks of more than
+ *                                    PARALLEL_PATTERNS test vectors, supported by the CPU
+ *  @return nothing
+ */
+void buildParallelSimulator( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                             const PARALLEL_KERNEL* kernel )
+{
+    int K, numGates = info->numGates, numWords = kernel->numPatterns / 64;
+    int numSites = 2 * (numGates + circuit->numEdges);
+
+    sim->good         = allocateRails(sim->good, numGates, numWords);
+    sim->faulty       = allocateRails(sim->faulty, numGates, numWords);
+    sim->touched      = growSimulatorArray(sim->touched, numGates, sizeof(int32_t));
+    sim->isOutput     = growSimulatorArray(sim->isOutput, numGates, sizeof(uint8_t));
+    sim->expectedOne  = growSimulatorArray(sim->expectedOne, info->numPO * numWords, sizeof(uint64_t));
+    sim->expectedZero = growSimulatorArray(sim->expectedZero, info->numPO * numWords, sizeof(uint64_t));
+    sim->siteLane     = growSimulatorArray(sim->siteLane, numSites, sizeof(int32_t));
+    sim->siteStamp    = growSimulatorArray(sim->siteStamp, numSites, sizeof(uint32_t));
+    sim->numGates     = numGates;
+    sim->numSites     = numSites;
+    sim->kernel       = kernel;
+    sim->active       = &scalarParallelKernel;
+    sim->numLanes     = 0;
+    sim->numWords     = 1;
+    sim->numTouched   = 0;
+    sim->stamp        = 0;
+    bzero(sim->laneMask, sizeof(sim->laneMask));
+    bzero(sim->conflicts, sizeof(sim->conflicts));
+
+    bzero(sim->isOutput, numGates * sizeof(uint8_t));
+    for(K = 0; K < info->numPO; K++)
+        sim->isOutput[info->outputs[K]] = 1;
+    bzero(sim->siteStamp, numSites * sizeof(uint32_t));
+
+    // Nothing is simulated yet: every gate is X
+    for(K = 0; K < numGates; K++)
+    {
+        setGateWord(sim->good, 1, K, 0, spreadDualRail(X));
+        setGateWord(sim->faulty, 1, K, 0, spreadDualRail(X));
+    }
+}
+
+/*
+ *  Simulates the fault-free circuit for a block of test vectors whose inputs
+ *  are filled, every gate being evaluated once in the evaluation order. Blocks
+ *  of up to PARALLEL_PATTERNS test vectors are simulated by the scalar kernel
+ *  and the bigger ones by the kernel of the simulator.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const TEST_VECTOR* tv - the test vectors
+ *  @param  int     count       - number of test vectors, 1 to the patterns of the kernel
+ *  @return nothing
+ */
+void simulateParallelPatterns( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                               const TEST_VECTOR* tv, int count )
+{
+    uint64_t lane, one;
+    int K, L, P, gate;
+
+    sim->active   = (count <= PARALLEL_PATTERNS) ? &scalarParallelKernel : sim->kernel;
+    sim->numLanes = count;
+    sim->numWords = sim->active->numPatterns / 64;
+    for(L = 0; L < sim->numWords; L++)
+    {
+        P = count - 64 * L;
+        sim->laneMask[L] = (P <= 0) ? 0 : (P < 64) ? ((uint64_t) 1 << P) - 1 : ~(uint64_t) 0;
+    }
+
+    // Assign the test vectors to the input gates, the unused lanes at 0
+    for(K = 0; K < info->numPI; K++)
+        bzero(&RAIL_WORD(sim->good, sim->numWords, info->inputs[K], 0, 0),
+              NUM_RAILS * sim->numWords * sizeof(uint64_t));
+    for(P = 0; P < count; P++)
+    {
+        lane = (uint64_t) 1 << (P & 63);
+        for(K = 0; K < info->numPI; K++)
+        {
+            gate = info->inputs[K];
+            one  = -(uint64_t) CUBE_BIT(tv[P].input.value, K) & lane;
+            RAIL_WORD(sim->good, sim->numWords, gate, RAIL_GOOD, P)    |= one;
+            RAIL_WORD(sim->good, sim->numWords, gate, RAIL_FAULTY, P)  |= one;
+            RAIL_WORD(sim->good, sim->numWords, gate, RAIL_UNKNOWN, P) |=
+                ~(-(uint64_t) CUBE_BIT(tv[P].input.care, K)) & lane;
+        }
+    }
+
+    // Evaluate the gates after all of their inputs
+    sim->active->sweep(sim, circuit, info);
+}
+
+/*
+ *  Retrieves the fault-free values of the output gates for a test vector of
+ *  the simulated block
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  int     lane        - the position of the test vector in the block
+ *  @param  TEST_CUBE* outPattern - receives the output gates' values
+ *  @return nothing
+ */
+void collectParallelOutputs( PARALLEL_SIMULATOR* sim, CIRCUIT_INFO* info, int lane, TEST_CUBE* outPattern )
+{
+    DUAL_RAIL word;
+    int K;
+    clearCube(outPattern, info->numPO);
+    for(K = 0; K < info->numPO; K++)
+    {
+        word = getGateWord(sim->good, sim->numWords, info->outputs[K], lane);
+        setCubeValue(outPattern, K, getDualRailValue(&word, lane & 63));
+    }
+}
+
+/*
+ *  Simulates a fault for the block of test vectors, only the gates its effect
+ *  reaches being evaluated again. Fan out branch faults are only injected on
+ *  the input of the gate their branch drives, as the serial fault simulator does.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator, holding the simulated block
+ *                                    and the expected outputs
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const FAULT* fault  - the fault
+ *  @return int - the lane of the first test vector detecting the fault, -1 for none
+ */
+int simulateParallelFault( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                           const FAULT* fault )
+{
+    return sim->active->simulateFault(sim, circuit, info, fault);
+}
+
+/*
+ *  Numbers the line and type of a fault: both types of every gate's output
+ *  first, then both types of every fan out branch
+ *
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  const FAULT* fault  - the fault
+ *  @return int - the fault's site, below sim->numSites
+ */
+static int faultSite( CIRCUIT* circuit, PARALLEL_SIMULATOR* sim, const FAULT* fault )
+{
+    int line = fault->index;
+    if(fault->indexOut >= 0 && NUM_FANOUT(circuit, fault->index) > 1)
+        line = sim->numGates + findFanoutBranch(circuit, fault->index, fault->indexOut);
+    return 2 * line + (fault->type == ST_1);
+}
+
+/*
+ *  Drops the faults detected by a simulated block of test vectors, from the
+ *  given position in the fault list on. A fault is detected as by the serial
+ *  fault simulator, by comparing its output values with the output values of
+ *  the test vectors, and is added to the first test vector detecting it.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator, holding the simulated block
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @param  TEST_VECTOR* tv     - the test vectors of the block
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void dropParallelFaults( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                         FAULT_LIST* fList, TEST_VECTOR* tv, int start )
+{
+    int K, L, P, site, words = sim->numWords;
+    uint64_t *one, *zero;
+    DUAL_RAIL word;
+
+    // Expected outputs, which the ATPG may give without simulating the filled inputs
+    bzero(sim->conflicts, sizeof(sim->conflicts));
+    for(K = 0; K < info->numPO; K++)
+    {
+        one  = sim->expectedOne + K * words;
+        zero = sim->expectedZero + K * words;
+        bzero(one, words * sizeof(uint64_t));
+        bzero(zero, words * sizeof(uint64_t));
+        for(P = 0; P < sim->numLanes; P++)
+            switch(CUBE_VALUE(&tv[P].output, K))
+            {
+                case I: one[P >> 6]  |= (uint64_t) 1 << (P & 63); break;
+                case O: zero[P >> 6] |= (uint64_t) 1 << (P & 63); break;
+                default: break;
+            }
+        for(L = 0; L < words; L++)
+        {
+            word = getGateWord(sim->good, words, info->outputs[K], 64 * L);
+            sim->conflicts[L] |= DETECTING_LANES(word, one[L], zero[L]) & sim->laneMask[L];
+        }
+    }
+
+    // Faults of the same line and type are simulated once per block
+    if(++sim->stamp == 0)
+    {
+        bzero(sim->siteStamp, sim->numSites * sizeof(uint32_t));
+        sim->stamp = 1;
+    }
+
+    for(K = start; K < fList->count; K++)
+    {
+        // Skip 64 detected faults at once
+        if((K & 63) == 0 && fList->status[FAULT_DETECTED][K >> 6] == ~(uint64_t) 0)
+        {
+            K += 63;
+            continue;
+        }
+        if(IS_DETECTED(fList, K)) continue;
+
+        site = faultSite(circuit, sim, &fList->faults[K]);
+        if(sim->siteStamp[site] != sim->stamp)
+        {
+            sim->siteLane[site] = simulateParallelFault(sim, circuit, info, &fList->faults[K]);
+            sim->siteStamp[site] = sim->stamp;
+        }
+
+        if(sim->siteLane[site] >= 0)
+        {
+            addTestVectorFault(&tv[sim->siteLane[site]], K);
+            SET_FAULT_STATUS(fList, K, FAULT_DETECTED);
+        }
+    }
+}
+
+/*
+ *  Frees the memory of the simulator
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+void releaseParallelSimulator( PARALLEL_SIMULATOR* sim )
+{
+    free(sim->good);
+    free(sim->faulty);
+    free(sim->touched);
+    free(sim->isOutput);
+    free(sim->expectedOne);
+    free(sim->expectedZero);
+    free(sim->siteLane);
+    free(sim->siteStamp);
+    bzero(sim, sizeof(PARALLEL_SIMULATOR));
+}
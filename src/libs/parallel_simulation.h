@@ -0,0 +1,217 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parallel_simulation.h
+ *
+ *    Description:  Parallel-pattern single-fault propagation: 64 to 512 test
+ *                  vectors fault simulated at once, one fault at a time
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef PARALLEL_SIMULATION_H
+#define PARALLEL_SIMULATION_H
+
+
+/*
+ *  Number of test vectors simulated at once by the scalar kernel, one per lane
+ *  of a word, and by the widest kernel
+ */
+#define PARALLEL_PATTERNS       64
+#define MAX_PARALLEL_PATTERNS   512
+#define MAX_PARALLEL_WORDS      (MAX_PARALLEL_PATTERNS / 64)
+
+/*
+ *  The words of the lanes of a gate: its values in the fault-free circuit,
+ *  in the faulty circuit and the unknown ones, as the fields of a DUAL_RAIL
+ */
+#define RAIL_GOOD       0
+#define RAIL_FAULTY     1
+#define RAIL_UNKNOWN    2
+#define NUM_RAILS       3
+
+/*
+ *  The word of a rail of a gate holding the given lane, <words> being the
+ *  number of words of a rail
+ */
+#define RAIL_WORD(values, words, gate, rail, lane)  \
+            ((values)[((size_t) (gate) * NUM_RAILS + (rail)) * (words) + ((lane) >> 6)])
+
+typedef struct PARALLEL_KERNEL PARALLEL_KERNEL;
+
+/*
+ *  Parallel-pattern fault simulator. Every test vector of a block is given a
+ *  lane of the rails of the gates, a rail being one or more words. <good>
+ *  holds the fault-free values of the block; <faulty> holds the values with
+ *  the fault being simulated, which only differ from <good> in the gates
+ *  listed in <touched> and is restored once the fault is simulated.
+ */
+typedef struct
+{
+    int        numGates;        // Number of gates the arrays can hold
+    int        numSites;        // Number of fault sites, both types of every gate and fan out branch
+    const PARALLEL_KERNEL* kernel;  // The widest kernel, picked when the simulator is built
+    const PARALLEL_KERNEL* active;  // The kernel simulating the current block
+    int        numLanes;        // Test vectors of the block, 1 to the patterns of <kernel>
+    int        numWords;        // Words of a rail of the block
+    uint64_t   laneMask[MAX_PARALLEL_WORDS];    // The lanes holding test vectors
+
+    uint64_t*  good;            // Fault-free values of every gate, NUM_RAILS rails each
+    uint64_t*  faulty;          // Values of every gate with the simulated fault
+    int32_t*   touched;         // Gates whose faulty values were changed
+    int        numTouched;
+    uint8_t*   isOutput;        // 1 -> the gate is an output gate, 0 otherwise
+
+    uint64_t*  expectedOne;     // Lanes expecting 1 on every output gate, a rail each
+    uint64_t*  expectedZero;    // Lanes expecting 0 on every output gate, a rail each
+    uint64_t   conflicts[MAX_PARALLEL_WORDS];   // Lanes whose fault-free outputs contradict the expected ones
+
+    int32_t*   siteLane;        // First lane detecting the faults of every site, -1 for none
+    uint32_t*  siteStamp;       // Block in which <siteLane> was computed
+    uint32_t   stamp;           // The current block, never 0
+} PARALLEL_SIMULATOR;
+
+/*
+ *  A fault simulation kernel, evaluating the lanes of a number of words at
+ *  once. The kernels are instances of parallel_kernel.h for a word count and
+ *  an instruction set.
+ */
+struct PARALLEL_KERNEL
+{
+    const char* name;
+    int        numPatterns;     // Lanes of a rail, 64 per word
+
+    // TRUE if the CPU has the instructions of the kernel
+    BOOLEAN    (*isSupported)( void );
+
+    // Evaluates every gate but the input gates for the fault-free circuit
+    void       (*sweep)( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info );
+
+    // Simulates a fault, giving the first lane detecting it or -1
+    int        (*simulateFault)( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                                 const FAULT* fault );
+};
+
+extern const PARALLEL_KERNEL scalarParallelKernel;      // 64 lanes, plain C
+extern const PARALLEL_KERNEL vector256ParallelKernel;   // 256 lanes, generic vectors
+extern const PARALLEL_KERNEL vector512ParallelKernel;   // 512 lanes, generic vectors
+extern const PARALLEL_KERNEL avx2ParallelKernel;        // 256 lanes, AVX2
+extern const PARALLEL_KERNEL avx512ParallelKernel;      // 512 lanes, AVX-512
+
+/*
+ *  Every kernel, the scalar one first
+ */
+#define NUM_PARALLEL_KERNELS    5
+extern const PARALLEL_KERNEL* const PARALLEL_KERNELS[NUM_PARALLEL_KERNELS];
+
+
+/*
+ *  Looks up a kernel by name. Without a name, the kernel given to the compiler
+ *  as FAULT_SIMULATION_KERNEL is picked, or else the widest one the CPU supports
+ *  among the AVX-512, AVX2 and scalar kernels.
+ *
+ *  @param  const char* name    - the name of the kernel, or NULL
+ *  @return const PARALLEL_KERNEL* - the kernel, NULL if no kernel has the name
+ */
+const PARALLEL_KERNEL* findParallelKernel( const char* name );
+
+/*
+ *  Sizes the simulator for a circuit whose levels are computed. The storage of
+ *  a simulator that was built before is reused.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const PARALLEL_KERNEL* kernel - the kernel of the blocks of more than
+ *                                    PARALLEL_PATTERNS test vectors, supported by the CPU
+ *  @return nothing
+ */
+void buildParallelSimulator( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                             const PARALLEL_KERNEL* kernel );
+
+/*
+ *  Simulates the fault-free circuit for a block of test vectors whose inputs
+ *  are filled, every gate being evaluated once in the evaluation order. Blocks
+ *  of up to PARALLEL_PATTERNS test vectors are simulated by the scalar kernel
+ *  and the bigger ones by the kernel of the simulator.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const TEST_VECTOR* tv - the test vectors
+ *  @param  int     count       - number of test vectors, 1 to the patterns of the kernel
+ *  @return nothing
+ */
+void simulateParallelPatterns( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                               const TEST_VECTOR* tv, int count );
+
+/*
+ *  Retrieves the fault-free values of the output gates for a test vector of
+ *  the simulated block
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  int     lane        - the position of the test vector in the block
+ *  @param  TEST_CUBE* outPattern - receives the output gates' values
+ *  @return nothing
+ */
+void collectParallelOutputs( PARALLEL_SIMULATOR* sim, CIRCUIT_INFO* info, int lane, TEST_CUBE* outPattern );
+
+/*
+ *  Simulates a fault for the block of test vectors, only the gates its effect
+ *  reaches being evaluated again. Fan out branch faults are only injected on
+ *  the input of the gate their branch drives, as the serial fault simulator does.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator, holding the simulated block
+ *                                    and the expected outputs
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  const FAULT* fault  - the fault
+ *  @return int - the lane of the first test vector detecting the fault, -1 for none
+ */
+int simulateParallelFault( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                           const FAULT* fault );
+
+/*
+ *  Drops the faults detected by a simulated block of test vectors, from the
+ *  given position in the fault list on. A fault is detected as by the serial
+ *  fault simulator, by comparing its output values with the output values of
+ *  the test vectors, and is added to the first test vector detecting it.
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator, holding the simulated block
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - gate information object
+ *  @param  FAULT_LIST* fList   - fault list object
+ *  @param  TEST_VECTOR* tv     - the test vectors of the block
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void dropParallelFaults( PARALLEL_SIMULATOR* sim, CIRCUIT* circuit, CIRCUIT_INFO* info,
+                         FAULT_LIST* fList, TEST_VECTOR* tv, int start );
+
+/*
+ *  Frees the memory of the simulator
+ *
+ *  @param  PARALLEL_SIMULATOR* sim - the simulator
+ *  @return nothing
+ */
+void releaseParallelSimulator( PARALLEL_SIMULATOR* sim );
+
+
+#endif
@@ -20,85 +20,377 @@
  * =====================================================================================
  */
 
-/* FILE, sprintf, fprintf, fscanf, fopen, fgets, fclose, stderr, stdin, stdout */
+/* FILE, sprintf, snprintf, fprintf, getline, fclose, stderr, stdin, stdout */
 #include <stdio.h>
 
-/* malloc, free, exit, abort, atexit, NULL */
+/* malloc, realloc, free, exit, abort, atexit, NULL */
 #include <stdlib.h>
 
-/* strcmp, strcpy, strtok */
+/* strcmp, strcpy, strtok, memchr, memcpy, memset */
 #include <string.h>
 
 /* errno */
 #include <errno.h>
 
+/* munmap */
+#include <sys/mman.h>
+
 #include "parser_netlist.h"
+#include "data_file.h"
 #include "atpg_types.h"
-#include "hash.h"
+#include "symbol_table.h"
+#include "event_queue.h"
+#include "logic_tables.h"
+
+extern volatile COMMAND_LINE_OPTIONS options;
+
+
+/*
+ *  Grows an array of <size> byte items to hold <capacity> items
+ */
+static void* growCircuitArray( void* items, int capacity, size_t size )
+{
+    items = realloc(items, (size_t) capacity * size);
+    if(items == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    return items;
+}
 
+/*
+ *  Frees an array of the <circuit> unless it is a section of the compiled
+ *  netlist the circuit was loaded from
+ */
+static void freeCircuitArray( CIRCUIT* circuit, void* items )
+{
+    if(circuit->image != NULL && (char*) items >= circuit->image &&
+       (char*) items <= circuit->image + circuit->imageSize)
+        return;
+    free(items);
+}
+
+/*
+ *  Makes room in the gate arrays of the <circuit> for at least <numGates> gates
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - the number of gates the circuit must hold
+ *  @return nothing
+ */
+void reserveCircuit( CIRCUIT* circuit, int numGates )
+{
+    if(numGates <= circuit->capacity) return;
+
+    int capacity = (circuit->capacity < 1024) ? 1024 : circuit->capacity;
+    while(capacity < numGates) capacity *= 2;
+
+    circuit->nameOffset = growCircuitArray(circuit->nameOffset, capacity, sizeof(uint32_t));
+    circuit->type       = growCircuitArray(circuit->type, capacity, sizeof(uint8_t));
+    circuit->inv        = growCircuitArray(circuit->inv, capacity, sizeof(uint8_t));
+    circuit->kernel     = growCircuitArray(circuit->kernel, capacity, sizeof(uint8_t));
+    circuit->PO         = growCircuitArray(circuit->PO, capacity, sizeof(uint8_t));
+    circuit->PPO        = growCircuitArray(circuit->PPO, capacity, sizeof(uint8_t));
+    circuit->level      = growCircuitArray(circuit->level, capacity, sizeof(int32_t));
+    circuit->order      = growCircuitArray(circuit->order, capacity, sizeof(int32_t));
+    circuit->value      = growCircuitArray(circuit->value, capacity, sizeof(uint8_t));
+    circuit->goodValue  = growCircuitArray(circuit->goodValue, capacity, sizeof(uint8_t));
+    circuit->touched    = growCircuitArray(circuit->touched, capacity, sizeof(int32_t));
+    circuit->inputCount = growCircuitArray(circuit->inputCount, capacity,
+                                           INPUT_COUNT_SLOTS * sizeof(int32_t));
+    circuit->justified  = growCircuitArray(circuit->justified, capacity,
+                                           MAX_LOGIC_VALUES * sizeof(JUST_OBJECT));
+    circuit->propagated = growCircuitArray(circuit->propagated, capacity,
+                                           MAX_LOGIC_VALUES * sizeof(PROP_OBJECT));
+    circuit->capacity   = capacity;
+}
+
+/*
+ *  Gives the gate at position <index> the name interned with <id> in the gate
+ *  names table. Gates sharing a name share its interned copy.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     index   - the position of the gate in the <circuit>
+ *  @param  int     id      - the id returned by internSymbol for the gate's name
+ *  @param  int     len     - length of the gate's name
+ *  @return nothing
+ */
+void setGateName( CIRCUIT* circuit, int index, int id, int len )
+{
+    // A new name is the last one appended to the names arena
+    if(id == index)
+        circuit->nameOffset[index] = (uint32_t) (circuit->names.arenaSize - len - 1);
+    else
+        circuit->nameOffset[index] = circuit->nameOffset[id];
+}
 
 /*
  *  Allocates memory for the gate at location <totalGates>
  *
- *  @param  CIRCUIT circuit - a circuit to be populated
+ *  @param  CIRCUIT* circuit - a circuit to be populated
+ *  @param  int*    total   - total number of gates currently in the circuit
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN appendNewGate( CIRCUIT* circuit, int* total, char* name )
+{
+    return appendNewGateLen(circuit, total, name, strlen(name));
+}
+
+/*
+ *  Allocates memory for the gate at location <totalGates> whose name is given
+ *  by the first <len> characters of <name>
+ *
+ *  @param  CIRCUIT* circuit - a circuit to be populated
  *  @param  int*    total   - total number of gates currently in the circuit
+ *  @param  const char* name - the gate's name (not necessarily null terminated)
+ *  @param  int     len     - length of the gate's name
  *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
  */
-BOOLEAN appendNewGate( CIRCUIT circuit, int* total, char* name )
-{
-    circuit[*total] = (GATE*) malloc(sizeof(GATE));
-    strcpy(circuit[*total]->name, name);
-    circuit[*total]->numIn  = 0;
-    circuit[*total]->numOut = 0;
-    circuit[*total]->PO     = 0;
-    circuit[*total]->PPO    = 0;
-    circuit[*total]->type   = OTHER;
-    circuit[*total]->value  = X;
-    circuit[*total]->level  = -1;
-    bzero(circuit[*total]->justified, sizeof(JUST_OBJECT));
-    bzero(circuit[*total]->propagated, sizeof(PROP_OBJECT));
+BOOLEAN appendNewGateLen( CIRCUIT* circuit, int* total, const char* name, int len )
+{
+    int index = *total;
+    reserveCircuit(circuit, index + 1);
+
+    circuit->inv[index]     = 0;
+    circuit->PO[index]      = 0;
+    circuit->PPO[index]     = 0;
+    circuit->type[index]    = OTHER;
+    circuit->value[index]   = X;
+    circuit->level[index]   = -1;
+    bzero(&JUSTIFIED(circuit, index, 0), MAX_LOGIC_VALUES * sizeof(JUST_OBJECT));
+    bzero(&PROPAGATED(circuit, index, 0), MAX_LOGIC_VALUES * sizeof(PROP_OBJECT));
     (*total)++;
 
-    // Store the gate name and index in a hash table
-    extern HASH_ENTRY hashTableGates[MAX_GATES];
-    int K = hashStringToInt(name, MAX_GATES);
+    // Store the gate name and index in the gate names table
+    int id = internSymbol(&circuit->names, name, len, hashSymbol(name, len), index);
+    setGateName(circuit, index, id, len);
+
+    return TRUE;
+}
+
+/*
+ *  Appends a gate to the primary inputs of the circuit, growing their list
+ *
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  int     index       - the input gate
+ *  @return nothing
+ */
+void appendPrimaryInput( CIRCUIT_INFO* info, int index )
+{
+    if(info->numPI == info->inputCapacity)
+    {
+        info->inputCapacity = (info->inputCapacity < 64) ? 64 : 2 * info->inputCapacity;
+        info->inputs = growCircuitArray(info->inputs, info->inputCapacity, sizeof(int32_t));
+    }
+    info->inputs[info->numPI++] = index;
+}
+
+/*
+ *  Appends a gate to the primary outputs of the circuit, growing their list
+ *
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  int     index       - the output gate
+ *  @return nothing
+ */
+void appendPrimaryOutput( CIRCUIT_INFO* info, int index )
+{
+    if(info->numPO == info->outputCapacity)
+    {
+        info->outputCapacity = (info->outputCapacity < 64) ? 64 : 2 * info->outputCapacity;
+        info->outputs = growCircuitArray(info->outputs, info->outputCapacity, sizeof(int32_t));
+    }
+    info->outputs[info->numPO++] = index;
+}
 
-    // TODO drop the assumption that the hash table is not full
-    while(hashTableGates[K].strKey != NULL) K = (K + 1) % MAX_GATES;
+/*
+ *  Appends the connection from the gate at <from> to an input of the gate at
+ *  <to>. Connections are kept in the order they are appended until
+ *  finalizeCircuit builds the fanin and fanout lists.
+ *
+ *  @param  CIRCUIT* circuit - the circuit being populated
+ *  @param  int     from    - the driving gate
+ *  @param  int     to      - the driven gate
+ *  @return nothing
+ */
+void appendConnection( CIRCUIT* circuit, int from, int to )
+{
+    if(circuit->numEdges == circuit->edgeCapacity)
+    {
+        int capacity = (circuit->edgeCapacity < 1024) ? 1024 : 2 * circuit->edgeCapacity;
+        circuit->edgeFrom = growCircuitArray(circuit->edgeFrom, capacity, sizeof(int32_t));
+        circuit->edgeTo   = growCircuitArray(circuit->edgeTo, capacity, sizeof(int32_t));
+        circuit->edgeCapacity = capacity;
+    }
+
+    circuit->edgeFrom[circuit->numEdges] = from;
+    circuit->edgeTo[circuit->numEdges]   = to;
+    circuit->numEdges++;
+}
 
-    hashTableGates[K].strKey = (char*) malloc(sizeof(name) + 1);
-    strcpy(hashTableGates[K].strKey, name);
-    hashTableGates[K].intKey = (*total) - 1;
+/*
+ *  Allocates the fanin and fanout lists of a circuit with <numEdges>
+ *  connections. Only the first <numGates> + 1 list positions are set.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @param  int     numEdges - total fanin (and fanout) connections
+ *  @return nothing
+ */
+void allocateConnections( CIRCUIT* circuit, int numGates, int numEdges )
+{
+    // Never allocate zero bytes so that a built circuit has every list
+    circuit->faninStart  = growCircuitArray(NULL, numGates + 1, sizeof(int32_t));
+    circuit->fanoutStart = growCircuitArray(NULL, numGates + 1, sizeof(int32_t));
+    circuit->fanin       = growCircuitArray(NULL, numEdges + 1, sizeof(int32_t));
+    circuit->faninBranch = growCircuitArray(NULL, numEdges + 1, sizeof(int32_t));
+    circuit->fanout      = growCircuitArray(NULL, numEdges + 1, sizeof(int32_t));
+    circuit->branchValue = growCircuitArray(NULL, numEdges + 1, sizeof(uint8_t));
+    circuit->numEdges    = numEdges;
+    memset(circuit->branchValue, X, numEdges);
+}
+
+/*
+ *  Builds the fanin and fanout lists from the connections appended while the
+ *  netlist was read. The connections of every gate keep their order.
+ *
+ *  @param  CIRCUIT* circuit - the circuit being populated
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return nothing
+ */
+void finalizeCircuit( CIRCUIT* circuit, int numGates )
+{
+    int32_t* edgeFrom = circuit->edgeFrom;
+    int32_t* edgeTo   = circuit->edgeTo;
+    int K, numEdges = circuit->numEdges;
+
+    reserveCircuit(circuit, numGates);
+    allocateConnections(circuit, numGates, numEdges);
+
+    // Count the connections of every gate and turn the counts into the end of
+    // each list, then fill the lists backwards, which moves every end back to
+    // the start of its list. Both ends of a connection are placed together, so
+    // every input learns the position of the fan out segment feeding it.
+    bzero(circuit->faninStart, (numGates + 1) * sizeof(int32_t));
+    bzero(circuit->fanoutStart, (numGates + 1) * sizeof(int32_t));
+    for(K = 0; K < numEdges; K++)
+    {
+        circuit->faninStart[edgeTo[K] + 1]++;
+        circuit->fanoutStart[edgeFrom[K] + 1]++;
+    }
+    for(K = 0; K < numGates; K++)
+    {
+        circuit->faninStart[K + 1]  += circuit->faninStart[K];
+        circuit->fanoutStart[K + 1] += circuit->fanoutStart[K];
+    }
+    int in, out;
+    for(K = numEdges - 1; K >= 0; K--)
+    {
+        in  = --circuit->faninStart[edgeTo[K] + 1];
+        out = --circuit->fanoutStart[edgeFrom[K] + 1];
+        circuit->fanin[in]       = edgeFrom[K];
+        circuit->faninBranch[in] = out;
+        circuit->fanout[out]     = edgeTo[K];
+    }
+    for(K = 0; K < numGates; K++)
+    {
+        circuit->faninStart[K]  = circuit->faninStart[K + 1];
+        circuit->fanoutStart[K] = circuit->fanoutStart[K + 1];
+    }
+    circuit->faninStart[numGates]  = numEdges;
+    circuit->fanoutStart[numGates] = numEdges;
+    selectGateKernels(circuit, numGates);
+
+    free(edgeFrom);
+    free(edgeTo);
+    circuit->edgeFrom = NULL;
+    circuit->edgeTo   = NULL;
+    circuit->edgeCapacity = 0;
+}
+
+/*
+ *  Finds the fan out segment feeding every input from complete fanin and
+ *  fanout lists. The n-th connection between two gates in the fanout list of
+ *  the driving gate feeds the n-th such input of the driven gate.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return BOOLEAN - TRUE if the lists match each other, FALSE otherwise
+ */
+BOOLEAN indexFaninBranches( CIRCUIT* circuit, int numGates )
+{
+    int K, L, N, sink;
+
+    for(K = 0; K < circuit->numEdges; K++) circuit->faninBranch[K] = -1;
+
+    for(K = 0; K < numGates; K++)
+        for(L = circuit->fanoutStart[K]; L < circuit->fanoutStart[K + 1]; L++)
+        {
+            sink = circuit->fanout[L];
+            if(sink < 0 || sink >= numGates) return FALSE;
+
+            for(N = circuit->faninStart[sink]; N < circuit->faninStart[sink + 1]; N++)
+                if(circuit->fanin[N] == K && circuit->faninBranch[N] < 0) break;
+            if(N == circuit->faninStart[sink + 1]) return FALSE;
+
+            circuit->faninBranch[N] = L;
+        }
 
     return TRUE;
 }
 
+/*
+ *  Chooses the evaluation kernel of every gate from its type, inversion and
+ *  number of inputs, once the fanin lists are complete. The wide gates count
+ *  their inputs fed by fan out segments and every input as X.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return nothing
+ */
+void selectGateKernels( CIRCUIT* circuit, int numGates )
+{
+    int K, L;
+    for(K = 0; K < numGates; K++)
+    {
+        circuit->kernel[K] = selectGateKernel((GATE_TYPE) circuit->type[K],
+                                              (BOOLEAN) circuit->inv[K], NUM_FANIN(circuit, K));
+        if(KERNEL_ARITY(circuit->kernel[K]) != KERNEL_MANY) continue;
+
+        INPUT_COUNTS(circuit, K)[BRANCH_INPUTS] = 0;
+        for(L = 0; L < NUM_FANIN(circuit, K); L++)
+            if(NUM_FANOUT(circuit, FANIN(circuit, K, L)) > 1)
+                INPUT_COUNTS(circuit, K)[BRANCH_INPUTS]++;
+        resetInputCounts(circuit, K);
+    }
+}
+
 /*
  *  Reads circuit gates from a netlist stored in <filename> and populates the
  *  <circuit> with the netlist
  *
- *  @param  CIRCUIT circuit     - an empty circuit to be populated
+ *  @param  CIRCUIT* circuit   - an empty circuit to be populated
  *  @param  CIRCUIT_INFO* info  - summary of circuit details
  *  @param  char*   filename    - the filename storing the netlist
  *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
  */
-BOOLEAN populateCircuit( CIRCUIT circuit, CIRCUIT_INFO* info, char* filename )
+BOOLEAN populateCircuit( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename )
 {
-    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
-    extern volatile COMMAND_LINE_OPTIONS options;
-
-    FILE* fp = fopen(filename, "r");
+    FILE* fp = openDataFile(filename, "r");
     if(fp == NULL) return FALSE;
 
-    char line[MAX_LINE_LENGTH];
+    char* line         = NULL;
+    char* tempLine     = NULL;
+    size_t lineCapacity = 0, tempCapacity = 0;
     char* tempBuffer   = NULL;
     char* tempName     = NULL;
+    char* tempType     = NULL;
     BOOLEAN outputSeen = FALSE; // True if at least one output gate has been parsed
     BOOLEAN isPseudo   = FALSE;
-    int index, index2, dff;
+    BOOLEAN isDFF;
+    int index;
     char* in;
 
-    while(fgets(line, MAX_LINE_LENGTH, fp) != NULL)
+    while(getline(&line, &lineCapacity, fp) != -1)
     {
         if(strstr(line, "#")) continue;     // Comment line
         else if(strstr(line, "INPUT"))      // Input gate
@@ -108,39 +400,8 @@ BOOLEAN populateCircuit( CIRCUIT circuit, CIRCUIT_INFO* info, char* filename )
             tempBuffer++;
             *strstr(tempBuffer, ")") = 0;
 
-            // Check if PPI is the same as one of the existing POs
-            BOOLEAN found = FALSE;
-            index = findIndex(circuit, &(info->numGates), tempBuffer, FALSE);
-
-            // Check if the gate is a pseudo gate
-            if(outputSeen && (index < info->numGates) && circuit[index]->PO)
-            {
-                circuit[index]->PO = FALSE;
-                found = TRUE;
-            }
-
-            // Append a new input gate and initialize its details
-            index = info->numGates;
-            appendNewGate(circuit, &(info->numGates), tempBuffer);
-
-            circuit[index]->level = 0;
-
-            if(isPseudo)
-            {
-                circuit[index]->type = PPI;
-                info->numPPI++;
-            }
-            else
-            {
-                circuit[index]->type = PI;
-                info->inputs[info->numPI] = index;
-                info->numPI++;
-            }
-
-            if (found) circuit[index]->PO = 1;
-            circuit[index]->PPO    = 0;
-
-            if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+            declareInputGate(circuit, info, tempBuffer, strlen(tempBuffer),
+                             outputSeen, isPseudo);
         }
         else if(strstr(line, "OUTPUT"))     // Output gate
         {
@@ -152,221 +413,517 @@ BOOLEAN populateCircuit( CIRCUIT circuit, CIRCUIT_INFO* info, char* filename )
             tempBuffer++;
             *strstr(tempBuffer, ")") = 0;
 
-            // Append new output gate and initialize its details
-            index = info->numGates;
-            appendNewGate(circuit, &(info->numGates), tempBuffer);
-
-            if(isPseudo)
-            {
-                circuit[index]->PPO = 1;
-                info->numPPO++;
-                circuit[index]->PO = 0;
-            }
-            else
-            {
-                circuit[index]->PO = 1;
-                info->outputs[info->numPO] = index;
-                info->numPO++;
-                circuit[index]->PPO = 0;
-            }
-
-            if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+            declareOutputGate(circuit, info, tempBuffer, strlen(tempBuffer), isPseudo);
         }
         else if(strstr(line, "="))  // Inner gate
         {
             // Extract gate's name
-            tempBuffer = (char *) malloc(sizeof(char)*MAX_LINE_LENGTH);
-            tempName   = (char *) malloc(sizeof(char)*MAX_LINE_LENGTH);
+            if(tempCapacity < lineCapacity)
+            {
+                tempCapacity = lineCapacity;
+                if((tempLine = (char*) realloc(tempLine, tempCapacity)) == NULL)
+                {
+                    errno = ENOMEM;
+                    exit(1);
+                }
+            }
+            strcpy(tempLine, line);
+            tempName = tempLine;
+            *strstr(tempName, " ") = 0;
 
-            strcpy(tempBuffer, line);
-            *strstr(tempBuffer, " ") = 0;
+            // Extract gate's type
+            tempType = strstr(line, "=");
+            tempType += 2;
+            *strstr(tempType, "(") = 0;
 
-            strcpy(tempName, tempBuffer);
-            index = findIndex(circuit, &(info->numGates), tempBuffer , TRUE);
+            index = declareInnerGate(circuit, info, tempName, strlen(tempName),
+                                     tempType, strlen(tempType), &isDFF);
 
+            // Get all inputs and set output of those nodes
+            tempBuffer = tempType + strlen(tempType) + 1;
+            *strstr(tempBuffer, ")") = 0;
 
-            // Check if gate is valid
-            if ((index < info->numGates) && ((circuit[index]->type == PI) ||
-                (circuit[index]->type == PPI)))
+            while((in = strtok_r(tempBuffer, ",", &tempBuffer)))
             {
-                sprintf(ERROR_MESSAGE,
-                        "Node %s (id:%d), which is a PI/PPI, is at the output"
-                        " of a gate!", circuit[index]->name, index);
-                errno = ERROR_PARSING_CIRCUIT;
-                exit(1);
+                if(*in == ' ') in++;
+                connectGateInput(circuit, info, index, in, strlen(in), isDFF);
             }
+            if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+        }
+    }
+    fclose(fp);
+    free(line);
+    free(tempLine);
 
-            // Determine gate's type
-            strcpy(tempBuffer, line);
-            tempBuffer = strstr(tempBuffer, "=");
-            tempBuffer += 2;
-            *strstr(tempBuffer, "(") = 0;
+    finalizeCircuit(circuit, info->numGates);
+    return TRUE;
+}
 
-            if( *tempBuffer == 'N' )
-            {
-                circuit[index]->inv = 1;
-                tempBuffer++;
-            }
-            else circuit[index]->inv = 0;
+/*
+ *  Reads circuit gates from a netlist stored in <filename> by mapping the file
+ *  into memory and tokenizing it in a single pass. Gate names are used in place
+ *  inside the mapping until they are stored in the circuit.
+ *
+ *  @param  CIRCUIT* circuit   - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the filename storing the netlist
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN populateCircuitMapped( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename )
+{
+    DATA_FILE file;
+    if(loadDataFile(&file, filename) == FALSE) return FALSE;
 
-            dff = 0;
-            if((strcmp(tempBuffer, "OT") == 0) || (strcmp(tempBuffer, "BUF") == 0))
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = BUF;
-            }
-            else if(strcmp(tempBuffer, "AND") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = AND;
-            }
-            else if(strcmp(tempBuffer, "OR") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = OR;
-            }
-            else if(strcmp(tempBuffer, "PI") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = PI;
-            }
-            else if(strcmp(tempBuffer, "DFF") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                if (index < info->numGates-1)
-                // Found a PO with the same name ===> need to add new PPI
-                {
-                    circuit[index]->PO = 0;
-                    appendNewGate(circuit, &(info->numGates), tempName);
-                    circuit[info->numGates]->type = PPI;
-                    info->numPPI++;
-                    circuit[info->numGates]->PO = TRUE;
+    // An empty netlist is trivially parsed
+    BOOLEAN status = (file.size == 0) ? TRUE : parseNetlistBuffer(circuit, info, file.data, file.size);
 
-                    dff = 1;
-                }
-                else
-                {
-                    circuit[index]->type = PPI;
-                    info->numPPI++;
-                    dff = 1;
-                }
-            }
-            else if(strcmp(tempBuffer, "XOR") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = XOR;
-            }
-            else if(strcmp(tempBuffer, "XNOR") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = XOR;
-                circuit[index]->inv = 1;
-            }
-            else if(strcmp(tempBuffer, "PPI") == 0)
-            {
-                if ((circuit[index]->PO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PO = 0;
-                if ((circuit[index]->PPO != 1) ||
-                    (circuit[index]->type != OTHER)) circuit[index]->PPO = 0;
-                circuit[index]->type = PPI;
-            }
-            else
-            {
-                sprintf(ERROR_MESSAGE,
-                        "Unknown gate type \"%s\" encountered!", tempBuffer);
-                errno = ERROR_PARSING_CIRCUIT;
-                exit(1);
-            }
+    releaseDataFile(&file);
+    return status;
+}
 
-            // Get all inputs and set output of those nodes
-            tempBuffer = strstr(line, "(");
-            tempBuffer++;
-            *strstr(tempBuffer, ")") = 0;
+/*
+ *  Returns TRUE for the blank characters separating netlist tokens
+ */
+static inline BOOLEAN isNetlistBlank( char c )
+{
+    return (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f');
+}
 
+/*
+ *  Trims the blank characters around the token [*start, *end)
+ */
+static inline void trimNetlistToken( const char** start, const char** end )
+{
+    while(*start < *end && isNetlistBlank(**start)) (*start)++;
+    while(*end > *start && isNetlistBlank(*(*end - 1))) (*end)--;
+}
 
-            while((in = strtok_r(tempBuffer, ",", &tempBuffer)))
-            {
-                if(*in == ' ') in++;
-                index2 = findIndex(circuit, &(info->numGates), in , TRUE);
+/*
+ *  Checks if the line starting at <p> is a declaration with the given keyword
+ *  and returns the position after the keyword's opening parenthesis
+ */
+static const char* matchNetlistKeyword( const char* p, const char* end,
+                                        const char* keyword, int len )
+{
+    if(end - p <= len || memcmp(p, keyword, len) != 0) return NULL;
+    p += len;
+    while(p < end && isNetlistBlank(*p)) p++;
+    if(p == end || *p != '(') return NULL;
+    return (p + 1);
+}
 
-                // Error check
-                if ((index2 < info->numGates) && ((circuit[index2]->PO) ||
-                    (circuit[index2]->PPO)))
-                {
-                    sprintf(ERROR_MESSAGE,
-                        "Node %s (id:%d), which is a PO/PPO, is feeding gate"
-                        " %s (id:%d)",
-                        circuit[index2]->name, index2, circuit[index]->name, index);
-                    errno = ERROR_PARSING_CIRCUIT;
-                    exit(1);
-                }
+/*
+ *  Splits a netlist line into its declaration parts. Comments start with '#'
+ *  and run until the end of the line.
+ *
+ *  @param  const char* p       - the first character of the line
+ *  @param  const char* eol     - the end of the line (excluding the new line)
+ *  @param  NETLIST_LINE* line  - receives the parts of the declaration
+ *  @return NETLIST_LINE_TYPE - the kind of the line
+ */
+NETLIST_LINE_TYPE tokenizeNetlistLine( const char* p, const char* eol, NETLIST_LINE* line )
+{
+    const char *stop, *lparen, *name, *nameEnd, *tok, *tokEnd;
 
-                // Update input of created node
-                if (!dff)
-                {
-                    circuit[index]->in[circuit[index]->numIn] = index2;
-                    (circuit[index]->numIn)++;
-                }
+    // Drop comments and surrounding blanks
+    stop = (const char*) memchr(p, '#', eol - p);
+    if(stop == NULL) stop = eol;
+    trimNetlistToken(&p, &stop);
+    line->start = p;
+    line->end   = stop;
+    line->type  = NETLIST_BLANK;
+    if(p == stop) return line->type;
 
-                if (circuit[index]->numIn > MAX_INPUT_GATES)
-                {
-                    sprintf(ERROR_MESSAGE, "Too many inputs to gate %s",
-                        circuit[index]->name);
-                    errno = ERROR_IO_LIMIT_EXCEEDED;
-                    exit(1);
-                }
+    line->type = NETLIST_MALFORMED;
+    if((lparen = matchNetlistKeyword(p, stop, "INPUT", 5)) != NULL ||
+       (lparen = matchNetlistKeyword(p, stop, "OUTPUT", 6)) != NULL)    // Input or output gate
+    {
+        if(stop[-1] != ')') return line->type;
+        name = lparen; nameEnd = stop - 1;
+        trimNetlistToken(&name, &nameEnd);
+        line->name    = name;
+        line->nameLen = nameEnd - name;
+        line->type    = (*p == 'I') ? NETLIST_INPUT : NETLIST_OUTPUT;
+        return line->type;
+    }
 
-                // Update output of listed node
-                if (!dff)
-                {
-                    circuit[index2]->out[circuit[index2]->numOut] = index;
-                    (circuit[index2]->numOut)++;
-                }
-                else
-                {
-                    circuit[index2]->PPO = TRUE;
-                    info->numPPO++;
-                }
+    // Inner gate: <name> = <type>(<input>, <input>, ...)
+    nameEnd = (const char*) memchr(p, '=', stop - p);
+    if(nameEnd == NULL) return line->type;
+    lparen = (const char*) memchr(nameEnd, '(', stop - nameEnd);
+    if(lparen == NULL || stop[-1] != ')') return line->type;
 
-                if (circuit[index2]->numOut > MAX_OUTPUT_GATES)
-                {
-                    sprintf(ERROR_MESSAGE, "Too many outputs from gate %s",
-                        circuit[index]->name);
-                    errno = ERROR_IO_LIMIT_EXCEEDED;
-                    exit(1);
-                }
-            }
-            if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+    name = p;
+    tok = nameEnd + 1; tokEnd = lparen;
+    trimNetlistToken(&name, &nameEnd);
+    trimNetlistToken(&tok, &tokEnd);
+    if(name == nameEnd || tok == tokEnd) return line->type;
+
+    line->name        = name;
+    line->nameLen     = nameEnd - name;
+    line->gateType    = tok;
+    line->gateTypeLen = tokEnd - tok;
+    line->inputs      = lparen + 1;
+    line->inputsEnd   = stop - 1;
+
+    // Every comma separated input must be named
+    for(tok = line->inputs; tok < line->inputsEnd; tok = tokEnd + 1)
+    {
+        tokEnd = (const char*) memchr(tok, ',', line->inputsEnd - tok);
+        if(tokEnd == NULL) tokEnd = line->inputsEnd;
+        name = tok; nameEnd = tokEnd;
+        trimNetlistToken(&name, &nameEnd);
+        if(name == nameEnd) return line->type;
+    }
+
+    line->type = NETLIST_GATE;
+    return line->type;
+}
+
+/*
+ *  Extracts the next input name of an inner gate declaration
+ *
+ *  @param  const char** tok    - the position to continue from, updated on return
+ *  @param  const char* end     - the end of the declaration's inputs
+ *  @param  const char** name   - receives the input's name
+ *  @param  int*    len         - receives the length of the input's name
+ *  @return BOOLEAN - TRUE if an input was extracted, FALSE at the end of the inputs
+ */
+BOOLEAN nextNetlistInput( const char** tok, const char* end, const char** name, int* len )
+{
+    if(*tok >= end) return FALSE;
+
+    const char* tokEnd = (const char*) memchr(*tok, ',', end - *tok);
+    if(tokEnd == NULL) tokEnd = end;
+
+    const char* nameEnd = tokEnd;
+    *name = *tok;
+    trimNetlistToken(name, &nameEnd);
+    *len = nameEnd - *name;
+
+    *tok = tokEnd + 1;
+    return TRUE;
+}
+
+/*
+ *  Reports a malformed line of a netlist buffer and terminates the program
+ *
+ *  @param  NETLIST_LINE* line  - the malformed line
+ *  @param  int     lineNumber  - the line's number in the netlist
+ *  @return nothing
+ */
+void reportMalformedNetlistLine( NETLIST_LINE* line, int lineNumber )
+{
+    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+    int len = (int) (line->end - line->start);
+    if(len > 64) len = 64;
+    sprintf(ERROR_MESSAGE, "Malformed netlist line %d: \"%.*s\"", lineNumber, len, line->start);
+    errno = ERROR_PARSING_CIRCUIT;
+    exit(1);
+}
+
+/*
+ *  Tokenizes a netlist held in memory and populates the <circuit> with it. The
+ *  buffer is read in a single pass and never modified, so it can be a read-only
+ *  file mapping.
+ *
+ *  @param  CIRCUIT* circuit   - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* data    - the netlist's text
+ *  @param  size_t  size        - number of characters in <data>
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN parseNetlistBuffer( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* data, size_t size )
+{
+    const char* p   = data;
+    const char* end = data + size;
+    const char *eol, *tok, *name;
+    NETLIST_LINE line;
+    BOOLEAN outputSeen = FALSE; // True if at least one output gate has been parsed
+    BOOLEAN isPseudo   = FALSE;
+    BOOLEAN isDFF;
+    int index, len, lineNumber = 0;
+
+    for(; p < end; p = eol + 1)
+    {
+        lineNumber++;
+        eol = (const char*) memchr(p, '\n', end - p);
+        if(eol == NULL) eol = end;
+
+        switch(tokenizeNetlistLine(p, eol, &line))
+        {
+            case NETLIST_BLANK:
+                break;
+            case NETLIST_MALFORMED:
+                reportMalformedNetlistLine(&line, lineNumber);
+                break;
+            case NETLIST_INPUT:     // Input gate
+                declareInputGate(circuit, info, line.name, line.nameLen, outputSeen, isPseudo);
+                break;
+            case NETLIST_OUTPUT:    // Output gate
+                outputSeen = TRUE;
+                declareOutputGate(circuit, info, line.name, line.nameLen, isPseudo);
+                break;
+            case NETLIST_GATE:      // Inner gate
+                index = declareInnerGate(circuit, info, line.name, line.nameLen,
+                                         line.gateType, line.gateTypeLen, &isDFF);
+
+                // Connect the comma separated inputs
+                tok = line.inputs;
+                while(nextNetlistInput(&tok, line.inputsEnd, &name, &len))
+                    connectGateInput(circuit, info, index, name, len, isDFF);
+
+                if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+                break;
         }
+
+        if(eol == end) break;
     }
-    // free(tempBuffer);
-    // free(tempName);
-    fclose(fp);
+
+    finalizeCircuit(circuit, info->numGates);
+    return TRUE;
+}
+
+/*
+ *  Appends a primary input (or pseudo primary input) gate to the circuit
+ *
+ *  @param  CIRCUIT* circuit   - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* name    - the gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the gate's name
+ *  @param  BOOLEAN outputSeen  - TRUE if an output gate was declared before
+ *  @param  BOOLEAN isPseudo    - TRUE if the input is a pseudo primary input
+ *  @return int - the index of the new gate
+ */
+int declareInputGate( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* name, int len,
+                      BOOLEAN outputSeen, BOOLEAN isPseudo )
+{
+    // Check if PPI is the same as one of the existing POs
+    BOOLEAN found = FALSE;
+    int index = findIndexLen(circuit, &(info->numGates), name, len, FALSE);
+
+    // Check if the gate is a pseudo gate
+    if(outputSeen && (index < info->numGates) && circuit->PO[index])
+    {
+        circuit->PO[index] = FALSE;
+        found = TRUE;
+    }
+
+    // Append a new input gate and initialize its details
+    index = info->numGates;
+    appendNewGateLen(circuit, &(info->numGates), name, len);
+
+    circuit->level[index] = 0;
+
+    if(isPseudo)
+    {
+        circuit->type[index] = PPI;
+        info->numPPI++;
+    }
+    else
+    {
+        circuit->type[index] = PI;
+        appendPrimaryInput(info, index);
+    }
+
+    if (found) circuit->PO[index] = 1;
+    circuit->PPO[index]    = 0;
+
+    if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+
+    return index;
+}
+
+/*
+ *  Appends a primary output (or pseudo primary output) gate to the circuit
+ *
+ *  @param  CIRCUIT* circuit   - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* name    - the gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the gate's name
+ *  @param  BOOLEAN isPseudo    - TRUE if the output is a pseudo primary output
+ *  @return int - the index of the new gate
+ */
+int declareOutputGate( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* name, int len,
+                       BOOLEAN isPseudo )
+{
+    // Append new output gate and initialize its details
+    int index = info->numGates;
+    appendNewGateLen(circuit, &(info->numGates), name, len);
+
+    if(isPseudo)
+    {
+        circuit->PPO[index] = 1;
+        info->numPPO++;
+        circuit->PO[index] = 0;
+    }
+    else
+    {
+        circuit->PO[index] = 1;
+        appendPrimaryOutput(info, index);
+        circuit->PPO[index] = 0;
+    }
+
+    if(options.isDebugMode && options.debugLevel > 2) printGateInfo(circuit, index);
+
+    return index;
+}
+
+/*
+ *  Determines the gate type from its name in a netlist (AND, NAND, OR, NOR, BUF,
+ *  NOT, XOR, XNOR, DFF, ...)
+ *
+ *  @param  const char* type    - the gate's type name (not necessarily null terminated)
+ *  @param  int     typeLen     - length of the gate's type name
+ *  @param  GATE_TYPE* gateType - receives the gate's type
+ *  @param  BOOLEAN* inv        - receives TRUE if the gate is inverted
+ *  @param  BOOLEAN* isDFF      - receives TRUE if the gate is a flip-flop
+ *  @return BOOLEAN - TRUE if the type is known, FALSE otherwise
+ */
+BOOLEAN parseGateType( const char* type, int typeLen, GATE_TYPE* gateType,
+                       BOOLEAN* inv, BOOLEAN* isDFF )
+{
+    if(typeLen > 0 && *type == 'N')
+    {
+        *inv = TRUE;
+        type++;
+        typeLen--;
+    }
+    else *inv = FALSE;
+
+    *isDFF = FALSE;
+    if((typeLen == 2 && memcmp(type, "OT", 2) == 0) || (typeLen == 3 && memcmp(type, "BUF", 3) == 0))
+        *gateType = BUF;
+    else if(typeLen == 3 && memcmp(type, "AND", 3) == 0)
+        *gateType = AND;
+    else if(typeLen == 2 && memcmp(type, "OR", 2) == 0)
+        *gateType = OR;
+    else if(typeLen == 2 && memcmp(type, "PI", 2) == 0)
+        *gateType = PI;
+    else if(typeLen == 3 && memcmp(type, "DFF", 3) == 0)
+    {
+        *gateType = PPI;
+        *isDFF = TRUE;
+    }
+    else if(typeLen == 3 && memcmp(type, "XOR", 3) == 0)
+        *gateType = XOR;
+    else if(typeLen == 4 && memcmp(type, "XNOR", 4) == 0)
+    {
+        *gateType = XOR;
+        *inv = TRUE;
+    }
+    else if(typeLen == 3 && memcmp(type, "PPI", 3) == 0)
+        *gateType = PPI;
+    else
+        return FALSE;
 
     return TRUE;
 }
 
+/*
+ *  Finds or creates the gate driven by an inner gate declaration and sets its
+ *  type from the given type name (AND, NAND, OR, NOR, BUF, NOT, DFF, ...)
+ *
+ *  @param  CIRCUIT* circuit   - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* name    - the gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the gate's name
+ *  @param  const char* type    - the gate's type name (not necessarily null terminated)
+ *  @param  int     typeLen     - length of the gate's type name
+ *  @param  BOOLEAN* isDFF      - set to TRUE if the gate is a flip-flop
+ *  @return int - the index of the declared gate
+ */
+int declareInnerGate( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* name, int len,
+                      const char* type, int typeLen, BOOLEAN* isDFF )
+{
+    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+
+    int index = findIndexLen(circuit, &(info->numGates), name, len, TRUE);
+
+    // Check if gate is valid
+    if ((index < info->numGates) && ((circuit->type[index] == PI) ||
+        (circuit->type[index] == PPI)))
+    {
+        snprintf(ERROR_MESSAGE, MAX_LINE_LENGTH,
+                "Node %s (id:%d), which is a PI/PPI, is at the output"
+                " of a gate!", GATE_NAME(circuit, index), index);
+        errno = ERROR_PARSING_CIRCUIT;
+        exit(1);
+    }
+
+    // Determine gate's type
+    BOOLEAN inv;
+    GATE_TYPE gateType;
+    if(parseGateType(type, typeLen, &gateType, &inv, isDFF) == FALSE)
+    {
+        if(typeLen > 0 && *type == 'N')
+        {
+            type++;
+            typeLen--;
+        }
+        snprintf(ERROR_MESSAGE, MAX_LINE_LENGTH,
+                "Unknown gate type \"%.*s\" encountered!", typeLen, type);
+        errno = ERROR_PARSING_CIRCUIT;
+        exit(1);
+    }
+    circuit->inv[index] = inv;
+
+    // Output flags survive only the first definition of a declared output
+    if ((circuit->PO[index] != 1) ||
+        (circuit->type[index] != OTHER)) circuit->PO[index] = 0;
+    if ((circuit->PPO[index] != 1) ||
+        (circuit->type[index] != OTHER)) circuit->PPO[index] = 0;
+
+    if(*isDFF && index < info->numGates-1)
+    {
+        // Found a PO with the same name ===> need to add new PPI
+        circuit->PO[index] = 0;
+        appendNewGateLen(circuit, &(info->numGates), name, len);
+        circuit->type[info->numGates-1] = PPI;
+        circuit->PO[info->numGates-1] = TRUE;
+        info->numPPI++;
+    }
+    else
+    {
+        circuit->type[index] = gateType;
+        if(*isDFF) info->numPPI++;
+    }
+
+    return index;
+}
+
+/*
+ *  Connects the gate named <name> to the input of the gate at <index>. Inputs of
+ *  a flip-flop are marked as pseudo primary outputs instead of being connected.
+ *
+ *  @param  CIRCUIT* circuit   - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  int     index       - the gate whose input is being connected
+ *  @param  const char* name    - the input gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the input gate's name
+ *  @param  BOOLEAN isDFF       - TRUE if the gate at <index> is a flip-flop
+ *  @return int - the index of the input gate
+ */
+int connectGateInput( CIRCUIT* circuit, CIRCUIT_INFO* info, int index,
+                      const char* name, int len, BOOLEAN isDFF )
+{
+    int index2 = findIndexLen(circuit, &(info->numGates), name, len, TRUE);
+
+    // A PO/PPO may also feed further gates, as DATA_9_31 does in s35932
+    if (isDFF)
+    {
+        if (!circuit->PPO[index2])
+            info->numPPO++;
+        circuit->PPO[index2] = TRUE;
+        return index2;
+    }
+
+    // Update input of created node and output of listed node
+    appendConnection(circuit, index2, index);
+
+    return index2;
+}
+
 /*
  *  Compute gate levels in the entire circuit
  *
@@ -374,18 +931,59 @@ BOOLEAN populateCircuit( CIRCUIT circuit, CIRCUIT_INFO* info, char* filename )
  *  @param  info    - gate information object
  *  @return nothing
  */
-void computeGateLevels(CIRCUIT circuit, CIRCUIT_INFO* info)
+void computeGateLevels(CIRCUIT* circuit, CIRCUIT_INFO* info)
 {
     int K, level;
     for(K = 0; K < info->numGates; K++)
     {
         // Skipping PI and already computed gates
-        if(circuit[K]->level < 0)
+        if(circuit->level[K] < 0)
         {
             level = computeGateLevel(circuit, K);
-            circuit[K]->level = level;
+            circuit->level[K] = level;
         }
     }
+
+    computeEvaluationOrder(circuit, info->numGates);
+}
+
+/*
+ *  Sorts the gates by level into the circuit's evaluation order. Gates of the
+ *  same level keep the order of their numbers. The event queue of the circuit
+ *  is sized for the same levels.
+ *
+ *  @param  circuit - the circuit, whose gate levels are already computed
+ *  @param  numGates - total number of gates in the circuit
+ *  @return BOOLEAN TRUE if the order was built and FALSE if a level is missing
+ */
+BOOLEAN computeEvaluationOrder(CIRCUIT* circuit, int numGates)
+{
+    int K, maxLevel = 0;
+    for(K = 0; K < numGates; K++)
+    {
+        if(circuit->level[K] < 0) return FALSE;
+        if(circuit->level[K] > maxLevel) maxLevel = circuit->level[K];
+    }
+
+    // Count the gates of every level, then turn the counts into positions
+    int* position = (int*) calloc((size_t) maxLevel + 2, sizeof(int));
+    if(position == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    for(K = 0; K < numGates; K++)
+        position[circuit->level[K] + 1]++;
+    for(K = 1; K <= maxLevel; K++)
+        position[K] += position[K - 1];
+
+    for(K = 0; K < numGates; K++)
+        circuit->order[position[circuit->level[K]]++] = K;
+    free(position);
+
+    // Event-driven simulation queues gates by the same levels
+    buildEventQueue(&circuit->events, circuit->level, numGates);
+    return TRUE;
 }
 
 /*
@@ -395,15 +993,15 @@ void computeGateLevels(CIRCUIT circuit, CIRCUIT_INFO* info)
  *  @param  index - gate index of interest
  *  @return int - the gate's level
  */
-int computeGateLevel(CIRCUIT circuit, int index)
+int computeGateLevel(CIRCUIT* circuit, int index)
 {
-    if(circuit[index]->level >= 0) return circuit[index]->level;
+    if(circuit->level[index] >= 0) return circuit->level[index];
     else
     {
         int K, temp, level = -1;
-        for(K = 0; K < circuit[index]->numIn; K++)
+        for(K = 0; K < NUM_FANIN(circuit, index); K++)
         {
-            temp = computeGateLevel(circuit, circuit[index]->in[K]);
+            temp = computeGateLevel(circuit, FANIN(circuit, index, K));
             if(temp > level) level = temp;
         }
         return (level+1);
@@ -413,43 +1011,120 @@ int computeGateLevel(CIRCUIT circuit, int index)
 /*
  *  Finds the first occurence of the given gate's <name> in the <circuit>
  *
- *  @param  CIRCUIT circuit - the circuit to search
+ *  @param  CIRCUIT* circuit - the circuit to search
  *  @param  int* totalGates - total number of gates currently in the circuit
  *  @param  char*   name    - gate's name to search for
  *  @param  BOOLEAN init    - flag to initialize a new gate if none was found
  *  @return int - the index of the gate in the <circuit>
  */
-int findIndex( CIRCUIT circuit, int* totalGates, char* name, BOOLEAN init )
+int findIndex( CIRCUIT* circuit, int* totalGates, char* name, BOOLEAN init )
 {
-    extern HASH_ENTRY hashTableGates[MAX_GATES];
-    int K = hashStringToInt(name, MAX_GATES);
-
-    while(TRUE)
-    {
-        if(hashTableGates[K].strKey == NULL)
-            break;
-        else if(strcmp(hashTableGates[K].strKey, name) == 0)
-            return hashTableGates[K].intKey;
+    return findIndexLen(circuit, totalGates, name, strlen(name), init);
+}
 
-        K = (K+1) % MAX_GATES;
-    }
+/*
+ *  Finds the first occurence of the gate named by the first <len> characters of
+ *  <name> in the <circuit>
+ *
+ *  @param  CIRCUIT* circuit - the circuit to search
+ *  @param  int* totalGates - total number of gates currently in the circuit
+ *  @param  const char* name - gate's name to search for (not necessarily null terminated)
+ *  @param  int     len     - length of the gate's name
+ *  @param  BOOLEAN init    - flag to initialize a new gate if none was found
+ *  @return int - the index of the gate in the <circuit>
+ */
+int findIndexLen( CIRCUIT* circuit, int* totalGates, const char* name, int len, BOOLEAN init )
+{
+    int index = findSymbol(&circuit->names, name, len, hashSymbol(name, len));
+    if(index >= 0) return index;
 
     if(init == FALSE) return (*totalGates);
 
-    appendNewGate(circuit, totalGates, name);
+    appendNewGateLen(circuit, totalGates, name, len);
     return ((*totalGates) - 1);
 }
 
 /*
- * Prints the type name of the gate at position <index>
+ *  Computes the memory used by the gates of a circuit, their connections and
+ *  their names
  *
- *  @param  GATE* gate - the gate to be printed
- *  @param  int     index   - the position of the gate in the <circuit>
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return size_t - the number of bytes in use
+ */
+size_t getCircuitMemoryUsage( CIRCUIT* circuit, int numGates )
+{
+    size_t perGate = sizeof(uint32_t) + 7 * sizeof(uint8_t) + 3 * sizeof(int32_t) +
+                     MAX_LOGIC_VALUES * (sizeof(JUST_OBJECT) + sizeof(PROP_OBJECT)) +
+                     INPUT_COUNT_SLOTS * sizeof(int32_t);
+    size_t perEdge = 3 * sizeof(int32_t) + sizeof(uint8_t);
+    size_t buckets = (circuit->events.numLevels > 0) ?
+                     (3 * (size_t) circuit->events.numLevels + 1) * sizeof(int32_t) : 0;
+
+    return (size_t) numGates * perGate + 2 * (size_t) (numGates + 1) * sizeof(int32_t) +
+           (size_t) circuit->numEdges * perEdge + buckets + circuit->names.arenaSize +
+           (size_t) circuit->names.capacity * sizeof(SYMBOL_SLOT);
+}
+
+/*
+ *  Releases the gates of the <circuit> and the gate names table so that
+ *  another netlist can be parsed
+ *
+ *  @param  CIRCUIT* circuit   - the circuit
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
  *  @return nothing
  */
-void printType( GATE* gate )
+void clearCircuit( CIRCUIT* circuit, CIRCUIT_INFO* info )
 {
-    switch(gate->type)
+    // Arrays mapped from a compiled netlist go away with the mapping
+    freeCircuitArray(circuit, circuit->names.slots);
+    freeCircuitArray(circuit, circuit->names.arena);
+    freeCircuitArray(circuit, circuit->events.bucketStart);
+    circuit->names.slots = NULL;
+    circuit->names.arena = NULL;
+    circuit->events.bucketStart = NULL;
+    releaseSymbolTable(&circuit->names);
+    releaseEventQueue(&circuit->events);
+
+    freeCircuitArray(circuit, circuit->nameOffset);
+    freeCircuitArray(circuit, circuit->type);
+    freeCircuitArray(circuit, circuit->inv);
+    freeCircuitArray(circuit, circuit->kernel);
+    freeCircuitArray(circuit, circuit->PO);
+    freeCircuitArray(circuit, circuit->PPO);
+    freeCircuitArray(circuit, circuit->level);
+    freeCircuitArray(circuit, circuit->order);
+    freeCircuitArray(circuit, circuit->value);
+    freeCircuitArray(circuit, circuit->goodValue);
+    freeCircuitArray(circuit, circuit->touched);
+    freeCircuitArray(circuit, circuit->inputCount);
+    freeCircuitArray(circuit, circuit->justified);
+    freeCircuitArray(circuit, circuit->propagated);
+    freeCircuitArray(circuit, circuit->faninStart);
+    freeCircuitArray(circuit, circuit->fanin);
+    freeCircuitArray(circuit, circuit->faninBranch);
+    freeCircuitArray(circuit, circuit->fanoutStart);
+    freeCircuitArray(circuit, circuit->fanout);
+    freeCircuitArray(circuit, circuit->branchValue);
+    freeCircuitArray(circuit, circuit->edgeFrom);
+    freeCircuitArray(circuit, circuit->edgeTo);
+    freeCircuitArray(circuit, info->inputs);
+    freeCircuitArray(circuit, info->outputs);
+    if(circuit->image != NULL) munmap(circuit->image, circuit->imageSize);
+
+    bzero(circuit, sizeof(CIRCUIT));
+    bzero(info, sizeof(CIRCUIT_INFO));
+}
+
+/*
+ * Prints the name of a gate type
+ *
+ *  @param  GATE_TYPE type - the gate type to be printed
+ *  @return nothing
+ */
+void printType( GATE_TYPE type )
+{
+    switch(type)
     {
         case AND:   fprintf(stdout, "AND"); break;
         case OR:    fprintf(stdout, "OR"); break;
@@ -463,41 +1138,68 @@ void printType( GATE* gate )
     }
 }
 
+/*
+ *  Prints the connections of a gate that were appended but are not in its
+ *  fanin or fanout lists yet
+ */
+static void printPendingConnections( CIRCUIT* circuit, int index, const char* label,
+                                     int32_t* gates, int32_t* connected )
+{
+    int K, count = 0;
+    for(K = 0; K < circuit->numEdges; K++)
+        if(gates[K] == index) count++;
+
+    fprintf(stdout, "\n%s: %d\t", label, count);
+    fprintf(stdout, "{");
+    for(K = 0; K < circuit->numEdges; K++)
+        if(gates[K] == index) fprintf(stdout, " %s,", GATE_NAME(circuit, connected[K]));
+    fprintf(stdout, "}");
+}
+
 /*
  *  Print the details of a gate
  *
- *  @param  CIRCUIT circuit - the circuit
+ *  @param  CIRCUIT* circuit - the circuit
  *  @param  int     index   - the position of the gate in the <circuit>
  *  @return nothing
  */
-void printGateInfo( CIRCUIT circuit, int index )
+void printGateInfo( CIRCUIT* circuit, int index )
 {
     fprintf(stdout, "Index: %d\t", index);
-    fprintf(stdout, "Name: %s\t", circuit[index]->name);
+    fprintf(stdout, "Name: %s\t", GATE_NAME(circuit, index));
     fprintf(stdout, "Type: ");
-    printType(circuit[index]);
+    printType(circuit->type[index]);
     fprintf(stdout, "\t");
-    fprintf(stdout, "Inv: %d\t", circuit[index]->inv);
+    fprintf(stdout, "Inv: %d\t", circuit->inv[index]);
 
-    fprintf(stdout, "\nNumIn: %d\t", circuit[index]->numIn);
     int i;
-    fprintf(stdout, "{");
-    for(i = 0; i<(circuit[index]->numIn); i++)
-        fprintf(stdout, " %s,",circuit[circuit[index]->in[i]]->name);
-    fprintf(stdout, "}");
+    if(circuit->faninStart != NULL)
+    {
+        fprintf(stdout, "\nNumIn: %d\t", NUM_FANIN(circuit, index));
+        fprintf(stdout, "{");
+        for(i = 0; i<(NUM_FANIN(circuit, index)); i++)
+            fprintf(stdout, " %s,",GATE_NAME(circuit, FANIN(circuit, index, i)));
+        fprintf(stdout, "}");
 
-    fprintf(stdout, "\nNumOut: %d\t", circuit[index]->numOut);
-    fprintf(stdout, "{");
-    for(i = 0; i<(circuit[index]->numOut); i++)
-        fprintf(stdout, " %s,",circuit[circuit[index]->out[i]]->name);
-    fprintf(stdout, "}");
+        fprintf(stdout, "\nNumOut: %d\t", NUM_FANOUT(circuit, index));
+        fprintf(stdout, "{");
+        for(i = 0; i<(NUM_FANOUT(circuit, index)); i++)
+            fprintf(stdout, " %s,",GATE_NAME(circuit, FANOUT(circuit, index, i)));
+        fprintf(stdout, "}");
+    }
+    else
+    {
+        // The lists are not built yet while the netlist is being read
+        printPendingConnections(circuit, index, "NumIn", circuit->edgeTo, circuit->edgeFrom);
+        printPendingConnections(circuit, index, "NumOut", circuit->edgeFrom, circuit->edgeTo);
+    }
 
-    if(circuit[index]->PO)  fprintf(stdout, "\nThis gate is a PO also");
-    if(circuit[index]->PPO) fprintf(stdout, "\nThis gate is a PPO also");
+    if(circuit->PO[index])  fprintf(stdout, "\nThis gate is a PO also");
+    if(circuit->PPO[index]) fprintf(stdout, "\nThis gate is a PPO also");
 
     // For debugging Justification and Propagation
-    char logValName;
-	switch(circuit[index]->value){
+    char logValName = '?';
+	switch(circuit->value[index]){
 		case O: logValName = 'O'; break;
 		case I: logValName = 'I'; break;
 		case D: logValName = 'D'; break;
@@ -508,15 +1210,15 @@ void printGateInfo( CIRCUIT circuit, int index )
     fprintf(stdout, "\nJustified:  ");
     fprintf(stdout, "{");
     for(i = 0; i<MAX_LOGIC_VALUES; i++)
-        fprintf(stdout, " %d:%d,",circuit[index]->justified[i].state, 
-        		circuit[index]->justified[i].value);
+        fprintf(stdout, " %d:%d,",JUSTIFIED(circuit, index, i).state, 
+        		JUSTIFIED(circuit, index, i).value);
     fprintf(stdout, "}");
 
     fprintf(stdout, "\nPropagated: ");
     fprintf(stdout, "{");
     for(i = 0; i<MAX_LOGIC_VALUES; i++)
-        fprintf(stdout, " %d:%d,",circuit[index]->propagated[i].state, 
-        		circuit[index]->propagated[i].value);
+        fprintf(stdout, " %d:%d,",PROPAGATED(circuit, index, i).state, 
+        		PROPAGATED(circuit, index, i).value);
     fprintf(stdout, "}");
 
     fprintf(stdout, "\n\n");
@@ -525,11 +1227,11 @@ void printGateInfo( CIRCUIT circuit, int index )
 /*
  *  Print the details of a circuit
  *
- *  @param  CIRCUIT circuit - the circuit
+ *  @param  CIRCUIT* circuit - the circuit
  *  @param  int totalGates  - total number of gates currently in the circuit
  *  @return nothing
  */
-void printCircuitInfo( CIRCUIT circuit, int totalGates )
+void printCircuitInfo( CIRCUIT* circuit, int totalGates )
 {
     int index = 0;
     for( ; index < totalGates; index++)
@@ -19,6 +19,8 @@
  * =====================================================================================
  */
 
+#include <stddef.h>
+
 #include "atpg_types.h"
 
 
@@ -26,25 +28,258 @@
 #define CIRCUIT_TRACE_H
 
 
+/*
+ *  Makes room in the gate arrays of the <circuit> for at least <numGates> gates
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - the number of gates the circuit must hold
+ *  @return nothing
+ */
+void reserveCircuit( CIRCUIT* circuit, int numGates );
+
+/*
+ *  Gives the gate at position <index> the name interned with <id> in the gate
+ *  names table. Gates sharing a name share its interned copy.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     index   - the position of the gate in the <circuit>
+ *  @param  int     id      - the id returned by internSymbol for the gate's name
+ *  @param  int     len     - length of the gate's name
+ *  @return nothing
+ */
+void setGateName( CIRCUIT* circuit, int index, int id, int len );
+
 /*
  *  Allocates memory for the gate at location <totalGates>
  *
- *  @param  CIRCUIT circuit - a circuit to be populated
+ *  @param  CIRCUIT* circuit - a circuit to be populated
+ *  @param  int*    total   - total number of gates currently in the circuit
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN appendNewGate( CIRCUIT* circuit, int* total, char* name );
+
+/*
+ *  Allocates memory for the gate at location <totalGates> whose name is given
+ *  by the first <len> characters of <name>
+ *
+ *  @param  CIRCUIT* circuit - a circuit to be populated
  *  @param  int*    total   - total number of gates currently in the circuit
+ *  @param  const char* name - the gate's name (not necessarily null terminated)
+ *  @param  int     len     - length of the gate's name
  *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
  */
-BOOLEAN appendNewGate( CIRCUIT circuit, int* total, char* name );
+BOOLEAN appendNewGateLen( CIRCUIT* circuit, int* total, const char* name, int len );
+
+/*
+ *  Appends a gate to the primary inputs of the circuit, growing their list
+ *
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  int     index       - the input gate
+ *  @return nothing
+ */
+void appendPrimaryInput( CIRCUIT_INFO* info, int index );
+
+/*
+ *  Appends a gate to the primary outputs of the circuit, growing their list
+ *
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  int     index       - the output gate
+ *  @return nothing
+ */
+void appendPrimaryOutput( CIRCUIT_INFO* info, int index );
+
+/*
+ *  Appends the connection from the gate at <from> to an input of the gate at
+ *  <to>. Connections are kept in the order they are appended until
+ *  finalizeCircuit builds the fanin and fanout lists.
+ *
+ *  @param  CIRCUIT* circuit - the circuit being populated
+ *  @param  int     from    - the driving gate
+ *  @param  int     to      - the driven gate
+ *  @return nothing
+ */
+void appendConnection( CIRCUIT* circuit, int from, int to );
+
+/*
+ *  Allocates the fanin and fanout lists of a circuit with <numEdges>
+ *  connections. Only the first <numGates> + 1 list positions are set.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @param  int     numEdges - total fanin (and fanout) connections
+ *  @return nothing
+ */
+void allocateConnections( CIRCUIT* circuit, int numGates, int numEdges );
+
+/*
+ *  Builds the fanin and fanout lists from the connections appended while the
+ *  netlist was read. The connections of every gate keep their order.
+ *
+ *  @param  CIRCUIT* circuit - the circuit being populated
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return nothing
+ */
+void finalizeCircuit( CIRCUIT* circuit, int numGates );
+
+/*
+ *  Finds the fan out segment feeding every input from complete fanin and
+ *  fanout lists. The n-th connection between two gates in the fanout list of
+ *  the driving gate feeds the n-th such input of the driven gate.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return BOOLEAN - TRUE if the lists match each other, FALSE otherwise
+ */
+BOOLEAN indexFaninBranches( CIRCUIT* circuit, int numGates );
+
+/*
+ *  Chooses the evaluation kernel of every gate from its type, inversion and
+ *  number of inputs, once the fanin lists are complete. Every input of the
+ *  wide gates is counted as X.
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return nothing
+ */
+void selectGateKernels( CIRCUIT* circuit, int numGates );
 
 /*
  *  Reads circuit gates from a netlist stored in <filename> and populates the
  *  <circuit> with the netlist
  *
- *  @param  CIRCUIT circuit  	- an empty circuit to be populated
+ *  @param  CIRCUIT* circuit  	- an empty circuit to be populated
  *  @param  CIRCUIT_INFO* info 	- summary of circuit details
  *  @param  char*   filename 	- the filename storing the netlist
  *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
  */
-BOOLEAN populateCircuit( CIRCUIT circuit, CIRCUIT_INFO* info, char* filename );
+BOOLEAN populateCircuit( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename );
+
+/*
+ *  Reads circuit gates from a netlist stored in <filename> by mapping the file
+ *  into memory and tokenizing it in a single pass. Gate names are used in place
+ *  inside the mapping until they are stored in the circuit.
+ *
+ *  @param  CIRCUIT* circuit  	- an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info 	- summary of circuit details
+ *  @param  char*   filename 	- the filename storing the netlist
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN populateCircuitMapped( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename );
+
+/*
+ *  Tokenizes a netlist held in memory and populates the <circuit> with it. The
+ *  buffer is read in a single pass and never modified.
+ *
+ *  @param  CIRCUIT* circuit  	- an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info 	- summary of circuit details
+ *  @param  const char* data 	- the netlist's text
+ *  @param  size_t  size 	    - number of characters in <data>
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN parseNetlistBuffer( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* data, size_t size );
+
+/*
+ *  Splits a netlist line into its declaration parts. Comments start with '#'
+ *  and run until the end of the line.
+ *
+ *  @param  const char* p       - the first character of the line
+ *  @param  const char* eol     - the end of the line (excluding the new line)
+ *  @param  NETLIST_LINE* line  - receives the parts of the declaration
+ *  @return NETLIST_LINE_TYPE - the kind of the line
+ */
+NETLIST_LINE_TYPE tokenizeNetlistLine( const char* p, const char* eol, NETLIST_LINE* line );
+
+/*
+ *  Extracts the next input name of an inner gate declaration
+ *
+ *  @param  const char** tok    - the position to continue from, updated on return
+ *  @param  const char* end     - the end of the declaration's inputs
+ *  @param  const char** name   - receives the input's name
+ *  @param  int*    len         - receives the length of the input's name
+ *  @return BOOLEAN - TRUE if an input was extracted, FALSE at the end of the inputs
+ */
+BOOLEAN nextNetlistInput( const char** tok, const char* end, const char** name, int* len );
+
+/*
+ *  Reports a malformed line of a netlist buffer and terminates the program
+ *
+ *  @param  NETLIST_LINE* line  - the malformed line
+ *  @param  int     lineNumber  - the line's number in the netlist
+ *  @return nothing
+ */
+void reportMalformedNetlistLine( NETLIST_LINE* line, int lineNumber );
+
+/*
+ *  Determines the gate type from its name in a netlist (AND, NAND, OR, NOR, BUF,
+ *  NOT, XOR, XNOR, DFF, ...)
+ *
+ *  @param  const char* type    - the gate's type name (not necessarily null terminated)
+ *  @param  int     typeLen     - length of the gate's type name
+ *  @param  GATE_TYPE* gateType - receives the gate's type
+ *  @param  BOOLEAN* inv        - receives TRUE if the gate is inverted
+ *  @param  BOOLEAN* isDFF      - receives TRUE if the gate is a flip-flop
+ *  @return BOOLEAN - TRUE if the type is known, FALSE otherwise
+ */
+BOOLEAN parseGateType( const char* type, int typeLen, GATE_TYPE* gateType,
+                       BOOLEAN* inv, BOOLEAN* isDFF );
+
+/*
+ *  Appends a primary input (or pseudo primary input) gate to the circuit
+ *
+ *  @param  CIRCUIT* circuit    - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* name    - the gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the gate's name
+ *  @param  BOOLEAN outputSeen  - TRUE if an output gate was declared before
+ *  @param  BOOLEAN isPseudo    - TRUE if the input is a pseudo primary input
+ *  @return int - the index of the new gate
+ */
+int declareInputGate( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* name, int len,
+                      BOOLEAN outputSeen, BOOLEAN isPseudo );
+
+/*
+ *  Appends a primary output (or pseudo primary output) gate to the circuit
+ *
+ *  @param  CIRCUIT* circuit    - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* name    - the gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the gate's name
+ *  @param  BOOLEAN isPseudo    - TRUE if the output is a pseudo primary output
+ *  @return int - the index of the new gate
+ */
+int declareOutputGate( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* name, int len,
+                       BOOLEAN isPseudo );
+
+/*
+ *  Finds or creates the gate driven by an inner gate declaration and sets its
+ *  type from the given type name (AND, NAND, OR, NOR, BUF, NOT, DFF, ...)
+ *
+ *  @param  CIRCUIT* circuit    - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* name    - the gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the gate's name
+ *  @param  const char* type    - the gate's type name (not necessarily null terminated)
+ *  @param  int     typeLen     - length of the gate's type name
+ *  @param  BOOLEAN* isDFF      - set to TRUE if the gate is a flip-flop
+ *  @return int - the index of the declared gate
+ */
+int declareInnerGate( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* name, int len,
+                      const char* type, int typeLen, BOOLEAN* isDFF );
+
+/*
+ *  Connects the gate named <name> to the input of the gate at <index>. Inputs of
+ *  a flip-flop are marked as pseudo primary outputs instead of being connected.
+ *
+ *  @param  CIRCUIT* circuit    - the circuit being populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  int     index       - the gate whose input is being connected
+ *  @param  const char* name    - the input gate's name (not necessarily null terminated)
+ *  @param  int     len         - length of the input gate's name
+ *  @param  BOOLEAN isDFF       - TRUE if the gate at <index> is a flip-flop
+ *  @return int - the index of the input gate
+ */
+int connectGateInput( CIRCUIT* circuit, CIRCUIT_INFO* info, int index,
+                      const char* name, int len, BOOLEAN isDFF );
 
 /*
  *  Compute gate levels in the entire circuit
@@ -53,7 +288,18 @@ BOOLEAN populateCircuit( CIRCUIT circuit, CIRCUIT_INFO* info, char* filename );
  *  @param  info    - gate information object
  *  @return nothing
  */
-void computeGateLevels(CIRCUIT circuit, CIRCUIT_INFO* info);
+void computeGateLevels(CIRCUIT* circuit, CIRCUIT_INFO* info);
+
+/*
+ *  Sorts the gates by level into the circuit's evaluation order. Gates of the
+ *  same level keep the order of their numbers. The event queue of the circuit
+ *  is sized for the same levels.
+ *
+ *  @param  circuit - the circuit, whose gate levels are already computed
+ *  @param  numGates - total number of gates in the circuit
+ *  @return BOOLEAN TRUE if the order was built and FALSE if a level is missing
+ */
+BOOLEAN computeEvaluationOrder(CIRCUIT* circuit, int numGates);
 
 /*
  *  Compute gate level for the given circuit
@@ -62,44 +308,76 @@ void computeGateLevels(CIRCUIT circuit, CIRCUIT_INFO* info);
  *  @param  index - gate index of interest
  *  @return int - the gate's level
  */
-int computeGateLevel(CIRCUIT circuit, int index);
+int computeGateLevel(CIRCUIT* circuit, int index);
 
 /*
  *  Finds the first occurence of the given gate's <name> in the <circuit>
  *
- *  @param  CIRCUIT circuit - the circuit to search
+ *  @param  CIRCUIT* circuit - the circuit to search
  *  @param  int* totalGates - total number of gates currently in the circuit
  *  @param  char*   name    - gate's name to search for
  *  @param  BOOLEAN init    - flag to initialize a new gate if none was found
  *  @return int - the index of the gate in the <circuit>
  */
-int findIndex( CIRCUIT circuit, int* totalGates, char* name, BOOLEAN init );
+int findIndex( CIRCUIT* circuit, int* totalGates, char* name, BOOLEAN init );
 
 /*
- * Prints the type name of the gate at position <index>
+ *  Finds the first occurence of the gate named by the first <len> characters of
+ *  <name> in the <circuit>
  *
- *  @param  GATE* gate - the gate to be printed
- *  @param  int     index   - the position of the gate in the <circuit>
+ *  @param  CIRCUIT* circuit - the circuit to search
+ *  @param  int* totalGates - total number of gates currently in the circuit
+ *  @param  const char* name - gate's name to search for (not necessarily null terminated)
+ *  @param  int     len     - length of the gate's name
+ *  @param  BOOLEAN init    - flag to initialize a new gate if none was found
+ *  @return int - the index of the gate in the <circuit>
+ */
+int findIndexLen( CIRCUIT* circuit, int* totalGates, const char* name, int len, BOOLEAN init );
+
+/*
+ *  Computes the memory used by the gates of a circuit, their connections and
+ *  their names
+ *
+ *  @param  CIRCUIT* circuit - the circuit
+ *  @param  int     numGates - total number of gates in the circuit
+ *  @return size_t - the number of bytes in use
+ */
+size_t getCircuitMemoryUsage( CIRCUIT* circuit, int numGates );
+
+/*
+ *  Releases the gates of the <circuit> and the gate names table so that
+ *  another netlist can be parsed
+ *
+ *  @param  CIRCUIT* circuit    - the circuit
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @return nothing
+ */
+void clearCircuit( CIRCUIT* circuit, CIRCUIT_INFO* info );
+
+/*
+ * Prints the name of a gate type
+ *
+ *  @param  GATE_TYPE type - the gate type to be printed
  *  @return nothing
  */
-void printType( GATE* gate );
+void printType( GATE_TYPE type );
 
 /*
  *  Print the details of a gate
  *
- *  @param  CIRCUIT circuit - the circuit
+ *  @param  CIRCUIT* circuit - the circuit
  *  @param  int     index   - the position of the gate in the <circuit>
  *  @return nothing
  */
-void printGateInfo( CIRCUIT circuit, int index );
+void printGateInfo( CIRCUIT* circuit, int index );
 
 /*
  *  Print the details of a circuit
  *
- *  @param  CIRCUIT circuit - the circuit
+ *  @param  CIRCUIT* circuit - the circuit
  *  @param  int totalGates  - total number of gates currently in the circuit
  *  @return nothing
  */
-void printCircuitInfo( CIRCUIT circuit, int totalGates );
+void printCircuitInfo( CIRCUIT* circuit, int totalGates );
 
 #endif
@@ -0,0 +1,636 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parser_threaded.c
+ *
+ *    Description:  Multi-threaded two pass netlist parser for large netlists.
+ *                  Gates are numbered exactly like the single threaded parsers
+ *                  number them, so the circuit does not depend on the number
+ *                  of threads.
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* sprintf, stdout */
+#include <stdio.h>
+
+/* malloc, realloc, free, exit */
+#include <stdlib.h>
+
+/* memchr, memcpy */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno */
+#include <errno.h>
+
+/* sysconf */
+#include <unistd.h>
+
+/* madvise */
+#include <sys/mman.h>
+
+/* pthread_create, pthread_join */
+#include <pthread.h>
+
+#include "parser_threaded.h"
+#include "parser_netlist.h"
+#include "symbol_table.h"
+#include "data_file.h"
+
+extern volatile COMMAND_LINE_OPTIONS options;
+
+
+/*
+ *  Upper limit on the number of parsing threads
+ */
+#define MAX_PARSER_THREADS  64
+
+/*
+ *  A gate name referenced by a netlist line
+ */
+typedef struct
+{
+    const char* name;   // The name inside the netlist's text
+    int len;
+    uint32_t hash;      // Hash of the name in the gate names table
+    int gate;           // Index of the named gate, set by the second pass
+    int inSlot;         // Position in the fanin list of the line's gate, -1 if not connected
+    int outSlot;        // Position in the fanout list of the named gate
+} PARSED_NAME;
+
+/*
+ *  A declaration tokenized by the first pass
+ */
+typedef struct
+{
+    NETLIST_LINE line;
+    int lineNumber;     // Line number within the chunk
+    int firstName;      // The declared gate's name followed by the gate's inputs
+    int numNames;
+    GATE_TYPE gateType;
+    BOOLEAN inv;
+    BOOLEAN isDFF;
+    BOOLEAN isKnownType;
+} PARSED_LINE;
+
+/*
+ *  A part of the netlist, split at a line boundary, tokenized by one thread
+ */
+typedef struct
+{
+    const char* start;
+    const char* end;
+    PARSED_LINE* lines;
+    int numLines, maxLines;
+    PARSED_NAME* names;
+    int numNames, maxNames;
+    int numTextLines;   // Lines of text in the chunk, including blank ones
+    BOOLEAN isOutOfMemory;
+} PARSE_CHUNK;
+
+/*
+ *  Gate details collected by the second pass before the gates are built
+ */
+typedef struct
+{
+    const char* name;
+    int len;
+    uint32_t nameOffset; // Position of the name in the gate names arena
+    GATE_TYPE type;
+    BOOLEAN inv;
+    BOOLEAN PO;
+    BOOLEAN PPO;
+    int numIn;
+    int numOut;
+    int level;
+} PARSED_GATE;
+
+/*
+ *  State shared by the parsing threads
+ */
+typedef struct
+{
+    CIRCUIT* circuit;
+    PARSE_CHUNK* chunks;
+    int numChunks;
+    PARSED_GATE* gates;
+    int numGates, maxGates;
+} PARSER_STATE;
+
+/*
+ *  Work of one parsing thread
+ */
+typedef struct
+{
+    PARSER_STATE* state;
+    int thread;
+    int numThreads;
+} PARSER_TASK;
+
+
+/*
+ *  Runs <routine> on <numThreads> threads, the calling thread being the first
+ *  one, and waits for all of them. Tasks of threads that could not be started
+ *  are run by the calling thread.
+ */
+static void runParserThreads( PARSER_STATE* state, int numThreads, void* (*routine)(void*) )
+{
+    pthread_t threads[MAX_PARSER_THREADS];
+    PARSER_TASK tasks[MAX_PARSER_THREADS];
+    BOOLEAN started[MAX_PARSER_THREADS];
+    int K;
+
+    for(K = 0; K < numThreads; K++)
+    {
+        tasks[K].state = state;
+        tasks[K].thread = K;
+        tasks[K].numThreads = numThreads;
+    }
+
+    for(K = 1; K < numThreads; K++)
+        started[K] = (pthread_create(&threads[K], NULL, routine, &tasks[K]) == 0);
+
+    routine(&tasks[0]);
+
+    for(K = 1; K < numThreads; K++)
+    {
+        if(started[K]) pthread_join(threads[K], NULL);
+        else routine(&tasks[K]);
+    }
+}
+
+/*
+ *  Makes room for one more item in a growable array
+ */
+static BOOLEAN reserveParsedItem( void** items, int count, int* capacity, size_t itemSize )
+{
+    if(count < *capacity) return TRUE;
+
+    int newCapacity = (*capacity < 64) ? 64 : (*capacity * 2);
+    void* newItems = realloc(*items, newCapacity * itemSize);
+    if(newItems == NULL) return FALSE;
+
+    *items = newItems;
+    *capacity = newCapacity;
+    return TRUE;
+}
+
+/*
+ *  Appends a gate name to the names of a chunk
+ */
+static BOOLEAN appendParsedName( PARSE_CHUNK* chunk, const char* name, int len )
+{
+    if(!reserveParsedItem((void**) &chunk->names, chunk->numNames, &chunk->maxNames,
+                          sizeof(PARSED_NAME))) return FALSE;
+
+    PARSED_NAME* parsed = &chunk->names[chunk->numNames++];
+    parsed->name    = name;
+    parsed->len     = len;
+    parsed->hash    = hashSymbol(name, len);
+    parsed->gate    = -1;
+    parsed->inSlot  = -1;
+    parsed->outSlot = -1;
+    return TRUE;
+}
+
+/*
+ *  First pass: tokenizes the lines of one chunk and hashes the names they
+ *  reference. Tokenizing stops at the first malformed line, which is reported
+ *  by the second pass once all the lines before it have been processed.
+ */
+static void* tokenizeChunk( void* arg )
+{
+    PARSER_TASK* task = (PARSER_TASK*) arg;
+    PARSE_CHUNK* chunk = &task->state->chunks[task->thread];
+    const char *p, *eol, *tok, *name;
+    NETLIST_LINE line;
+    int len;
+
+    for(p = chunk->start; p < chunk->end; p = eol + 1)
+    {
+        chunk->numTextLines++;
+        eol = (const char*) memchr(p, '\n', chunk->end - p);
+        if(eol == NULL) eol = chunk->end;
+
+        if(tokenizeNetlistLine(p, eol, &line) != NETLIST_BLANK)
+        {
+            if(!reserveParsedItem((void**) &chunk->lines, chunk->numLines, &chunk->maxLines,
+                                  sizeof(PARSED_LINE))) break;
+
+            PARSED_LINE* parsed = &chunk->lines[chunk->numLines++];
+            parsed->line       = line;
+            parsed->lineNumber = chunk->numTextLines;
+            parsed->firstName  = chunk->numNames;
+            parsed->numNames   = 0;
+            if(line.type == NETLIST_MALFORMED) return NULL;
+
+            if(!appendParsedName(chunk, line.name, line.nameLen)) break;
+
+            if(line.type == NETLIST_GATE)
+            {
+                parsed->isKnownType = parseGateType(line.gateType, line.gateTypeLen,
+                                                    &parsed->gateType, &parsed->inv, &parsed->isDFF);
+
+                tok = line.inputs;
+                while(nextNetlistInput(&tok, line.inputsEnd, &name, &len))
+                    if(!appendParsedName(chunk, name, len))
+                    {
+                        chunk->isOutOfMemory = TRUE;
+                        return NULL;
+                    }
+            }
+            parsed->numNames = chunk->numNames - parsed->firstName;
+        }
+
+        if(eol == chunk->end) return NULL;
+    }
+
+    if(p < chunk->end) chunk->isOutOfMemory = TRUE;
+    return NULL;
+}
+
+/*
+ *  Finds the gate with the given name
+ *
+ *  @return int - the gate's index or -1 if the name is unknown
+ */
+static int lookupParsedGate( PARSER_STATE* state, PARSED_NAME* name )
+{
+    return findSymbol(&state->circuit->names, name->name, name->len, name->hash);
+}
+
+/*
+ *  Numbers a new gate with the given name and interns its name in the gate
+ *  names table, as appendNewGate does
+ */
+static int createParsedGate( PARSER_STATE* state, PARSED_NAME* name )
+{
+    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+
+    if(!reserveParsedItem((void**) &state->gates, state->numGates, &state->maxGates,
+                          sizeof(PARSED_GATE)))
+    {
+        sprintf(ERROR_MESSAGE, "Not enough memory for %d gates", state->numGates + 1);
+        errno = ENOMEM;
+        exit(1);
+    }
+
+    int index = state->numGates++;
+    PARSED_GATE* gate = &state->gates[index];
+    gate->name   = name->name;
+    gate->len    = name->len;
+    gate->type   = OTHER;
+    gate->inv    = FALSE;
+    gate->PO     = FALSE;
+    gate->PPO    = FALSE;
+    gate->numIn  = 0;
+    gate->numOut = 0;
+    gate->level  = -1;
+
+    // Gates sharing a name share its interned copy, as setGateName does
+    SYMBOL_TABLE* names = &state->circuit->names;
+    int id = internSymbol(names, name->name, name->len, name->hash, index);
+    if(id == index)
+        gate->nameOffset = (uint32_t) (names->arenaSize - name->len - 1);
+    else
+        gate->nameOffset = state->gates[id].nameOffset;
+    return index;
+}
+
+/*
+ *  Finds the gate with the given name or numbers a new one
+ */
+static int findParsedGate( PARSER_STATE* state, PARSED_NAME* name )
+{
+    int index = lookupParsedGate(state, name);
+    return (index >= 0) ? index : createParsedGate(state, name);
+}
+
+/*
+ *  Second pass: numbers the gates and checks every declaration in the order of
+ *  the netlist's text, applying the same rules as declareInputGate,
+ *  declareOutputGate, declareInnerGate and connectGateInput. Only the compact
+ *  gate details are touched here; the gates themselves are built afterwards.
+ */
+static void resolveParsedNetlist( PARSER_STATE* state, CIRCUIT_INFO* info )
+{
+    extern char ERROR_MESSAGE[MAX_LINE_LENGTH];
+    BOOLEAN outputSeen = FALSE; // True if at least one output gate has been parsed
+    BOOLEAN found;
+    int C, L, N, index, index2, lineNumber = 0;
+    PARSED_GATE *gate, *input;
+
+    for(C = 0; C < state->numChunks; C++)
+    {
+        PARSE_CHUNK* chunk = &state->chunks[C];
+        for(L = 0; L < chunk->numLines; L++)
+        {
+            PARSED_LINE* parsed = &chunk->lines[L];
+            PARSED_NAME* names = chunk->names + parsed->firstName;
+
+            switch(parsed->line.type)
+            {
+                case NETLIST_MALFORMED:
+                    reportMalformedNetlistLine(&parsed->line, lineNumber + parsed->lineNumber);
+                    break;
+
+                case NETLIST_INPUT:
+                    // Check if the input has the name of an existing PO
+                    found = FALSE;
+                    index = lookupParsedGate(state, &names[0]);
+                    if(outputSeen && index >= 0 && state->gates[index].PO)
+                    {
+                        state->gates[index].PO = FALSE;
+                        found = TRUE;
+                    }
+
+                    index = createParsedGate(state, &names[0]);
+                    names[0].gate = index;
+                    gate = &state->gates[index];
+                    gate->level = 0;
+                    gate->type  = PI;
+                    gate->PO    = found;
+                    appendPrimaryInput(info, index);
+                    break;
+
+                case NETLIST_OUTPUT:
+                    outputSeen = TRUE;
+
+                    index = createParsedGate(state, &names[0]);
+                    names[0].gate = index;
+                    state->gates[index].PO = TRUE;
+                    appendPrimaryOutput(info, index);
+                    break;
+
+                case NETLIST_GATE:
+                    index = findParsedGate(state, &names[0]);
+                    names[0].gate = index;
+                    gate = &state->gates[index];
+
+                    if(gate->type == PI || gate->type == PPI)
+                    {
+                        sprintf(ERROR_MESSAGE,
+                                "Node %.*s (id:%d), which is a PI/PPI, is at the output"
+                                " of a gate!", gate->len, gate->name, index);
+                        errno = ERROR_PARSING_CIRCUIT;
+                        exit(1);
+                    }
+                    if(!parsed->isKnownType)
+                    {
+                        const char* type = parsed->line.gateType;
+                        int typeLen = parsed->line.gateTypeLen;
+                        if(*type == 'N')
+                        {
+                            type++;
+                            typeLen--;
+                        }
+                        sprintf(ERROR_MESSAGE,
+                                "Unknown gate type \"%.*s\" encountered!", typeLen, type);
+                        errno = ERROR_PARSING_CIRCUIT;
+                        exit(1);
+                    }
+                    gate->inv = parsed->inv;
+
+                    // Output flags survive only the first definition of a declared output
+                    if(gate->PO != TRUE || gate->type != OTHER) gate->PO = FALSE;
+                    if(gate->PPO != TRUE || gate->type != OTHER) gate->PPO = FALSE;
+
+                    if(parsed->isDFF && index < state->numGates - 1)
+                    {
+                        // Found a PO with the same name ===> need to add new PPI
+                        gate->PO = FALSE;
+                        index2 = createParsedGate(state, &names[0]);
+                        state->gates[index2].type = PPI;
+                        state->gates[index2].PO = TRUE;
+                        info->numPPI++;
+                    }
+                    else
+                    {
+                        gate->type = parsed->gateType;
+                        if(parsed->isDFF) info->numPPI++;
+                    }
+
+                    for(N = 1; N < parsed->numNames; N++)
+                    {
+                        index2 = findParsedGate(state, &names[N]);
+                        names[N].gate = index2;
+
+                        // Numbering a new input may have moved the gate details
+                        gate  = &state->gates[index];
+                        input = &state->gates[index2];
+
+                        // A PO/PPO may also feed further gates
+                        if(parsed->isDFF)
+                        {
+                            if(!input->PPO)
+                                info->numPPO++;
+                            input->PPO = TRUE;
+                            continue;
+                        }
+
+                        names[N].inSlot  = gate->numIn++;
+                        names[N].outSlot = input->numOut++;
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
+        lineNumber += chunk->numTextLines;
+    }
+}
+
+/*
+ *  Initializes the gates of one range of gate indices
+ */
+static void* buildParsedGates( void* arg )
+{
+    PARSER_TASK* task = (PARSER_TASK*) arg;
+    PARSER_STATE* state = task->state;
+    int first = (int) ((long long) state->numGates * task->thread / task->numThreads);
+    int last  = (int) ((long long) state->numGates * (task->thread + 1) / task->numThreads);
+    int K;
+
+    CIRCUIT* circuit = state->circuit;
+
+    for(K = first; K < last; K++)
+    {
+        PARSED_GATE* parsed = &state->gates[K];
+
+        circuit->nameOffset[K] = parsed->nameOffset;
+        circuit->type[K]       = parsed->type;
+        circuit->inv[K]        = parsed->inv;
+        circuit->PO[K]         = parsed->PO;
+        circuit->PPO[K]        = parsed->PPO;
+        circuit->value[K]      = X;
+        circuit->level[K]      = parsed->level;
+    }
+
+    bzero(&JUSTIFIED(circuit, first, 0), (last - first) * MAX_LOGIC_VALUES * sizeof(JUST_OBJECT));
+    bzero(&PROPAGATED(circuit, first, 0), (last - first) * MAX_LOGIC_VALUES * sizeof(PROP_OBJECT));
+    return NULL;
+}
+
+/*
+ *  Fills the fanin and fanout lists with the connections of one chunk. Every
+ *  connection has its own slots, so chunks never write to the same entry.
+ */
+static void* connectParsedGates( void* arg )
+{
+    PARSER_TASK* task = (PARSER_TASK*) arg;
+    PARSER_STATE* state = task->state;
+    PARSE_CHUNK* chunk = &state->chunks[task->thread];
+    int L, N;
+
+    for(L = 0; L < chunk->numLines; L++)
+    {
+        PARSED_LINE* parsed = &chunk->lines[L];
+        PARSED_NAME* names = chunk->names + parsed->firstName;
+        if(parsed->line.type != NETLIST_GATE) continue;
+
+        CIRCUIT* circuit = state->circuit;
+        int gate = names[0].gate;
+        for(N = 1; N < parsed->numNames; N++)
+        {
+            if(names[N].inSlot < 0) continue;
+            int in  = circuit->faninStart[gate] + names[N].inSlot;
+            int out = circuit->fanoutStart[names[N].gate] + names[N].outSlot;
+            circuit->fanin[in]       = names[N].gate;
+            circuit->faninBranch[in] = out;
+            circuit->fanout[out]     = gate;
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  Reads circuit gates from a netlist stored in <filename> with the number of
+ *  threads given by the -j option (one per online CPU by default)
+ *
+ *  @param  CIRCUIT* circuit    - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the filename storing the netlist
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN populateCircuitThreaded( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename )
+{
+    int numThreads = options.parserThreads;
+    if(numThreads <= 0) numThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+
+    DATA_FILE file;
+    if(loadDataFile(&file, filename) == FALSE) return FALSE;
+
+    // An empty netlist is trivially parsed
+    if(file.size == 0) return TRUE;
+    if(file.isMapped) madvise(file.data, file.size, MADV_WILLNEED);
+
+    BOOLEAN status = parseNetlistBufferThreaded(circuit, info, file.data, file.size, numThreads);
+
+    releaseDataFile(&file);
+    return status;
+}
+
+/*
+ *  Parses a netlist held in memory with <numThreads> threads. The first pass
+ *  splits the text at line boundaries and tokenizes every chunk in parallel.
+ *  The second pass numbers the gates in the order of the text and then builds
+ *  the gates and their fanin and fanout lists in parallel. The circuit is the
+ *  same as the one built by parseNetlistBuffer for any number of threads.
+ *
+ *  @param  CIRCUIT* circuit    - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* data    - the netlist's text
+ *  @param  size_t  size        - number of characters in <data>
+ *  @param  int     numThreads  - number of parsing threads
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN parseNetlistBufferThreaded( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* data,
+                                    size_t size, int numThreads )
+{
+    PARSER_STATE state;
+    const char* end = data + size;
+    const char* boundary;
+    BOOLEAN status = TRUE;
+    int K;
+
+    if(numThreads < 1) numThreads = 1;
+    if(numThreads > MAX_PARSER_THREADS) numThreads = MAX_PARSER_THREADS;
+
+    bzero(&state, sizeof(state));
+    state.circuit   = circuit;
+    state.numChunks = numThreads;
+    state.chunks    = (PARSE_CHUNK*) calloc(numThreads, sizeof(PARSE_CHUNK));
+    if(state.chunks == NULL) return FALSE;
+
+    // Split the text into chunks of whole lines
+    for(K = 0; K < numThreads; K++)
+    {
+        boundary = data + (size / numThreads) * K;
+        if(K > 0 && boundary[-1] != '\n')
+        {
+            boundary = (const char*) memchr(boundary, '\n', end - boundary);
+            boundary = (boundary == NULL) ? end : (boundary + 1);
+        }
+        if(K > 0 && boundary < state.chunks[K-1].start) boundary = state.chunks[K-1].start;
+
+        state.chunks[K].start = boundary;
+        if(K > 0) state.chunks[K-1].end = boundary;
+    }
+    state.chunks[numThreads-1].end = end;
+
+    // First pass
+    runParserThreads(&state, numThreads, tokenizeChunk);
+    for(K = 0; K < numThreads; K++)
+        if(state.chunks[K].isOutOfMemory) status = FALSE;
+
+    // Second pass
+    if(status == TRUE)
+    {
+        resolveParsedNetlist(&state, info);
+        info->numGates = state.numGates;
+
+        // The circuit's arrays are allocated by this thread only, and every
+        // gate's fanin and fanout lists start where the previous gate's end
+        int numEdges = 0;
+        for(K = 0; K < state.numGates; K++) numEdges += state.gates[K].numIn;
+
+        reserveCircuit(circuit, state.numGates);
+        allocateConnections(circuit, state.numGates, numEdges);
+        circuit->faninStart[0] = circuit->fanoutStart[0] = 0;
+        for(K = 0; K < state.numGates; K++)
+        {
+            circuit->faninStart[K + 1]  = circuit->faninStart[K] + state.gates[K].numIn;
+            circuit->fanoutStart[K + 1] = circuit->fanoutStart[K] + state.gates[K].numOut;
+        }
+
+        runParserThreads(&state, numThreads, buildParsedGates);
+        runParserThreads(&state, numThreads, connectParsedGates);
+        selectGateKernels(circuit, state.numGates);
+        if(options.isDebugMode && options.debugLevel > 2) printCircuitInfo(circuit, info->numGates);
+    }
+
+    for(K = 0; K < numThreads; K++)
+    {
+        free(state.chunks[K].lines);
+        free(state.chunks[K].names);
+    }
+    free(state.chunks);
+    free(state.gates);
+
+    return status;
+}
@@ -0,0 +1,59 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parser_threaded.h
+ *
+ *    Description:  Multi-threaded two pass netlist parser for large netlists
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stddef.h>
+
+#include "atpg_types.h"
+
+
+#ifndef PARSER_THREADED_H
+#define PARSER_THREADED_H
+
+
+/*
+ *  Reads circuit gates from a netlist stored in <filename> with the number of
+ *  threads given by the -j option (one per online CPU by default)
+ *
+ *  @param  CIRCUIT* circuit    - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  char*   filename    - the filename storing the netlist
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN populateCircuitThreaded( CIRCUIT* circuit, CIRCUIT_INFO* info, char* filename );
+
+/*
+ *  Parses a netlist held in memory with <numThreads> threads. The first pass
+ *  splits the text at line boundaries and tokenizes every chunk in parallel.
+ *  The second pass numbers the gates in the order of the text and then builds
+ *  the gates and their fanin and fanout lists in parallel. The circuit is the
+ *  same as the one built by parseNetlistBuffer for any number of threads.
+ *
+ *  @param  CIRCUIT* circuit    - an empty circuit to be populated
+ *  @param  CIRCUIT_INFO* info  - summary of circuit details
+ *  @param  const char* data    - the netlist's text
+ *  @param  size_t  size        - number of characters in <data>
+ *  @param  int     numThreads  - number of parsing threads
+ *  @return BOOLEAN - TRUE -> parsing and population were successful, FALSE otherwise
+ */
+BOOLEAN parseNetlistBufferThreaded( CIRCUIT* circuit, CIRCUIT_INFO* info, const char* data,
+                                    size_t size, int numThreads );
+
+#endif
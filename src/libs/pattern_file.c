@@ -0,0 +1,661 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  pattern_file.c
+ *
+ *    Description:  Bit-packed binary test pattern files
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* FILE, fread, fwrite, fseek, fclose, ferror */
+#include <stdio.h>
+
+/* malloc, realloc, free */
+#include <stdlib.h>
+
+/* memchr, memcmp, memcpy, strchr, strcmp, strncmp */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, EINTR */
+#include <errno.h>
+
+/* INT_MAX */
+#include <limits.h>
+
+/* open, O_RDONLY */
+#include <fcntl.h>
+
+/* fstat, S_ISREG */
+#include <sys/stat.h>
+
+/* read, close, STDIN_FILENO */
+#include <unistd.h>
+
+#include "pattern_file.h"
+#include "data_file.h"
+#include "test_cube.h"
+
+
+/*
+ *  Writes the buffered patterns into the file
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @return nothing
+ */
+static void writePatternBuffer( PATTERN_WRITER* writer )
+{
+    if(writer->size > 0 && fwrite(writer->buffer, 1, writer->size, writer->fp) != writer->size)
+        writer->isFailed = TRUE;
+    writer->size = 0;
+}
+
+/*
+ *  Appends bytes to the writer's buffer, writing the buffer out whenever it is full
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @param  const void* data        - the bytes to append
+ *  @param  size_t  size            - number of bytes to append
+ *  @return nothing
+ */
+static void appendPatternBytes( PATTERN_WRITER* writer, const void* data, size_t size )
+{
+    const char* bytes = (const char*) data;
+    size_t chunk;
+    while(size > 0)
+    {
+        if(writer->size == PATTERN_FILE_BLOCK_SIZE) writePatternBuffer(writer);
+
+        chunk = PATTERN_FILE_BLOCK_SIZE - writer->size;
+        if(chunk > size) chunk = size;
+        memcpy(writer->buffer + writer->size, bytes, chunk);
+        writer->size += chunk;
+        bytes += chunk;
+        size  -= chunk;
+    }
+}
+
+/*
+ *  Appends a bit-vector of a test cube as a plane of <words> words, the words
+ *  past the test cube's width being zeros
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @param  const uint64_t* bits    - the care or value bits of a test cube
+ *  @param  int     width           - the test cube's width
+ *  @param  int     words           - the words of the plane
+ *  @return nothing
+ */
+static void appendPatternPlane( PATTERN_WRITER* writer, const uint64_t* bits, int width, int words )
+{
+    static const uint64_t zero = 0;
+    int K, count = CUBE_WORDS(width);
+    if(count > words) count = words;
+
+    appendPatternBytes(writer, bits, count * sizeof(uint64_t));
+    for(K = count; K < words; K++) appendPatternBytes(writer, &zero, sizeof(uint64_t));
+}
+
+/*
+ *  Creates a binary test pattern file
+ *
+ *  @param  PATTERN_WRITER* writer  - the writer to be opened
+ *  @param  char*   filename        - the pattern file's filename
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @param  BOOLEAN isFaultIdsSaved - TRUE to save the ids of the detected faults
+ *  @return BOOLEAN - TRUE if the file was created, FALSE otherwise
+ */
+BOOLEAN openPatternWriter( PATTERN_WRITER* writer, char* filename, CIRCUIT_INFO* info,
+                           uint64_t netlistHash, BOOLEAN isFaultIdsSaved )
+{
+    FILE* fp = openDataFile(filename, "wb");
+    if(fp == NULL) return FALSE;
+
+    if(openPatternStream(writer, fp, info, netlistHash, isFaultIdsSaved) == FALSE)
+    {
+        fclose(fp);
+        return FALSE;
+    }
+    writer->isStream = FALSE;
+    return TRUE;
+}
+
+/*
+ *  Starts a binary test pattern stream into an already open file, such as a
+ *  pipe. The file is flushed but not closed by closePatternWriter.
+ *
+ *  @param  PATTERN_WRITER* writer  - the writer to be opened
+ *  @param  FILE*   fp              - the open file
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @param  BOOLEAN isFaultIdsSaved - TRUE to save the ids of the detected faults
+ *  @return BOOLEAN - TRUE if the stream was started, FALSE otherwise
+ */
+BOOLEAN openPatternStream( PATTERN_WRITER* writer, FILE* fp, CIRCUIT_INFO* info,
+                           uint64_t netlistHash, BOOLEAN isFaultIdsSaved )
+{
+    bzero(writer, sizeof(PATTERN_WRITER));
+    memcpy(writer->header.magic, PATTERN_FILE_MAGIC, sizeof(PATTERN_FILE_MAGIC));
+    writer->header.version     = PATTERN_FILE_VERSION;
+    writer->header.byteOrder   = PATTERN_FILE_BYTE_ORDER;
+    writer->header.netlistHash = netlistHash;
+    writer->header.numPI       = info->numPI;
+    writer->header.numPO       = info->numPO;
+    writer->header.flags       = isFaultIdsSaved ? PATTERN_FILE_FAULT_IDS : 0;
+    writer->inWords  = CUBE_WORDS(info->numPI);
+    writer->outWords = CUBE_WORDS(info->numPO);
+
+    writer->buffer = (char*) malloc(PATTERN_FILE_BLOCK_SIZE);
+    if(writer->buffer == NULL) return FALSE;
+
+    writer->fp = fp;
+    writer->isStream = TRUE;
+    appendPatternBytes(writer, &writer->header, sizeof(PATTERN_FILE_HEADER));
+    return TRUE;
+}
+
+/*
+ *  Appends a test vector to the pattern file
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @param  TEST_VECTOR* tv         - the test vector
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN writePattern( PATTERN_WRITER* writer, TEST_VECTOR* tv )
+{
+    return writePatternCubes(writer, &tv->input, &tv->output, tv->faults_count, tv->faults_list);
+}
+
+/*
+ *  Appends a test pattern given by its test cubes and detected faults to the
+ *  pattern file, the words of the test cubes being the bit-planes
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @param  const TEST_CUBE* input  - the input gates values, <numPI> wide
+ *  @param  const TEST_CUBE* output - the output gates values, at most <numPO> wide
+ *  @param  int     faultsCount     - number of detected faults
+ *  @param  const int32_t* faults   - positions of the detected faults in the fault list
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN writePatternCubes( PATTERN_WRITER* writer, const TEST_CUBE* input, const TEST_CUBE* output,
+                           int faultsCount, const int32_t* faults )
+{
+    appendPatternPlane(writer, input->care, input->width, writer->inWords);
+    appendPatternPlane(writer, input->value, input->width, writer->inWords);
+    appendPatternPlane(writer, output->care, output->width, writer->outWords);
+    appendPatternPlane(writer, output->value, output->width, writer->outWords);
+
+    if(writer->header.flags & PATTERN_FILE_FAULT_IDS)
+    {
+        uint32_t count = (uint32_t) faultsCount, id;
+        int K;
+        appendPatternBytes(writer, &count, sizeof(uint32_t));
+        for(K = 0; K < faultsCount; K++)
+        {
+            id = (uint32_t) faults[K];
+            appendPatternBytes(writer, &id, sizeof(uint32_t));
+        }
+    }
+
+    writer->header.count++;
+    return writer->isFailed ? FALSE : TRUE;
+}
+
+/*
+ *  Writes the buffered patterns through to the file, so that a reader at the
+ *  other end of a pipe gets every complete pattern
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN flushPatternWriter( PATTERN_WRITER* writer )
+{
+    writePatternBuffer(writer);
+    if(fflush(writer->fp) != 0) writer->isFailed = TRUE;
+    return writer->isFailed ? FALSE : TRUE;
+}
+
+/*
+ *  Writes the buffered patterns and the final pattern count, and closes the file
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @return BOOLEAN - TRUE if the whole file was written, FALSE otherwise
+ */
+BOOLEAN closePatternWriter( PATTERN_WRITER* writer )
+{
+    if(writer->fp == NULL) return FALSE;
+
+    flushPatternWriter(writer);
+
+    // Streams are left to their owner and keep an unknown pattern count
+    if(writer->isStream)
+    {
+        free(writer->buffer);
+        writer->fp = NULL;
+        writer->buffer = NULL;
+        return writer->isFailed ? FALSE : TRUE;
+    }
+
+    // Files that cannot be rewound (pipes) keep an unknown pattern count
+    int savedErrno = errno;
+    if(fseek(writer->fp, 0, SEEK_SET) == 0)
+    {
+        if(fwrite(&writer->header, sizeof(PATTERN_FILE_HEADER), 1, writer->fp) != 1)
+            writer->isFailed = TRUE;
+    }
+    else errno = savedErrno;
+
+    if(fclose(writer->fp) != 0) writer->isFailed = TRUE;
+    free(writer->buffer);
+    writer->fp = NULL;
+    writer->buffer = NULL;
+
+    return writer->isFailed ? FALSE : TRUE;
+}
+
+/*
+ *  Reads the next block of the file into the reader's buffer. Whatever is
+ *  available is returned at once, so patterns coming through a pipe are read
+ *  as soon as they are written.
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @return size_t - number of bytes read, 0 at the end of the file
+ */
+static size_t fillPatternBuffer( PATTERN_READER* reader )
+{
+    ssize_t count;
+    if(reader->fp != NULL)
+    {
+        count = fread(reader->buffer + reader->size, 1, PATTERN_FILE_BLOCK_SIZE - reader->size, reader->fp);
+        if(count == 0 && ferror(reader->fp)) count = -1;
+    }
+    else
+    {
+        do count = read(reader->fd, reader->buffer + reader->size, PATTERN_FILE_BLOCK_SIZE - reader->size);
+        while(count < 0 && errno == EINTR);
+    }
+
+    if(count < 0)
+    {
+        reader->isCorrupted = TRUE;
+        return 0;
+    }
+    reader->size += (size_t) count;
+    return (size_t) count;
+}
+
+/*
+ *  Copies the next bytes of the file out of the reader's buffer, reading the
+ *  next block of the file whenever the buffer runs out
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @param  void*   data            - receives the bytes
+ *  @param  size_t  size            - number of bytes to read
+ *  @return size_t - number of bytes read, less than <size> at the end of the file
+ */
+static size_t readPatternBytes( PATTERN_READER* reader, void* data, size_t size )
+{
+    char* bytes = (char*) data;
+    size_t done = 0, chunk;
+    while(done < size)
+    {
+        if(reader->position == reader->size)
+        {
+            reader->position = reader->size = 0;
+            if(fillPatternBuffer(reader) == 0) break;
+        }
+
+        chunk = reader->size - reader->position;
+        if(chunk > size - done) chunk = size - done;
+        memcpy(bytes + done, reader->buffer + reader->position, chunk);
+        reader->position += chunk;
+        done += chunk;
+    }
+    return done;
+}
+
+/*
+ *  Reads the next line of a text pattern file into the reader's line buffer
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @return BOOLEAN - TRUE if a line was read, FALSE at the end of the file
+ */
+static BOOLEAN readPatternLine( PATTERN_READER* reader )
+{
+    size_t length = 0, chunk;
+    char* end;
+    BOOLEAN isEnded = FALSE;
+
+    while(isEnded == FALSE)
+    {
+        if(reader->position == reader->size)
+        {
+            reader->position = reader->size = 0;
+            if(fillPatternBuffer(reader) == 0)
+            {
+                if(length == 0) return FALSE;
+                break;
+            }
+        }
+
+        end = memchr(reader->buffer + reader->position, '\n', reader->size - reader->position);
+        chunk = (end != NULL) ? (size_t) (end - (reader->buffer + reader->position)) + 1
+                              : reader->size - reader->position;
+        isEnded = (end != NULL);
+
+        // Lines are only as long as the longest line of the file
+        if(length + chunk + 1 > reader->lineCapacity)
+        {
+            size_t capacity = (reader->lineCapacity > 0) ? reader->lineCapacity : MAX_LINE_LENGTH;
+            while(capacity < length + chunk + 1) capacity *= 2;
+            char* line = (char*) realloc(reader->line, capacity);
+            if(line == NULL)
+            {
+                reader->isCorrupted = TRUE;
+                return FALSE;
+            }
+            reader->line = line;
+            reader->lineCapacity = capacity;
+        }
+
+        memcpy(reader->line + length, reader->buffer + reader->position, chunk);
+        reader->position += chunk;
+        length += chunk;
+    }
+
+    reader->line[length] = '\0';
+    reader->lineNumber++;
+    return TRUE;
+}
+
+/*
+ *  Measures the run of logic values that starts a text
+ *
+ *  @param  const char* text    - the text
+ *  @param  const char* values  - the accepted logic values
+ *  @return int - length of the run
+ */
+static int countLogicValues( const char* text, const char* values )
+{
+    int length = 0;
+    while(text[length] != '\0' && strchr(values, text[length]) != NULL) length++;
+    return length;
+}
+
+/*
+ *  Reads the next pattern of a text pattern file. Patterns are either lines of
+ *  a test pattern file (test <number>: <input> <output> ...) or bare lines of
+ *  input values optionally followed by output values; other lines are skipped.
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @param  TEST_VECTOR* tv         - receives the pattern's values
+ *  @return BOOLEAN - TRUE if a pattern was read, FALSE at the end of the file or
+ *                    if the file is corrupted
+ */
+static BOOLEAN readTextPattern( PATTERN_READER* reader, TEST_VECTOR* tv )
+{
+    char* p;
+    int length;
+    while(readPatternLine(reader))
+    {
+        p = reader->line;
+        while(*p == ' ' || *p == '\t') p++;
+        if(strncmp(p, "test", 4) == 0)
+        {
+            p = strchr(p, ':');
+            if(p == NULL) continue;
+            p++;
+            while(*p == ' ' || *p == '\t') p++;
+        }
+
+        // The input values must be a whole word
+        length = countLogicValues(p, "01xX");
+        if(length == 0 || (p[length] != '\0' && strchr(" \t\r\n", p[length]) == NULL)) continue;
+        packCube(&tv->input, p, length);
+
+        p += length;
+        while(*p == ' ' || *p == '\t') p++;
+        length = countLogicValues(p, "01xXDB");
+        packCube(&tv->output, p, length);
+        tv->faults_count = 0;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*
+ *  Opens a binary or a text test pattern file for reading
+ *
+ *  @param  PATTERN_READER* reader  - the reader to be opened
+ *  @param  char*   filename        - the pattern file's filename, "-" for the
+ *                                    standard input
+ *  @return BOOLEAN - TRUE if the file was opened, FALSE otherwise
+ */
+BOOLEAN openPatternReader( PATTERN_READER* reader, char* filename )
+{
+    bzero(reader, sizeof(PATTERN_READER));
+
+    if(isCompressedFilename(filename))
+    {
+        reader->fd = -1;
+        reader->fp = openDataFile(filename, "rb");
+        if(reader->fp == NULL) return FALSE;
+    }
+    else
+    {
+        reader->fd = (strcmp(filename, "-") == 0) ? STDIN_FILENO : open(filename, O_RDONLY);
+        if(reader->fd < 0) return FALSE;
+    }
+
+    // Read enough of the file to tell the binary format apart
+    reader->buffer = (char*) malloc(PATTERN_FILE_BLOCK_SIZE);
+    if(reader->buffer == NULL)
+    {
+        closePatternReader(reader);
+        return FALSE;
+    }
+    while(reader->size < sizeof(PATTERN_FILE_HEADER) && fillPatternBuffer(reader) > 0);
+
+    if(reader->size < sizeof(PATTERN_FILE_MAGIC) ||
+       memcmp(reader->buffer, PATTERN_FILE_MAGIC, sizeof(PATTERN_FILE_MAGIC)) != 0)
+    {
+        if(reader->isCorrupted)
+        {
+            closePatternReader(reader);
+            return FALSE;
+        }
+        reader->isText = TRUE;
+        return TRUE;
+    }
+
+    if(readPatternBytes(reader, &reader->header, sizeof(PATTERN_FILE_HEADER)) != sizeof(PATTERN_FILE_HEADER) ||
+       reader->header.version != PATTERN_FILE_VERSION ||
+       reader->header.byteOrder != PATTERN_FILE_BYTE_ORDER ||
+       reader->header.numPI < 0 || reader->header.numPO < 0)
+    {
+        closePatternReader(reader);
+        return FALSE;
+    }
+
+    // A pattern cannot list more fault ids than the file holds bytes for;
+    // compressed files and pipes only bound them by what is read
+    struct stat status;
+    reader->maxFaultIds = INT_MAX;
+    if(reader->fd >= 0 && fstat(reader->fd, &status) == 0 && S_ISREG(status.st_mode) &&
+       (uint64_t) status.st_size / sizeof(uint32_t) < INT_MAX)
+        reader->maxFaultIds = (uint32_t) (status.st_size / sizeof(uint32_t));
+
+    reader->inWords  = CUBE_WORDS(reader->header.numPI);
+    reader->outWords = CUBE_WORDS(reader->header.numPO);
+    reader->planes = (uint64_t*) malloc((2 * (reader->inWords + reader->outWords) + 1) * sizeof(uint64_t));
+    if(reader->planes == NULL)
+    {
+        closePatternReader(reader);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*
+ *  Reads the next pattern of the file into the test cubes of a test vector,
+ *  composite values reading as their fault-free values. The detected fault ids
+ *  are left in the reader.
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @param  TEST_VECTOR* tv         - receives the pattern's values
+ *  @return BOOLEAN - TRUE if a pattern was read, FALSE at the end of the file or
+ *                    if the file is corrupted
+ */
+BOOLEAN readPattern( PATTERN_READER* reader, TEST_VECTOR* tv )
+{
+    size_t planesSize = 2 * (reader->inWords + reader->outWords) * sizeof(uint64_t);
+    size_t done;
+
+    reader->numFaultIds = 0;
+    if(reader->isCorrupted) return FALSE;
+    if(reader->isText) return readTextPattern(reader, tv);
+
+    // A clean end of the file falls between two patterns
+    done = readPatternBytes(reader, reader->planes, planesSize);
+    if(done == 0 && planesSize > 0 && reader->size == 0 && reader->isCorrupted == FALSE) return FALSE;
+    if(done != planesSize)
+    {
+        reader->isCorrupted = TRUE;
+        return FALSE;
+    }
+
+    if(reader->header.flags & PATTERN_FILE_FAULT_IDS)
+    {
+        uint32_t count, limit, chunk;
+        limit = (reader->numFaults > 0) ? (uint32_t) reader->numFaults : reader->maxFaultIds;
+        if(readPatternBytes(reader, &count, sizeof(uint32_t)) != sizeof(uint32_t) || count > limit)
+        {
+            reader->isCorrupted = TRUE;
+            return FALSE;
+        }
+
+        // The ids are read a block at a time, so that a count the file does not
+        // hold ids for ends the file before taking memory
+        for(done = 0; done < count; done += chunk)
+        {
+            chunk = count - (uint32_t) done;
+            if(chunk > PATTERN_FILE_BLOCK_SIZE / sizeof(uint32_t)) chunk = PATTERN_FILE_BLOCK_SIZE / sizeof(uint32_t);
+            if(done + chunk > (size_t) reader->faultIdsCapacity)
+            {
+                size_t capacity = 2 * (size_t) reader->faultIdsCapacity;
+                if(capacity < done + chunk) capacity = done + chunk;
+                if(capacity > count) capacity = count;
+                uint32_t* ids = (uint32_t*) realloc(reader->faultIds, capacity * sizeof(uint32_t));
+                if(ids == NULL)
+                {
+                    reader->isCorrupted = TRUE;
+                    return FALSE;
+                }
+                reader->faultIds = ids;
+                reader->faultIdsCapacity = (int) capacity;
+            }
+            if(readPatternBytes(reader, reader->faultIds + done, chunk * sizeof(uint32_t)) != chunk * sizeof(uint32_t))
+            {
+                reader->isCorrupted = TRUE;
+                return FALSE;
+            }
+        }
+        for(done = 0; reader->numFaults > 0 && done < count; done++)
+            if(reader->faultIds[done] >= (uint32_t) reader->numFaults)
+            {
+                reader->isCorrupted = TRUE;
+                return FALSE;
+            }
+        reader->numFaultIds = (int) count;
+    }
+
+    const uint64_t* inCare   = reader->planes;
+    const uint64_t* inValue  = inCare + reader->inWords;
+    const uint64_t* outCare  = inValue + reader->inWords;
+    const uint64_t* outValue = outCare + reader->outWords;
+    clearCube(&tv->input, reader->header.numPI);
+    memcpy(tv->input.care, inCare, reader->inWords * sizeof(uint64_t));
+    memcpy(tv->input.value, inValue, reader->inWords * sizeof(uint64_t));
+    clearCube(&tv->output, reader->header.numPO);
+    memcpy(tv->output.care, outCare, reader->outWords * sizeof(uint64_t));
+    memcpy(tv->output.value, outValue, reader->outWords * sizeof(uint64_t));
+    tv->faults_count = 0;
+
+    return TRUE;
+}
+
+/*
+ *  Reads the next patterns of the file into consecutive test vectors, such as
+ *  a block of as many patterns as the fault simulation kernel runs at once.
+ *  Only the fault ids of the last pattern read are left in the reader.
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @param  TEST_VECTOR* tv         - receives the patterns' values, <count> test vectors
+ *  @param  int     count           - the number of patterns to read
+ *  @return int - the number of patterns read, less than <count> at the end of the
+ *                file or if the file is corrupted
+ */
+int readPatternBlock( PATTERN_READER* reader, TEST_VECTOR* tv, int count )
+{
+    int P;
+    for(P = 0; P < count && readPattern(reader, &tv[P]); P++);
+    return P;
+}
+
+/*
+ *  Closes a pattern file reader and releases its buffers
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @return nothing
+ */
+void closePatternReader( PATTERN_READER* reader )
+{
+    if(reader->fd > STDIN_FILENO) close(reader->fd);
+    if(reader->fp != NULL) fclose(reader->fp);
+    free(reader->buffer);
+    free(reader->planes);
+    free(reader->faultIds);
+    free(reader->line);
+
+    reader->fd       = -1;
+    reader->fp       = NULL;
+    reader->line     = NULL;
+    reader->lineCapacity = 0;
+    reader->buffer   = NULL;
+    reader->planes   = NULL;
+    reader->faultIds = NULL;
+    reader->faultIdsCapacity = 0;
+    reader->numFaultIds = 0;
+}
+
+/*
+ *  Checks if a file is a binary test pattern file
+ *
+ *  @param  char*   filename - the file to check
+ *  @return BOOLEAN - TRUE if the file starts as a binary pattern file
+ */
+BOOLEAN isPatternFile( char* filename )
+{
+    char magic[sizeof(PATTERN_FILE_MAGIC)];
+    FILE* fp = openDataFile(filename, "rb");
+    if(fp == NULL) return FALSE;
+
+    BOOLEAN status = (fread(magic, 1, sizeof(magic), fp) == sizeof(magic) &&
+                      memcmp(magic, PATTERN_FILE_MAGIC, sizeof(magic)) == 0);
+    fclose(fp);
+    return status;
+}
@@ -0,0 +1,234 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  pattern_file.h
+ *
+ *    Description:  Bit-packed binary test pattern files
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef PATTERN_FILE_H
+#define PATTERN_FILE_H
+
+
+/*
+ *  Binary test pattern file identification
+ */
+#define PATTERN_FILE_MAGIC          "ATPGTVB"
+#define PATTERN_FILE_VERSION        1
+#define PATTERN_FILE_BYTE_ORDER     0x01020304
+
+/*
+ *  Binary test pattern file flags
+ */
+#define PATTERN_FILE_FAULT_IDS      0x1     // Patterns carry the ids of the faults they detect
+
+/*
+ *  Size of the blocks patterns are written and read in
+ */
+#define PATTERN_FILE_BLOCK_SIZE     (1 << 20)
+
+/*
+ *  Header of a binary test pattern file. Every pattern that follows is made of
+ *  bit-planes of 64-bit words: the care and value planes of the inputs, then
+ *  the care and value planes of the expected outputs. A cleared care bit is a
+ *  don't-care (x). With PATTERN_FILE_FAULT_IDS, the planes are followed by the
+ *  number of detected faults and their ids as 32-bit integers.
+ */
+typedef struct
+{
+    char     magic[8];          // PATTERN_FILE_MAGIC
+    uint32_t version;           // PATTERN_FILE_VERSION
+    uint32_t byteOrder;         // PATTERN_FILE_BYTE_ORDER as written
+    uint64_t netlistHash;       // Hash of the .bench file the patterns apply to
+    int32_t  numPI;             // Bits of the input planes
+    int32_t  numPO;             // Bits of the output planes
+    uint32_t flags;             // PATTERN_FILE_* flags
+    uint32_t count;             // Number of patterns, 0 if the file was not closed
+} PATTERN_FILE_HEADER;
+
+/*
+ *  Buffered writer of a binary test pattern file
+ */
+typedef struct
+{
+    FILE*   fp;
+    PATTERN_FILE_HEADER header;
+    int     inWords;            // 64-bit words of an input plane
+    int     outWords;           // 64-bit words of an output plane
+    char*   buffer;             // Patterns not written yet
+    size_t  size;
+    BOOLEAN isFailed;           // TRUE once a write failed
+    BOOLEAN isStream;           // TRUE if the file is owned by the caller
+} PATTERN_WRITER;
+
+/*
+ *  Streaming reader of a binary or text test pattern file
+ */
+typedef struct
+{
+    int     fd;
+    FILE*   fp;                 // Compressed file, read in place of <fd>
+    BOOLEAN isText;             // TRUE for a text pattern file, which has no header
+    PATTERN_FILE_HEADER header;
+    int     inWords;            // 64-bit words of an input plane
+    int     outWords;           // 64-bit words of an output plane
+    char*   buffer;             // Bytes read ahead from the file
+    size_t  size;
+    size_t  position;
+    uint64_t* planes;           // Planes of the last pattern read
+    uint32_t* faultIds;         // Ids of the faults detected by the last pattern read
+    int     numFaultIds;
+    int     faultIdsCapacity;
+    int     numFaults;          // Size of the fault list the ids refer to, 0 if unknown
+    uint32_t maxFaultIds;       // Most fault ids a pattern can list, from the size of the file
+    char*   line;               // Last line read from a text pattern file
+    size_t  lineCapacity;
+    int     lineNumber;
+    BOOLEAN isCorrupted;        // TRUE if the file ends inside a pattern or holds an invalid one
+} PATTERN_READER;
+
+
+/*
+ *  Creates a binary test pattern file
+ *
+ *  @param  PATTERN_WRITER* writer  - the writer to be opened
+ *  @param  char*   filename        - the pattern file's filename
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @param  BOOLEAN isFaultIdsSaved - TRUE to save the ids of the detected faults
+ *  @return BOOLEAN - TRUE if the file was created, FALSE otherwise
+ */
+BOOLEAN openPatternWriter( PATTERN_WRITER* writer, char* filename, CIRCUIT_INFO* info,
+                           uint64_t netlistHash, BOOLEAN isFaultIdsSaved );
+
+/*
+ *  Starts a binary test pattern stream into an already open file, such as a
+ *  pipe. The file is flushed but not closed by closePatternWriter.
+ *
+ *  @param  PATTERN_WRITER* writer  - the writer to be opened
+ *  @param  FILE*   fp              - the open file
+ *  @param  CIRCUIT_INFO* info      - summary of circuit details
+ *  @param  uint64_t netlistHash    - hash of the circuit's netlist file
+ *  @param  BOOLEAN isFaultIdsSaved - TRUE to save the ids of the detected faults
+ *  @return BOOLEAN - TRUE if the stream was started, FALSE otherwise
+ */
+BOOLEAN openPatternStream( PATTERN_WRITER* writer, FILE* fp, CIRCUIT_INFO* info,
+                           uint64_t netlistHash, BOOLEAN isFaultIdsSaved );
+
+/*
+ *  Appends a test vector to the pattern file
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @param  TEST_VECTOR* tv         - the test vector
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN writePattern( PATTERN_WRITER* writer, TEST_VECTOR* tv );
+
+/*
+ *  Appends a test pattern given by its test cubes and detected faults to the
+ *  pattern file, the words of the test cubes being the bit-planes
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @param  const TEST_CUBE* input  - the input gates values, <numPI> wide
+ *  @param  const TEST_CUBE* output - the output gates values, at most <numPO> wide
+ *  @param  int     faultsCount     - number of detected faults
+ *  @param  const int32_t* faults   - positions of the detected faults in the fault list
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN writePatternCubes( PATTERN_WRITER* writer, const TEST_CUBE* input, const TEST_CUBE* output,
+                           int faultsCount, const int32_t* faults );
+
+/*
+ *  Writes the buffered patterns through to the file, so that a reader at the
+ *  other end of a pipe gets every complete pattern
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @return BOOLEAN - TRUE if no write failed so far, FALSE otherwise
+ */
+BOOLEAN flushPatternWriter( PATTERN_WRITER* writer );
+
+/*
+ *  Writes the buffered patterns and the final pattern count, and closes the file
+ *
+ *  @param  PATTERN_WRITER* writer  - an open writer
+ *  @return BOOLEAN - TRUE if the whole file was written, FALSE otherwise
+ */
+BOOLEAN closePatternWriter( PATTERN_WRITER* writer );
+
+/*
+ *  Opens a binary or a text test pattern file for reading. Files that do not
+ *  start as a binary pattern file are read as text: either lines of a test
+ *  pattern file (test <number>: <input> <output> ...) or bare lines of input
+ *  values optionally followed by output values. Other lines are skipped.
+ *  Files named *.gz are decompressed as they are read.
+ *
+ *  @param  PATTERN_READER* reader  - the reader to be opened
+ *  @param  char*   filename        - the pattern file's filename, "-" for the
+ *                                    standard input
+ *  @return BOOLEAN - TRUE if the file was opened, FALSE otherwise
+ */
+BOOLEAN openPatternReader( PATTERN_READER* reader, char* filename );
+
+/*
+ *  Reads the next pattern of the file into the test cubes of a test vector,
+ *  composite values reading as their fault-free values. The detected fault ids
+ *  are left in the reader. A pattern listing more faults than the file can
+ *  hold is corrupted, and with <numFaults> set, one listing more faults or a
+ *  fault beyond the fault list.
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @param  TEST_VECTOR* tv         - receives the pattern's values
+ *  @return BOOLEAN - TRUE if a pattern was read, FALSE at the end of the file or
+ *                    if the file is corrupted
+ */
+BOOLEAN readPattern( PATTERN_READER* reader, TEST_VECTOR* tv );
+
+/*
+ *  Reads the next patterns of the file into consecutive test vectors, such as
+ *  a block of as many patterns as the fault simulation kernel runs at once.
+ *  Only the fault ids of the last pattern read are left in the reader.
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @param  TEST_VECTOR* tv         - receives the patterns' values, <count> test vectors
+ *  @param  int     count           - the number of patterns to read
+ *  @return int - the number of patterns read, less than <count> at the end of the
+ *                file or if the file is corrupted
+ */
+int readPatternBlock( PATTERN_READER* reader, TEST_VECTOR* tv, int count );
+
+/*
+ *  Closes a pattern file reader and releases its buffers
+ *
+ *  @param  PATTERN_READER* reader  - an open reader
+ *  @return nothing
+ */
+void closePatternReader( PATTERN_READER* reader );
+
+/*
+ *  Checks if a file is a binary test pattern file
+ *
+ *  @param  char*   filename - the file to check
+ *  @return BOOLEAN - TRUE if the file starts as a binary pattern file
+ */
+BOOLEAN isPatternFile( char* filename );
+
+#endif
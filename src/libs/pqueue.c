@@ -17,7 +17,7 @@
 /* Util macros */
 #define LEFT(x) (2 * (x) + 1)
 #define RIGHT(x) (2 * (x) + 2)
-#define PARENT(x) ((x) / 2)
+#define PARENT(x) (((x) - 1) / 2)
 
 void pqueue_heapify(PQueue *q, size_t idx);
 
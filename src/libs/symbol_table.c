@@ -0,0 +1,208 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  symbol_table.c
+ *
+ *    Description:  Growable symbol table interning gate names. Names live in a
+ *                  single arena and slots keep the full hash of their name so
+ *                  that most mismatching probes are rejected without comparing
+ *                  the names.
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* malloc, realloc, free, exit */
+#include <stdlib.h>
+
+/* memcmp, memcpy, memset */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+#include "symbol_table.h"
+#include "hash.h"
+
+
+/*
+ *  Smallest number of slots and arena bytes allocated
+ */
+#define MIN_SYMBOL_SLOTS    1024
+#define MIN_SYMBOL_ARENA    (16 * 1024)
+
+
+/*
+ *  Hashes the first <len> characters of <name> for the symbol table
+ *
+ *  @param  const char* name - the name (not necessarily null terminated)
+ *  @param  int     len      - length of the name
+ *  @return uint32_t - the name's hash
+ */
+uint32_t hashSymbol( const char* name, int len )
+{
+    return hashBytesToUInt32(name, len);
+}
+
+/*
+ *  Replaces the slots of the table with <capacity> slots and reinserts the
+ *  interned names
+ */
+static void rehashSymbolTable( SYMBOL_TABLE* table, int capacity )
+{
+    SYMBOL_SLOT* slots = (SYMBOL_SLOT*) malloc(capacity * sizeof(SYMBOL_SLOT));
+    if(slots == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+    memset(slots, 0xFF, capacity * sizeof(SYMBOL_SLOT));    // Every id is -1
+
+    uint32_t mask = capacity - 1, L;
+    int K;
+    for(K = 0; K < table->capacity; K++)
+    {
+        if(table->slots[K].id < 0) continue;
+
+        L = table->slots[K].hash & mask;
+        while(slots[L].id >= 0) L = (L + 1) & mask;
+        slots[L] = table->slots[K];
+    }
+
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
+}
+
+/*
+ *  Finds the id of an interned name
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @param  const char* name    - the name (not necessarily null terminated)
+ *  @param  int     len         - length of the name
+ *  @param  uint32_t hash       - the name's hash given by hashSymbol
+ *  @return int - the name's id or -1 if the name is not interned
+ */
+int findSymbol( SYMBOL_TABLE* table, const char* name, int len, uint32_t hash )
+{
+#ifndef NDEBUG
+    table->lookups++;
+#endif
+    if(table->capacity == 0) return -1;
+
+    uint32_t mask = table->capacity - 1;
+    uint32_t K = hash & mask;
+    SYMBOL_SLOT* slot;
+
+    for(slot = &table->slots[K]; slot->id >= 0; slot = &table->slots[K])
+    {
+        if(slot->hash == hash && slot->len == len &&
+           memcmp(table->arena + slot->offset, name, len) == 0)
+            return slot->id;
+
+        K = (K + 1) & mask;
+    }
+    return -1;
+}
+
+/*
+ *  Interns a name with the given id. A name that is already interned keeps its
+ *  first id. The table grows as needed.
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @param  const char* name    - the name (not necessarily null terminated)
+ *  @param  int     len         - length of the name
+ *  @param  uint32_t hash       - the name's hash given by hashSymbol
+ *  @param  int     id          - the id of a new name
+ *  @return int - the id of the name
+ */
+int internSymbol( SYMBOL_TABLE* table, const char* name, int len, uint32_t hash, int id )
+{
+    // Keep the table at most half full
+    if(2 * (table->count + 1) > table->capacity)
+        rehashSymbolTable(table, (table->capacity < MIN_SYMBOL_SLOTS) ?
+                                 MIN_SYMBOL_SLOTS : 2 * table->capacity);
+
+    uint32_t mask = table->capacity - 1;
+    uint32_t K = hash & mask;
+    SYMBOL_SLOT* slot;
+
+    for(slot = &table->slots[K]; slot->id >= 0; slot = &table->slots[K])
+    {
+        if(slot->hash == hash && slot->len == len &&
+           memcmp(table->arena + slot->offset, name, len) == 0)
+            return slot->id;
+
+        K = (K + 1) & mask;
+    }
+
+    // Append the name to the arena
+    if(table->arenaSize + len + 1 > table->arenaCapacity)
+    {
+        size_t capacity = (table->arenaCapacity < MIN_SYMBOL_ARENA) ?
+                          MIN_SYMBOL_ARENA : table->arenaCapacity;
+        while(table->arenaSize + len + 1 > capacity) capacity *= 2;
+
+        char* arena = (char*) realloc(table->arena, capacity);
+        if(arena == NULL)
+        {
+            errno = ENOMEM;
+            exit(1);
+        }
+        table->arena = arena;
+        table->arenaCapacity = capacity;
+    }
+    memcpy(table->arena + table->arenaSize, name, len);
+    table->arena[table->arenaSize + len] = '\0';
+
+    slot->hash   = hash;
+    slot->id     = id;
+    slot->offset = (uint32_t) table->arenaSize;
+    slot->len    = len;
+
+    table->arenaSize += len + 1;
+    table->count++;
+
+    return id;
+}
+
+/*
+ *  Makes room for at least <count> names without growing the table
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @param  int     count       - the expected number of names
+ *  @return nothing
+ */
+void reserveSymbolTable( SYMBOL_TABLE* table, int count )
+{
+    int capacity = (table->capacity < MIN_SYMBOL_SLOTS) ? MIN_SYMBOL_SLOTS : table->capacity;
+    while(2 * count > capacity) capacity *= 2;
+
+    if(capacity > table->capacity) rehashSymbolTable(table, capacity);
+}
+
+/*
+ *  Releases the slots and names of the symbol table and empties it
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @return nothing
+ */
+void releaseSymbolTable( SYMBOL_TABLE* table )
+{
+    free(table->slots);
+    free(table->arena);
+    bzero(table, sizeof(SYMBOL_TABLE));
+}
@@ -0,0 +1,79 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  symbol_table.h
+ *
+ *    Description:  Growable symbol table interning gate names
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include "atpg_types.h"
+
+
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+
+/*
+ *  Hashes the first <len> characters of <name> for the symbol table
+ *
+ *  @param  const char* name - the name (not necessarily null terminated)
+ *  @param  int     len      - length of the name
+ *  @return uint32_t - the name's hash
+ */
+uint32_t hashSymbol( const char* name, int len );
+
+/*
+ *  Finds the id of an interned name
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @param  const char* name    - the name (not necessarily null terminated)
+ *  @param  int     len         - length of the name
+ *  @param  uint32_t hash       - the name's hash given by hashSymbol
+ *  @return int - the name's id or -1 if the name is not interned
+ */
+int findSymbol( SYMBOL_TABLE* table, const char* name, int len, uint32_t hash );
+
+/*
+ *  Interns a name with the given id. A name that is already interned keeps its
+ *  first id. The table grows as needed.
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @param  const char* name    - the name (not necessarily null terminated)
+ *  @param  int     len         - length of the name
+ *  @param  uint32_t hash       - the name's hash given by hashSymbol
+ *  @param  int     id          - the id of a new name
+ *  @return int - the id of the name
+ */
+int internSymbol( SYMBOL_TABLE* table, const char* name, int len, uint32_t hash, int id );
+
+/*
+ *  Makes room for at least <count> names without growing the table
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @param  int     count       - the expected number of names
+ *  @return nothing
+ */
+void reserveSymbolTable( SYMBOL_TABLE* table, int count );
+
+/*
+ *  Releases the slots and names of the symbol table and empties it
+ *
+ *  @param  SYMBOL_TABLE* table - the symbol table
+ *  @return nothing
+ */
+void releaseSymbolTable( SYMBOL_TABLE* table );
+
+#endif
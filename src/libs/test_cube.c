@@ -0,0 +1,283 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  test_cube.c
+ *
+ *    Description:  Test cubes packed into care and value bit-vectors
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+/* FILE, fputs */
+#include <stdio.h>
+
+/* rand, malloc, free, exit */
+#include <stdlib.h>
+
+/* memcpy */
+#include <string.h>
+
+/* bzero */
+#include <strings.h>
+
+/* errno, ENOMEM */
+#include <errno.h>
+
+#include "test_cube.h"
+
+
+/*
+ *  Mask of the bits of the last word of a test cube that hold values
+ */
+#define LAST_WORD_MASK(width)   (((width) % 64) ? (((uint64_t) 1 << ((width) % 64)) - 1) : ~(uint64_t) 0)
+
+
+/*
+ *  Empties a test cube, all of its values being don't-cares. The bit-vectors
+ *  grow when the test cube is wider than any it held before.
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @param  int     width       - the number of values of the test cube
+ *  @return nothing
+ */
+void clearCube( TEST_CUBE* cube, int width )
+{
+    int words = CUBE_WORDS(width);
+    if(width > cube->capacity || cube->care == NULL)
+    {
+        // Both bit-vectors are whole words and never empty
+        int capacity = (words > 0) ? words : 1;
+        uint64_t* bits = (uint64_t*) malloc(2 * (size_t) capacity * sizeof(uint64_t));
+        if(bits == NULL)
+        {
+            errno = ENOMEM;
+            exit(1);
+        }
+        free(cube->care);
+        cube->care     = bits;
+        cube->value    = bits + capacity;
+        cube->capacity = 64 * capacity;
+    }
+
+    cube->width = width;
+    bzero(cube->care, words * sizeof(uint64_t));
+    bzero(cube->value, words * sizeof(uint64_t));
+}
+
+/*
+ *  Copies a test cube into another one, which grows to hold its values
+ *
+ *  @param  TEST_CUBE* cube     - receives the values
+ *  @param  const TEST_CUBE* other - the test cube to copy
+ *  @return nothing
+ */
+void copyCube( TEST_CUBE* cube, const TEST_CUBE* other )
+{
+    clearCube(cube, other->width);
+    if(other->width == 0) return;
+    memcpy(cube->care, other->care, CUBE_WORDS(other->width) * sizeof(uint64_t));
+    memcpy(cube->value, other->value, CUBE_WORDS(other->width) * sizeof(uint64_t));
+}
+
+/*
+ *  Frees the bit-vectors of a test cube, which is left empty
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @return nothing
+ */
+void releaseCube( TEST_CUBE* cube )
+{
+    free(cube->care);
+    bzero(cube, sizeof(TEST_CUBE));
+}
+
+/*
+ *  Sets a value of a test cube. The composite values read as their fault-free
+ *  values: D as 1 and B as 0.
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @param  int     position    - the position of the value
+ *  @param  LOGIC_VALUE value   - the value, X for a don't-care
+ *  @return nothing
+ */
+void setCubeValue( TEST_CUBE* cube, int position, LOGIC_VALUE value )
+{
+    uint64_t bit = (uint64_t) 1 << (position & 63);
+    switch(value)
+    {
+        case I:
+        case D:
+            cube->care[position >> 6]  |= bit;
+            cube->value[position >> 6] |= bit;
+            break;
+        case O:
+        case B:
+            cube->care[position >> 6]  |= bit;
+            cube->value[position >> 6] &= ~bit;
+            break;
+        default:
+            cube->care[position >> 6]  &= ~bit;
+            cube->value[position >> 6] &= ~bit;
+            break;
+    }
+}
+
+/*
+ *  Packs values given as characters into a test cube: '0', '1', 'x' or 'X',
+ *  and 'D' and 'B' read as their fault-free values
+ *
+ *  @param  TEST_CUBE* cube     - receives the values
+ *  @param  const char* text    - the values
+ *  @param  int     width       - number of values in <text>
+ *  @return nothing
+ */
+void packCube( TEST_CUBE* cube, const char* text, int width )
+{
+    int K;
+    clearCube(cube, width);
+    for(K = 0; K < width; K++)
+        switch(text[K])
+        {
+            case '1':
+            case 'D': cube->value[K >> 6] |= (uint64_t) 1 << (K & 63);
+                      // Fall through
+            case '0':
+            case 'B': cube->care[K >> 6]  |= (uint64_t) 1 << (K & 63); break;
+        }
+}
+
+/*
+ *  Unpacks a test cube into its values given as '0', '1' and 'x' characters
+ *
+ *  @param  const TEST_CUBE* cube - the test cube
+ *  @param  char*   text        - receives the values, null terminated
+ *  @return nothing
+ */
+void unpackCube( const TEST_CUBE* cube, char* text )
+{
+    int K;
+    for(K = 0; K < cube->width; K++)
+        if(CUBE_BIT(cube->care, K) == 0) text[K] = 'x';
+        else text[K] = CUBE_BIT(cube->value, K) ? '1' : '0';
+    text[K] = '\0';
+}
+
+/*
+ *  Prints the values of a test cube as '0', '1' and 'x' characters
+ *
+ *  @param  FILE*   fp          - the output file descriptor
+ *  @param  const TEST_CUBE* cube - the test cube
+ *  @return nothing
+ */
+void printCube( FILE* fp, const TEST_CUBE* cube )
+{
+    // One word of values at a time
+    char text[65];
+    int K, L, count;
+    for(K = 0; K < cube->width; K += 64)
+    {
+        count = (cube->width - K < 64) ? cube->width - K : 64;
+        for(L = 0; L < count; L++)
+            if(((cube->care[K >> 6] >> L) & 1) == 0) text[L] = 'x';
+            else text[L] = ((cube->value[K >> 6] >> L) & 1) ? '1' : '0';
+        text[count] = '\0';
+        fputs(text, fp);
+    }
+}
+
+/*
+ *  Checks that two test cubes of the same width specify no value differently
+ *
+ *  @param  const TEST_CUBE* cube  - a test cube
+ *  @param  const TEST_CUBE* other - another test cube
+ *  @return BOOLEAN - TRUE if the test cubes are compatible, FALSE otherwise
+ */
+BOOLEAN areCubesCompatible( const TEST_CUBE* cube, const TEST_CUBE* other )
+{
+    int K;
+    for(K = 0; K < CUBE_WORDS(cube->width); K++)
+        if((cube->value[K] ^ other->value[K]) & cube->care[K] & other->care[K]) return FALSE;
+    return TRUE;
+}
+
+/*
+ *  Merges the values specified by a test cube into a compatible test cube
+ *
+ *  @param  TEST_CUBE* cube     - the test cube receiving the values
+ *  @param  const TEST_CUBE* other - a test cube of the same width
+ *  @return BOOLEAN - TRUE if the test cubes were merged, FALSE if they are not
+ *                    compatible, <cube> being left unchanged
+ */
+BOOLEAN mergeCubes( TEST_CUBE* cube, const TEST_CUBE* other )
+{
+    if(areCubesCompatible(cube, other) == FALSE) return FALSE;
+
+    int K;
+    for(K = 0; K < CUBE_WORDS(cube->width); K++)
+    {
+        cube->care[K]  |= other->care[K];
+        cube->value[K] |= other->value[K];
+    }
+    return TRUE;
+}
+
+/*
+ *  Specifies every don't-care of a test cube. Random values are drawn with
+ *  rand(), one per don't-care in order.
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @param  DONTCARE_FILLING_OPTION filling - the value given to the don't-cares
+ *  @return nothing
+ */
+void fillCube( TEST_CUBE* cube, DONTCARE_FILLING_OPTION filling )
+{
+    int K, words = CUBE_WORDS(cube->width);
+    uint64_t dontCares, bit, mask;
+    for(K = 0; K < words; K++)
+    {
+        mask = (K == words - 1) ? LAST_WORD_MASK(cube->width) : ~(uint64_t) 0;
+        dontCares = ~cube->care[K] & mask;
+
+        if(filling == ONES)
+            cube->value[K] |= dontCares;
+        else if(filling == RANDOM)
+            for(; dontCares != 0; dontCares &= dontCares - 1)
+            {
+                bit = dontCares & -dontCares;
+                if(rand() % 2) cube->value[K] |= bit;
+            }
+
+        cube->care[K] = mask;
+    }
+}
+
+/*
+ *  Hashes the values of a test cube, test cubes with the same values having
+ *  the same hash
+ *
+ *  @param  const TEST_CUBE* cube - the test cube
+ *  @return uint64_t - the hash of the test cube
+ */
+uint64_t hashCube( const TEST_CUBE* cube )
+{
+    // FNV-1a over whole words, then the high bits are folded into the low ones
+    uint64_t hash = 14695981039346656037ULL ^ (uint64_t) cube->width;
+    int K;
+    for(K = 0; K < CUBE_WORDS(cube->width); K++)
+    {
+        hash = (hash ^ cube->care[K]) * 1099511628211ULL;
+        hash = (hash ^ cube->value[K]) * 1099511628211ULL;
+    }
+    return hash ^ (hash >> 29) ^ (hash >> 47);
+}
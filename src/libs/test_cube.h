@@ -0,0 +1,138 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  test_cube.h
+ *
+ *    Description:  Test cubes packed into care and value bit-vectors
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "atpg_types.h"
+
+
+#ifndef TEST_CUBE_H
+#define TEST_CUBE_H
+
+
+/*
+ *  Empties a test cube, all of its values being don't-cares. The bit-vectors
+ *  grow when the test cube is wider than any it held before.
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @param  int     width       - the number of values of the test cube
+ *  @return nothing
+ */
+void clearCube( TEST_CUBE* cube, int width );
+
+/*
+ *  Copies a test cube into another one, which grows to hold its values
+ *
+ *  @param  TEST_CUBE* cube     - receives the values
+ *  @param  const TEST_CUBE* other - the test cube to copy
+ *  @return nothing
+ */
+void copyCube( TEST_CUBE* cube, const TEST_CUBE* other );
+
+/*
+ *  Frees the bit-vectors of a test cube, which is left empty
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @return nothing
+ */
+void releaseCube( TEST_CUBE* cube );
+
+/*
+ *  Sets a value of a test cube. The composite values read as their fault-free
+ *  values: D as 1 and B as 0.
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @param  int     position    - the position of the value
+ *  @param  LOGIC_VALUE value   - the value, X for a don't-care
+ *  @return nothing
+ */
+void setCubeValue( TEST_CUBE* cube, int position, LOGIC_VALUE value );
+
+/*
+ *  Packs values given as characters into a test cube: '0', '1', 'x' or 'X',
+ *  and 'D' and 'B' read as their fault-free values
+ *
+ *  @param  TEST_CUBE* cube     - receives the values
+ *  @param  const char* text    - the values
+ *  @param  int     width       - number of values in <text>
+ *  @return nothing
+ */
+void packCube( TEST_CUBE* cube, const char* text, int width );
+
+/*
+ *  Unpacks a test cube into its values given as '0', '1' and 'x' characters
+ *
+ *  @param  const TEST_CUBE* cube - the test cube
+ *  @param  char*   text        - receives the values, null terminated
+ *  @return nothing
+ */
+void unpackCube( const TEST_CUBE* cube, char* text );
+
+/*
+ *  Prints the values of a test cube as '0', '1' and 'x' characters
+ *
+ *  @param  FILE*   fp          - the output file descriptor
+ *  @param  const TEST_CUBE* cube - the test cube
+ *  @return nothing
+ */
+void printCube( FILE* fp, const TEST_CUBE* cube );
+
+/*
+ *  Checks that two test cubes of the same width specify no value differently
+ *
+ *  @param  const TEST_CUBE* cube  - a test cube
+ *  @param  const TEST_CUBE* other - another test cube
+ *  @return BOOLEAN - TRUE if the test cubes are compatible, FALSE otherwise
+ */
+BOOLEAN areCubesCompatible( const TEST_CUBE* cube, const TEST_CUBE* other );
+
+/*
+ *  Merges the values specified by a test cube into a compatible test cube
+ *
+ *  @param  TEST_CUBE* cube     - the test cube receiving the values
+ *  @param  const TEST_CUBE* other - a test cube of the same width
+ *  @return BOOLEAN - TRUE if the test cubes were merged, FALSE if they are not
+ *                    compatible, <cube> being left unchanged
+ */
+BOOLEAN mergeCubes( TEST_CUBE* cube, const TEST_CUBE* other );
+
+/*
+ *  Specifies every don't-care of a test cube. Random values are drawn with
+ *  rand(), one per don't-care in order.
+ *
+ *  @param  TEST_CUBE* cube     - the test cube
+ *  @param  DONTCARE_FILLING_OPTION filling - the value given to the don't-cares
+ *  @return nothing
+ */
+void fillCube( TEST_CUBE* cube, DONTCARE_FILLING_OPTION filling );
+
+/*
+ *  Hashes the values of a test cube, test cubes with the same values having
+ *  the same hash
+ *
+ *  @param  const TEST_CUBE* cube - the test cube
+ *  @return uint64_t - the hash of the test cube
+ */
+uint64_t hashCube( const TEST_CUBE* cube );
+
+
+#endif
@@ -20,8 +20,10 @@
  */
 
 #include <stdlib.h>
+#include <errno.h>
 #include "globals.h"
 #include "test_generator.h"
+#include "test_cube.h"
 #include "stdio.h"
 #include "strings.h"
 
@@ -30,85 +32,88 @@ extern volatile COMMAND_LINE_OPTIONS options;
 /*
  *  Sets all gates value from the gate to the primary output as Don't-Cares (X)
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the starting gate/wire
  *  @return nothing
  */
-void clearPropagationValuesPath(CIRCUIT circuit, int index)
+void clearPropagationValuesPath(CIRCUIT* circuit, int index)
 {
 	// Clear all the input lines to the current gate
 	int K, J;
-	for(K = 0; K < circuit[index]->numIn; K++)
+	for(K = 0; K < NUM_FANIN(circuit, index); K++)
 	{
 		// Clear main segment
-		circuit[circuit[index]->in[K]]->value = X;
+		setGateValue(circuit, FANIN(circuit, index, K), X);
 
 		// Clear fan out segments
-		if(circuit[circuit[index]->in[K]]->numOut > 1)
-			for(J = 0; J < circuit[circuit[index]->in[K]]->numOut; J++)
-				circuit[circuit[index]->in[K]]->values[J] = X;
+		if(NUM_FANOUT(circuit, FANIN(circuit, index, K)) > 1)
+			for(J = 0; J < NUM_FANOUT(circuit, FANIN(circuit, index, K)); J++)
+				BRANCH_VALUE(circuit, FANIN(circuit, index, K), J) = X;
 
 		for(J = 0; J < MAX_LOGIC_VALUES; J++)
-			circuit[circuit[index]->in[K]]->justified[J].state = FALSE;
+			JUSTIFIED(circuit, FANIN(circuit, index, K), J).state = FALSE;
 	}
 
 	// Stop when reaching a primary output or continue otherwise
-	if(circuit[index]->PO == TRUE)
+	if(circuit->PO[index] == TRUE)
 		return;
 	else
-		for(K = 0; K < circuit[index]->numOut; K++)
-			clearPropagationValuesPath(circuit, circuit[index]->out[K]);
+		for(K = 0; K < NUM_FANOUT(circuit, index); K++)
+			clearPropagationValuesPath(circuit, FANOUT(circuit, index, K));
 }
 
 /*
- *  Clear propagation values for the entire circuit
+ *  Clear propagation values for the entire circuit, every input of the wide
+ *  gates being counted as X again
  *
- *  @param  CIRCUIT circuit - the circuit
+ *  @param  CIRCUIT* circuit - the circuit
  *  @param  int 	info  	- the maximum number of gates
  *  @return nothing
  */
-void clearPropagationValuesCircuit(CIRCUIT circuit, int numGates)
+void clearPropagationValuesCircuit(CIRCUIT* circuit, int numGates)
 {
 	int index, J;
 	for(index = 0; index < numGates; index++)
 	{
 		// Clear main segment
-		circuit[index]->value = X;
+		circuit->value[index] = X;
+		resetInputCounts(circuit, index);
 
 		// Clear fan out segments
-		if(circuit[index]->numOut > 1)
-			for(J = 0; J < circuit[index]->numOut; J++)
-				circuit[index]->values[J] = X;
+		if(NUM_FANOUT(circuit, index) > 1)
+			for(J = 0; J < NUM_FANOUT(circuit, index); J++)
+				BRANCH_VALUE(circuit, index, J) = X;
 	}
 }
 
 /*
  *  Excites to the primary input the value given to a circuit line
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the position of the gate in the <circuit>
  *  @param  int 		indexOut- the position of the fan out segment if present
  *  @param  LOGIC_VALUE	log_val	- the logical value to excite the given gate with
  *  @return BOOLEAN -  TRUE	 if the value can be excited and FALSE otherwise
  */
-BOOLEAN excite(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
+BOOLEAN excite(CIRCUIT* circuit, int index, int indexOut, LOGIC_VALUE log_val)
 {
 	/*
 	if(indexOut < 0)
-		printf("Excite(%s with '%c')\n", circuit[index]->name, logicName(log_val, FALSE));
+		printf("Excite(%s with '%c')\n", GATE_NAME(circuit, index), logicName(log_val, FALSE));
 	else
-		printf("Excite(%s->%s with '%c')\n", circuit[index]->name, circuit[indexOut]->name, 
+		printf("Excite(%s->%s with '%c')\n", GATE_NAME(circuit, index), GATE_NAME(circuit, indexOut), 
 				logicName(log_val, FALSE));
 	*/
 
 	int K, L;
 	// Excite fanout segments if available
-	if(circuit[index]->numOut > 1 && indexOut >= 0)
+	if(NUM_FANOUT(circuit, index) > 1 && indexOut >= 0)
 	{
-		for(K = 0; K < circuit[index]->numOut; K++)
-			if(circuit[index]->out[K] != indexOut)
-				circuit[index]->values[K] = (log_val == X ? X : ((log_val == D || log_val == I) ? I : O));
-		circuit[index]-> value = (log_val == X ? X : ((log_val == D || log_val == I) ? I : O));
+		int branch = findFanoutBranch(circuit, index, indexOut);
+		for(K = circuit->fanoutStart[index]; K < circuit->fanoutStart[index + 1]; K++)
+			if(K != branch)
+				circuit->branchValue[K] = (log_val == X ? X : ((log_val == D || log_val == I) ? I : O));
+		setGateValue(circuit, index, (log_val == X ? X : ((log_val == D || log_val == I) ? I : O)));
 
 		// Continue justifying the main segment
 		indexOut = -1;
@@ -116,37 +121,37 @@ BOOLEAN excite(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
 
 		/*
 		if(indexOut < 0)
-			printf("Excite(%s with '%c')\n", circuit[index]->name, logicName(log_val, FALSE));
+			printf("Excite(%s with '%c')\n", GATE_NAME(circuit, index), logicName(log_val, FALSE));
 		else
-			printf("Excite(%s->%s with '%c')\n", circuit[index]->name, circuit[indexOut]->name, 
+			printf("Excite(%s->%s with '%c')\n", GATE_NAME(circuit, index), GATE_NAME(circuit, indexOut), 
 					logicName(log_val, FALSE));
 		*/
 	}
 
 	// A Primary Input does not need excitation
-	if(circuit[index]->type == PI)
+	if(circuit->type[index] == PI)
 	{
-		circuit[index]->value = log_val;
+		setGateValue(circuit, index, log_val);
 
-		if(circuit[index]->numOut > 1)
-			for(K = 0; K < circuit[index]->numOut; K++)
-				circuit[index]->values[K] = log_val;
+		if(NUM_FANOUT(circuit, index) > 1)
+			for(K = 0; K < NUM_FANOUT(circuit, index); K++)
+				BRANCH_VALUE(circuit, index, K) = log_val;
 		
 		return TRUE;
 	}
 
 	// Excite a BUFFER
 	BOOLEAN results;
-	if(circuit[index]->type == BUF)
+	if(circuit->type[index] == BUF)
 	{
-		results = excite(circuit, (int) circuit[index]->in[0], -1,
-					  (LOGIC_VALUE) negate(log_val, (BOOLEAN) circuit[index]->inv));
+		results = excite(circuit, (int) FANIN(circuit, index, 0), -1,
+					  (LOGIC_VALUE) negate(log_val, (BOOLEAN) circuit->inv[index]));
 		
-		circuit[index]->value = (results == TRUE ? log_val : X);
+		setGateValue(circuit, index, (results == TRUE ? log_val : X));
 
-		if(circuit[index]->numOut > 1)
-			for(L = 0; L < circuit[index]->numOut; L++)
-				circuit[index]->values[L] = (results == TRUE ? log_val : X);
+		if(NUM_FANOUT(circuit, index) > 1)
+			for(L = 0; L < NUM_FANOUT(circuit, index); L++)
+				BRANCH_VALUE(circuit, index, L) = (results == TRUE ? log_val : X);
 
 		return results;
 	}
@@ -158,35 +163,35 @@ BOOLEAN excite(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
 
 	// Try exciting one of the current gates input
 	int inLine = 0;
-	for(; inLine < circuit[index]->numIn; inLine++)
+	for(; inLine < NUM_FANIN(circuit, index); inLine++)
 	{
-		if(excite(circuit, circuit[index]->in[inLine], -1, log_val) == TRUE)
+		if(excite(circuit, FANIN(circuit, index, inLine), -1, log_val) == TRUE)
 		{
 			LOGIC_VALUE other_value = X;
-			switch(circuit[index]->type)
+			switch(circuit->type[index])
 			{
 				case AND: 
-					if(circuit[index]->inv == FALSE) other_value = I;
+					if(circuit->inv[index] == FALSE) other_value = I;
 					else other_value = O; 
 					break;
 				case OR : 
-					if(circuit[index]->inv == FALSE) other_value = O;
+					if(circuit->inv[index] == FALSE) other_value = O;
 					else other_value = I;
 					break;
 				default : other_value = X; break;
 			}
 
-			for(K = 0; K < circuit[index]->numIn; K++)
+			for(K = 0; K < NUM_FANIN(circuit, index); K++)
 			{
-				if(K == inLine) circuit[circuit[index]->in[K]]->value = log_val;
-				else circuit[circuit[index]->in[K]]->value = other_value;
+				if(K == inLine) setGateValue(circuit, FANIN(circuit, index, K), log_val);
+				else setGateValue(circuit, FANIN(circuit, index, K), other_value);
 			}
 
-			circuit[index]->value = log_val;
+			setGateValue(circuit, index, log_val);
 			
-			if(circuit[index]->numOut > 1)
-				for(L = 0; L < circuit[index]->numOut; L++)
-					circuit[index]->values[L] = log_val;
+			if(NUM_FANOUT(circuit, index) > 1)
+				for(L = 0; L < NUM_FANOUT(circuit, index); L++)
+					BRANCH_VALUE(circuit, index, L) = log_val;
 
 
 			return TRUE;
@@ -202,24 +207,24 @@ BOOLEAN excite(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
  * 	ASSUMPTIONS: 
  *		+ Input line values have already been set during propagation
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the position of the gate in the <circuit>
  *  @param  LOGIC_VALUE	log_val	- the logical value to justify the given gate with
  *  @return BOOLEAN -  TRUE	 if the value can be justified and FALSE if the 
  *					   value causes conflicts
  */
-BOOLEAN justify(CIRCUIT circuit, int index, LOGIC_VALUE log_val)
+BOOLEAN justify(CIRCUIT* circuit, int index, LOGIC_VALUE log_val)
 {
 	/*
-	printf("---Justify(%s with '%c' found %c): \n", circuit[index]->name, logicName(log_val, FALSE), 
-			logicName(circuit[index]->value, FALSE));
+	printf("---Justify(%s with '%c' found %c): \n", GATE_NAME(circuit, index), logicName(log_val, FALSE), 
+			logicName(circuit->value[index], FALSE));
 	*/
 
 	// A Primary Input can be justified for any value
-	if(circuit[index]->type == PI)
+	if(circuit->type[index] == PI)
 	{
-		circuit[index]->justified[log_val].state = TRUE;
-		circuit[index]->justified[log_val].value = TRUE;
+		JUSTIFIED(circuit, index, log_val).state = TRUE;
+		JUSTIFIED(circuit, index, log_val).value = TRUE;
 		return TRUE;
 	}
 
@@ -227,15 +232,15 @@ BOOLEAN justify(CIRCUIT circuit, int index, LOGIC_VALUE log_val)
 	if(log_val == X) return TRUE;
 
 	// Justify a BUFFER
-	if(circuit[index]->type == BUF)
+	if(circuit->type[index] == BUF)
 	{
-		LOGIC_VALUE just_value = negate(log_val, circuit[index]->inv);
-		if(circuit[circuit[index]->in[0]]->value == X )
-			circuit[circuit[index]->in[0]]->value = just_value;
+		LOGIC_VALUE just_value = negate(log_val, circuit->inv[index]);
+		if(circuit->value[FANIN(circuit, index, 0)] == X )
+			setGateValue(circuit, FANIN(circuit, index, 0), just_value);
 
 		// TODO Justify fanout segments
 		
-		return (justify(circuit, circuit[index]->in[0], just_value));
+		return (justify(circuit, FANIN(circuit, index, 0), just_value));
 	}
 
 	// Check if the current gate's output cannot be justified from its inputs
@@ -245,8 +250,8 @@ BOOLEAN justify(CIRCUIT circuit, int index, LOGIC_VALUE log_val)
 		// Check if it is possible to justify if the Don't-Cares were manipulated
 		if(isOutputPossible(circuit, index, log_val) == FALSE)
 		{
-			circuit[index]->justified[log_val].state = TRUE;
-			circuit[index]->justified[log_val].value = FALSE;
+			JUSTIFIED(circuit, index, log_val).state = TRUE;
+			JUSTIFIED(circuit, index, log_val).value = FALSE;
 			return FALSE;
 		}
 		else break;
@@ -254,11 +259,11 @@ BOOLEAN justify(CIRCUIT circuit, int index, LOGIC_VALUE log_val)
 
 	// Justify the current gate's inputs
 	int inLine = 0;
-	for(; inLine < circuit[index]->numIn; inLine++)
-		if(justify(circuit, circuit[index]->in[inLine], circuit[circuit[index]->in[inLine]]->value) == FALSE)
+	for(; inLine < NUM_FANIN(circuit, index); inLine++)
+		if(justify(circuit, FANIN(circuit, index, inLine), circuit->value[FANIN(circuit, index, inLine)]) == FALSE)
 		{
-			circuit[index]->justified[log_val].state = TRUE;
-			circuit[index]->justified[log_val].value = FALSE;
+			JUSTIFIED(circuit, index, log_val).state = TRUE;
+			JUSTIFIED(circuit, index, log_val).value = FALSE;
 			return FALSE;
 		}
 	return TRUE;
@@ -267,21 +272,21 @@ BOOLEAN justify(CIRCUIT circuit, int index, LOGIC_VALUE log_val)
 /*
  *  Propagates to the primary output the value given to a circuit line
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the position of the gate in the <circuit>
  *  @param  int 		indexOut- the position of the fan out segment if present
  *  @param  LOGIC_VALUE	log_val	- the logical value to justify the given gate with
  *  @return BOOLEAN -  TRUE	 if the value can be justified and FALSE if the 
  *					   value causes conflicts
  */
-BOOLEAN propagate(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
+BOOLEAN propagate(CIRCUIT* circuit, int index, int indexOut, LOGIC_VALUE log_val)
 {
 	/*
 	if(indexOut < 0)
-		printf("Propagate(%s with '%c')\n", circuit[index]->name, logicName(log_val, FALSE));
+		printf("Propagate(%s with '%c')\n", GATE_NAME(circuit, index), logicName(log_val, FALSE));
 	else
-		printf("Propagate(%s->%s with '%c')\n", circuit[index]->name,
-				circuit[indexOut]->name, logicName(log_val, FALSE));
+		printf("Propagate(%s->%s with '%c')\n", GATE_NAME(circuit, index),
+				GATE_NAME(circuit, indexOut), logicName(log_val, FALSE));
 	*/
 
 	int K;
@@ -289,40 +294,39 @@ BOOLEAN propagate(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
 	// Propagate through a fanout segment
 	if(indexOut >= 0)
 	{
-		for(K = 0; K < circuit[index]->numOut; K++)
-			if(circuit[index]->out[K] == indexOut)
-				circuit[index]->values[K] = log_val;
+		int branch = findFanoutBranch(circuit, index, indexOut);
+		if(branch >= 0) circuit->branchValue[branch] = log_val;
 		index = indexOut;
 		indexOut = -1;
 
 		/*
 		if(indexOut < 0)
-			printf("Propagate(%s with '%c')\n", circuit[index]->name, logicName(log_val, FALSE));
+			printf("Propagate(%s with '%c')\n", GATE_NAME(circuit, index), logicName(log_val, FALSE));
 		else
-			printf("Propagate(%s->%s with '%c')\n", circuit[index]->name,
-					circuit[indexOut]->name, logicName(log_val, FALSE));
+			printf("Propagate(%s->%s with '%c')\n", GATE_NAME(circuit, index),
+					GATE_NAME(circuit, indexOut), logicName(log_val, FALSE));
 		*/
 	}
 
 	// Set this wire and it's fan-out segments to the propagated value
-	circuit[index]->value = log_val;
-	if(circuit[index]->numOut > 1 && indexOut < 0)
+	setGateValue(circuit, index, log_val);
+	if(NUM_FANOUT(circuit, index) > 1 && indexOut < 0)
 	{
-		for(K = 0; K < circuit[index]->numOut; K++)
-			circuit[index]->values[K] = log_val;
+		for(K = 0; K < NUM_FANOUT(circuit, index); K++)
+			BRANCH_VALUE(circuit, index, K) = log_val;
 	}
 
 	// Check if a Primary Output has been reached
 	BOOLEAN results;
-	if(circuit[index]->PO == TRUE)
+	if(circuit->PO[index] == TRUE)
 	{
 		results = justify(circuit, index, log_val);
 		if(results == FALSE) 
 		{
-			bzero(circuit[index]->propagated, sizeof(PROP_OBJECT));
+			bzero(&PROPAGATED(circuit, index, 0), sizeof(PROP_OBJECT));
 		}
-		circuit[index]->propagated[log_val].state = TRUE;
-		circuit[index]->propagated[log_val].value = results;
+		PROPAGATED(circuit, index, log_val).state = TRUE;
+		PROPAGATED(circuit, index, log_val).value = results;
 		return results;
 	}
 
@@ -333,146 +337,183 @@ BOOLEAN propagate(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val)
 
 	// Try propagating the current gate's value into a Primary Output
 	int outLine = 0, outIndex;
-	for(; outLine < circuit[index]->numOut; outLine++)
+	for(; outLine < NUM_FANOUT(circuit, index); outLine++)
 	{
 		LOGIC_VALUE other_value = X;
-		outIndex = circuit[index]->out[outLine];
-		switch(circuit[outIndex]->type)
+		outIndex = FANOUT(circuit, index, outLine);
+		switch(circuit->type[outIndex])
 		{
 			case BUF:
 			{
-				LOGIC_VALUE prop_value = negate(log_val, circuit[outIndex]->inv);
+				LOGIC_VALUE prop_value = negate(log_val, circuit->inv[outIndex]);
 				results = propagate(circuit, outIndex, -1, prop_value);
-				circuit[outIndex]->value = (results == TRUE ? prop_value : X);
+				setGateValue(circuit, outIndex, (results == TRUE ? prop_value : X));
 				if(results == TRUE) return TRUE;
 				else continue;
 			}
 			case AND: other_value = I; break;
 			case OR : other_value = O; break;
+			case XOR: other_value = O; break;
 			default : other_value = X; break;
 		}
 
-		for(K = 0; K < circuit[outIndex]->numIn; K++)
-			circuit[circuit[outIndex]->in[K]]->value = other_value;
-		circuit[index]->value = log_val;
+		for(K = 0; K < NUM_FANIN(circuit, outIndex); K++)
+			setGateValue(circuit, FANIN(circuit, outIndex, K), other_value);
+		setGateValue(circuit, index, log_val);
 
-		results = propagate(circuit, outIndex, -1, negate(log_val, circuit[outIndex]->inv));
+		results = propagate(circuit, outIndex, -1, negate(log_val, circuit->inv[outIndex]));
 		if(results == TRUE)
 		{
 			return TRUE;
 		}
 		else {
 			clearPropagationValuesPath(circuit, index);
-			circuit[index]->value = log_val;
-			if(circuit[index]->numOut > 1)
-			for(K = 0; K < circuit[index]->numOut; K++)
-				circuit[index]->values[K] = log_val;
+			setGateValue(circuit, index, log_val);
+			if(NUM_FANOUT(circuit, index) > 1)
+			for(K = 0; K < NUM_FANOUT(circuit, index); K++)
+				BRANCH_VALUE(circuit, index, K) = log_val;
 		}
 	}
 
-	circuit[index]->propagated[log_val].state = TRUE;
-	circuit[index]->propagated[log_val].value = FALSE;
+	PROPAGATED(circuit, index, log_val).state = TRUE;
+	PROPAGATED(circuit, index, log_val).value = FALSE;
 	return FALSE;
 }
 
 /*
  *  Extracts a test pattern from the current input and output values
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  CIRCUIT_INFO info  	- containing the list of inputs/outputs
  *  @param  TEST_VECTOR	tv 	- the test vector to output
  *  @return nothing
  */
-void extractTestVector(CIRCUIT circuit, CIRCUIT_INFO* info, TEST_VECTOR *tv)
+void extractTestVector(CIRCUIT* circuit, CIRCUIT_INFO* info, TEST_VECTOR *tv)
 {
-	bzero(tv->input, sizeof(tv->input));
-	bzero(tv->output, sizeof(tv->output));
-	tv->faults_count = 1;
+	tv->faults_count = 0;
 
 	//	Get values of input gates
 	int K;
-	//printf("====> Inputs # %d\n", info->numPI);
+	clearCube(&tv->input, info->numPI);
 	for(K = 0; K < info->numPI; K++)
-	{
-		switch(circuit[info->inputs[K]]->value)
-		{
-			case X: tv->input[K] = 'x'; break;
-			case I:
-			case D: tv->input[K] = '1'; break;
-			case O:
-			case B: tv->input[K] = '0'; break;
-		}
-	}
+		setCubeValue(&tv->input, K, circuit->value[info->inputs[K]]);
 
 	// Get values of output gates
+	clearCube(&tv->output, info->numPO);
 	for(K = 0; K < info->numPO; K++)
+		setCubeValue(&tv->output, K, circuit->value[info->outputs[K]]);
+}
+
+/*
+ *  Records that a test vector detects a fault
+ *
+ *  @param  TEST_VECTOR* tv 	- the test vector
+ *  @param  int 	id 		- the position of the fault in the fault list
+ *  @return nothing
+ */
+void addTestVectorFault(TEST_VECTOR* tv, int id)
+{
+	if(tv->faults_count == tv->faults_capacity)
 	{
-		switch(circuit[info->outputs[K]]->value)
+		int capacity = tv->faults_capacity > 0 ? 2 * tv->faults_capacity : 16;
+		int32_t* faults = (int32_t*) realloc(tv->faults_list, capacity * sizeof(int32_t));
+		if(faults == NULL)
 		{
-			case X: tv->output[K] = 'x'; break;
-			case I:
-			case D: tv->output[K] = '1'; break;
-			case O:
-			case B: tv->output[K] = '0'; break;
+			errno = ENOMEM;
+			exit(1);
 		}
+		tv->faults_list = faults;
+		tv->faults_capacity = capacity;
 	}
+	tv->faults_list[tv->faults_count++] = id;
 }
 
 /*
- *  Print to the standard output the given test vector
+ *  Releases the test cubes and the detected faults of a test vector
  *
- *  @param  CIRCUIT 	circuit - the circuit
- *  @param  TEST_VECTOR	tv 	- the test vector to output
- *  @param  int 	tpCount - current test patterns generated
+ *  @param  TEST_VECTOR* tv 	- the test vector
+ *  @return nothing
+ */
+void releaseTestVector(TEST_VECTOR* tv)
+{
+	releaseCube(&tv->input);
+	releaseCube(&tv->output);
+	free(tv->faults_list);
+	tv->faults_list = NULL;
+	tv->faults_count = 0;
+	tv->faults_capacity = 0;
+}
+
+/*
+ *  Prints a test vector given by its values and detected faults
+ *
+ *  @param  CIRCUIT* 	circuit 	- the circuit
+ *  @param  FAULT_LIST*	faultList	- the fault list the detected faults belong to
+ *  @param  FILE*		fp 			- the output file descriptor
+ *  @param  int 	tpCount 		- the test vector's number
+ *  @param  const TEST_CUBE* input 	- the input gates values
+ *  @param  const TEST_CUBE* output 	- the output gates values
+ *  @param  int 	faultsCount 	- total stuck-at faults the test detects
+ *  @param  const int32_t* faults 	- positions of the stuck-at faults the test detects
  *  @return nothing
  */
-void displayTestVector(CIRCUIT circuit, TEST_VECTOR* tv, int tpCount)
+void printTestVector(CIRCUIT* circuit, FAULT_LIST* faultList, FILE* fp, int tpCount, const TEST_CUBE* input,
+	const TEST_CUBE* output, int faultsCount, const int32_t* faults)
 {
-	if(options.isDebugMode) fprintf(stdout, "test %5d:\t%s\t%s\t%d", tpCount, tv->input, 
-		tv->output, tv->faults_count);
+	if(options.isDebugMode)
+	{
+		fprintf(fp, "test %5d:\t", tpCount);
+		printCube(fp, input);
+		fputc('\t', fp);
+		printCube(fp, output);
+		fprintf(fp, "\t%d", faultsCount);
+	}
 
-	if(options.debugLevel < 2) fprintf(stdout, "\n");
+	if(options.debugLevel < 2) fprintf(fp, "\n");
 	else
 	{
-		fprintf(stdout, "\t{");
+		fprintf(fp, "\t{");
 		int K;
-		for(K = 0; K < tv->faults_count; K++)
-			if(tv->faults_list[K]->indexOut < 0)
-				fprintf(stdout, " (%s, %d)", circuit[tv->faults_list[K]->index]->name, 
-					tv->faults_list[K]->type);
+		FAULT* fault;
+		for(K = 0; K < faultsCount; K++)
+		{
+			fault = &faultList->faults[faults[K]];
+			if(fault->indexOut < 0)
+				fprintf(fp, " (%s, %d)", GATE_NAME(circuit, fault->index), 
+					fault->type);
 			else
-				fprintf(stdout, " (%s->%s, %d)", circuit[tv->faults_list[K]->index]->name, 
-					circuit[tv->faults_list[K]->indexOut]->name, tv->faults_list[K]->type);
-		fprintf(stdout, " }\n");
+				fprintf(fp, " (%s->%s, %d)", GATE_NAME(circuit, fault->index), 
+					GATE_NAME(circuit, fault->indexOut), fault->type);
+		}
+		fprintf(fp, " }\n");
 	}
 }
 
+/*
+ *  Print to the standard output the given test vector
+ *
+ *  @param  CIRCUIT* 	circuit - the circuit
+ *  @param  FAULT_LIST*	faultList - the fault list the detected faults belong to
+ *  @param  TEST_VECTOR	tv 	- the test vector to output
+ *  @param  int 	tpCount - current test patterns generated
+ *  @return nothing
+ */
+void displayTestVector(CIRCUIT* circuit, FAULT_LIST* faultList, TEST_VECTOR* tv, int tpCount)
+{
+	printTestVector(circuit, faultList, stdout, tpCount, &tv->input, &tv->output, tv->faults_count, tv->faults_list);
+}
+
 /*
  *  Saves into the test pattern file the given test vector
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
+ *  @param  FAULT_LIST*	faultList - the fault list the detected faults belong to
  *  @param  TEST_VECTOR	tv 	- the test vector to output
  *  @param  FILE*		fp 	- test patterns output file descriptor
  *  @param  int 	tpCount - current test patterns generated
  *  @return nothing
  */
-void saveTestVector(CIRCUIT circuit, TEST_VECTOR* tv, FILE* fp, int tpCount)
+void saveTestVector(CIRCUIT* circuit, FAULT_LIST* faultList, TEST_VECTOR* tv, FILE* fp, int tpCount)
 {
-	if(options.isDebugMode) fprintf(fp, "test %5d:\t%s\t%s\t%d", tpCount, tv->input, 
-		tv->output, tv->faults_count);
-
-	if(options.debugLevel < 2) fprintf(fp, "\n");
-	else
-	{
-		fprintf(fp, "\t{");
-		int K;
-		for(K = 0; K < tv->faults_count; K++)
-			if(tv->faults_list[K]->indexOut < 0)
-				fprintf(fp, " (%s, %d)", circuit[tv->faults_list[K]->index]->name, 
-					tv->faults_list[K]->type);
-			else
-				fprintf(fp, " (%s->%s, %d)", circuit[tv->faults_list[K]->index]->name, 
-					circuit[tv->faults_list[K]->indexOut]->name, tv->faults_list[K]->type);
-		fprintf(fp, " }\n");
-	}
+	printTestVector(circuit, faultList, fp, tpCount, &tv->input, &tv->output, tv->faults_count, tv->faults_list);
 }
@@ -30,31 +30,32 @@
 /*
  *  Sets all gates value from the gate to the primary output as Don't-Cares (X)
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the starting gate/wire
  *  @return nothing
  */
-void clearPropagationValuesPath(CIRCUIT circuit, int index);
+void clearPropagationValuesPath(CIRCUIT* circuit, int index);
 
 /*
- *  Clear propagation values for the entire circuit
+ *  Clear propagation values for the entire circuit, every input of the wide
+ *  gates being counted as X again
  *
- *  @param  CIRCUIT circuit - the circuit
+ *  @param  CIRCUIT* circuit - the circuit
  *  @param  int 	info  	- the maximum number of gates
  *  @return nothing
  */
-void clearPropagationValuesCircuit(CIRCUIT circuit, int numGates);
+void clearPropagationValuesCircuit(CIRCUIT* circuit, int numGates);
 
 /*
  *  Excites to the primary input the value given to a circuit line
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the position of the gate in the <circuit>
  *  @param  int 		indexOut- the position of the fan out segment if present
  *  @param  LOGIC_VALUE	log_val	- the logical value to excite the given gate with
  *  @return BOOLEAN -  TRUE	 if the value can be excited and FALSE otherwise
  */
-BOOLEAN excite(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val);
+BOOLEAN excite(CIRCUIT* circuit, int index, int indexOut, LOGIC_VALUE log_val);
 
 /*
  *  Justifies to the primary input the value given to a circuit line
@@ -62,55 +63,90 @@ BOOLEAN excite(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val);
  * 	ASSUMPTIONS: 
  *		+ Input line values have already been set during propagation
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the position of the gate in the <circuit>
  *  @param  LOGIC_VALUE	log_val	- the logical value to justify the given gate with
  *  @return BOOLEAN -  TRUE	 if the value can be justified and FALSE if the 
  *					   value causes conflicts
  */
-BOOLEAN justify(CIRCUIT circuit, int index, LOGIC_VALUE log_val);
+BOOLEAN justify(CIRCUIT* circuit, int index, LOGIC_VALUE log_val);
 
 /*
  *  Propagates to the primary output the value given to a circuit line
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  int 		index  	- the position of the gate in the <circuit>
  *  @param  int 		indexOut- the position of the fan out segment if present
  *  @param  LOGIC_VALUE	log_val	- the logical value to justify the given gate with
  *  @return BOOLEAN -  TRUE	 if the value can be justified and FALSE if the 
  *					   value causes conflicts
  */
-BOOLEAN propagate(CIRCUIT circuit, int index, int indexOut, LOGIC_VALUE log_val);
+BOOLEAN propagate(CIRCUIT* circuit, int index, int indexOut, LOGIC_VALUE log_val);
 
 /*
  *  Extracts a test pattern from the current input and output values
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
  *  @param  CIRCUIT_INFO info  	- containing the list of inputs/outputs
  *  @param  TEST_VECTOR	tv 	- the test vector to output
  *  @return nothing
  */
-void extractTestVector(CIRCUIT circuit, CIRCUIT_INFO* info, TEST_VECTOR *tv);
+void extractTestVector(CIRCUIT* circuit, CIRCUIT_INFO* info, TEST_VECTOR *tv);
+
+/*
+ *  Records that a test vector detects a fault
+ *
+ *  @param  TEST_VECTOR* tv 	- the test vector
+ *  @param  int 	id 		- the position of the fault in the fault list
+ *  @return nothing
+ */
+void addTestVectorFault(TEST_VECTOR* tv, int id);
+
+/*
+ *  Releases the test cubes and the detected faults of a test vector
+ *
+ *  @param  TEST_VECTOR* tv 	- the test vector
+ *  @return nothing
+ */
+void releaseTestVector(TEST_VECTOR* tv);
+
+/*
+ *  Prints a test vector given by its values and detected faults
+ *
+ *  @param  CIRCUIT* 	circuit 	- the circuit
+ *  @param  FAULT_LIST*	faultList	- the fault list the detected faults belong to
+ *  @param  FILE*		fp 			- the output file descriptor
+ *  @param  int 	tpCount 		- the test vector's number
+ *  @param  const TEST_CUBE* input 	- the input gates values
+ *  @param  const TEST_CUBE* output 	- the output gates values
+ *  @param  int 	faultsCount 	- total stuck-at faults the test detects
+ *  @param  const int32_t* faults 	- positions of the stuck-at faults the test detects
+ *  @return nothing
+ */
+void printTestVector(CIRCUIT* circuit, FAULT_LIST* faultList, FILE* fp, int tpCount, const TEST_CUBE* input,
+	const TEST_CUBE* output, int faultsCount, const int32_t* faults);
 
 /*
  *  Print to the standard output the given test vector
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
+ *  @param  FAULT_LIST*	faultList - the fault list the detected faults belong to
  *  @param  TEST_VECTOR	tv 	- the test vector to output
  *  @param  int 	tpCount - current test patterns generated
  *  @return nothing
  */
-void displayTestVector(CIRCUIT circuit, TEST_VECTOR* tv, int tpCount);
+void displayTestVector(CIRCUIT* circuit, FAULT_LIST* faultList, TEST_VECTOR* tv, int tpCount);
 
 /*
  *  Saves into the test pattern file the given test vector
  *
- *  @param  CIRCUIT 	circuit - the circuit
+ *  @param  CIRCUIT* 	circuit - the circuit
+ *  @param  FAULT_LIST*	faultList - the fault list the detected faults belong to
  *  @param  TEST_VECTOR	tv 	- the test vector to output
  *  @param  FILE*		fp 	- test patterns output file descriptor
  *  @param  int 	tpCount - current test patterns generated
  *  @return nothing
  */
-void saveTestVector(CIRCUIT circuit, TEST_VECTOR* tv, FILE* fp, int tpCount);
+void saveTestVector(CIRCUIT* circuit, FAULT_LIST* faultList, TEST_VECTOR* tv, FILE* fp, int tpCount);
 
 #endif
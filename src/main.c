@@ -43,9 +43,22 @@
 /* isprint */
 #include <ctype.h>
 
+/* signal, SIGPIPE, SIG_IGN */
+#include <signal.h>
+
 
 #include "libs/parser_netlist.h"
+#include "libs/netlist_cache.h"
+#include "libs/parser_threaded.h"
+#include "libs/fault_list.h"
+#include "libs/pattern_file.h"
+#include "libs/data_file.h"
+#include "libs/output_stage.h"
+#include "libs/test_cube.h"
 #include "libs/fault_simulation.h"
+#include "libs/parallel_simulation.h"
+#include "libs/deductive_simulation.h"
+#include "libs/concurrent_simulation.h"
 #include "libs/test_generator.h"
 #include "libs/hash.h"
 #include "libs/ptime.h"
@@ -60,6 +73,14 @@
 CIRCUIT circuit;        // Graph containing all the gates nodes in the circuit
 CIRCUIT_INFO info;      // Graphs metadata object
 FAULT_LIST faultList;   // List of all faults in the cictuits
+FILE* patternFile;              // Text test patterns output file
+PATTERN_WRITER patternWriter;   // Binary test patterns output file
+FILE* patternPipe;              // Command receiving the binary test patterns
+PATTERN_WRITER patternStream;   // Binary test patterns sent to the command
+OUTPUT_STAGE outputStage;       // Writer thread of the test patterns and fault lists
+PARALLEL_SIMULATOR simulator;   // Fault simulator of 64 to 512 test patterns at once
+DEDUCTIVE_SIMULATOR deductive;  // Fault simulator deducing the faults of one test pattern
+CONCURRENT_SIMULATOR concurrent;    // Fault simulator keeping the faulty machines from a pattern to the next
 
 STOP_WATCH stopwatch;   // Stopwatch for measuring exectuting time
 
@@ -71,9 +92,16 @@ void parse_command_line_arguments( int argc, char* argv[] );
 void populate_circuit_from_file( void );
 void generate_fault_list( void );
 void parse_fault_from_file( char* );
+void convert_fault_list( void );
+void dump_test_patterns( void );
+uint64_t get_netlist_hash( void );
+void build_parallel_simulator( void );
+void simulate_test_vector( TEST_VECTOR*, int );
 void generate_test_patterns( void );
+void grade_test_patterns( void );
 void save_undetected_faults( void );
 void display_statistics( void );
+void close_output_files( void );
 
 
 /*
@@ -99,9 +127,27 @@ int main( int argc, char* argv[] )
         parse_fault_from_file(options.faultListFilename);
     else
         generate_fault_list();
-
-    /* Generate test patterns */
-    generate_test_patterns();
+    indexFaultsByGate(&faultList, info.numGates);
+
+    /* Only convert the fault list if requested */
+    if(options.convertedFaultListFilename != NULL)
+        convert_fault_list();
+
+    /* Only print the binary test patterns if requested */
+    if(options.dumpedTestPatternFilename != NULL)
+        dump_test_patterns();
+
+    /* Generate test patterns, or grade the given ones */
+    if(options.faultSimulator == FAULT_SIM_PARALLEL)
+        build_parallel_simulator();
+    else if(options.faultSimulator == FAULT_SIM_DEDUCTIVE)
+        buildDeductiveSimulator(&deductive, &circuit, &info);
+    else if(options.faultSimulator == FAULT_SIM_CONCURRENT)
+        buildConcurrentSimulator(&concurrent, &circuit, &info, (size_t) options.faultMemory << 20);
+    if(options.isCustomFaultSimulation == TRUE)
+        grade_test_patterns();
+    else
+        generate_test_patterns();
 
     /* Save undetected faults if needed */
     if(options.isPrintUndetectedFaults == TRUE)
@@ -109,6 +155,9 @@ int main( int argc, char* argv[] )
 
     /* Display statistics */
     display_statistics();
+
+    /* Write the remaining test patterns and faults */
+    close_output_files();
     
     exit(EXIT_SUCCESS);
 }
@@ -137,12 +186,15 @@ void onProgramTermination()
             fprintf(stdout, "Error: %s\n", ERROR_MESSAGE);
             break;
         case ERROR_PARSING_FAULT_LIST:
+        case ERROR_PARSING_TEST_PATTERNS:
             fprintf(stdout, "Error: %s\n", ERROR_MESSAGE);
             break;
         case ERROR_COMMAND_LINE_ARGUMENTS:
             fprintf(stdout, "\nUsage:\n%s -b <benchmark filename> \t[-d] [-D <debug level>]\n"
-                "\t[-f <fault list filename>] [-h] [--help] [--version]\n\t[-s <test pattern filename]"
-                "[-u <undetected faults results filename>]\n\t[-Z] [-X <don't cares filling option>]\n",
+                "\t[-B] [-C] [-f <fault list filename>] [-h] [--help] [--version]\n\t[-j <threads>] [-P <parser mode>] [-s <test pattern filename]"
+                "[-S] [-F <fault simulator>]\n\t[-t <test pattern filename>] [-T] [-u <undetected faults results filename>] [-z] [-Z] [-X <don't cares filling option>]\n"
+                "\t[--convert-faults <fault list filename>] [--dump-patterns <test pattern filename>]\n"
+                "\t[--pipe-patterns <command>] [--fault-memory <megabytes>]\n",
                 GLOBAL_NAME);
             fprintf(stdout, "\nFor detailed help run:\n%s --help\n\n", GLOBAL_NAME);
             break;
@@ -151,17 +203,15 @@ void onProgramTermination()
     }
     fprintf(stdout, "Program was terminated prematurely!\n");
 
-    // Clean up allocated memories
-    int K = 0;
-    extern HASH_ENTRY hashTableGates[MAX_GATES];
-    for(; K < MAX_GATES; K++)
-        if(hashTableGates[K].strKey) free(hashTableGates[K].strKey);
-    
-    for(K = 0; K < info.numGates; K++)
-        if(circuit[K]) free(circuit[K]);
+    // Write what was generated before the error
+    if(outputStage.isStarted) closeOutputStage(&outputStage);
 
-    for(K = 0; K < faultList.count; K++) 
-        if(faultList.list[K]) free(faultList.list[K]);
+    // Clean up allocated memories
+    releaseParallelSimulator(&simulator);
+    releaseDeductiveSimulator(&deductive);
+    releaseConcurrentSimulator(&concurrent);
+    clearCircuit(&circuit, &info);
+    clearFaultList(&faultList);
 }
 
 /*
@@ -192,22 +242,68 @@ void displayHelpDetails()
     fprintf(stdout, "================================================================================\n");
     fprintf(stdout, "\n");
     fprintf(stdout, "\nNAME\n\t%s - automatic test pattern generation system\n", GLOBAL_NAME);
-    fprintf(stdout, "\nSYNOPSIS\n\t%s  -b <benchmark filename> \t[-d] [-D <debug level>] \n", GLOBAL_NAME);
-    fprintf(stdout, "\t      [-f <fault list filename>] [-h] [-s <test pattern filename]\n");
-    fprintf(stdout, "\t      [-u <undetected faults results filename>] [-Z]\n");
+    fprintf(stdout, "\nSYNOPSIS\n\t%s  -b <benchmark filename> \t[-C] [-d] [-D <debug level>] \n", GLOBAL_NAME);
+    fprintf(stdout, "\t      [-B] [-f <fault list filename>] [-h] [-j <threads>] [-P <parser mode>]\n");
+    fprintf(stdout, "\t      [-s <test pattern filename] [-S] [-F <fault simulator>]\n");
+    fprintf(stdout, "\t      [-t <test pattern filename>] [-T]\n");
+    fprintf(stdout, "\t      [-u <undetected faults results filename>] [-z] [-Z]\n");
     fprintf(stdout, "\t      [-X <don't cares filling option>]  [--help] [--version] \n");
+    fprintf(stdout, "\t      [--convert-faults <fault list filename>]\n");
+    fprintf(stdout, "\t      [--dump-patterns <test pattern filename>] [--pipe-patterns <command>]\n");
+    fprintf(stdout, "\t      [--fault-memory <megabytes>]\n");
     fprintf(stdout, "\nDESCRIPTION\n");
     fprintf(stdout, "\tTODO: Add the tool's description here\n");
     fprintf(stdout, "\nOPTIONS\n");
-    fprintf(stdout, "\n\t-b\n\t    Specify the filename to parse the circuit netlist from\n");
+    fprintf(stdout, "\n\t-b\n\t    Specify the filename to parse the circuit netlist from. Netlists, fault\n"
+                          "\t    lists and test patterns named *%s are decompressed on the fly\n",
+                          COMPRESSED_FILE_EXTENSION);
+    fprintf(stdout, "\n\t-B\n\t    Save the undetected faults (-u) in the binary fault list format (%s)\n",
+                          BINARY_FAULT_FILE_EXTENSION);
+    fprintf(stdout, "\n\t-C\n\t    Save the compiled netlist next to the benchmark file (%s) and\n"
+                          "\t    load it instead of parsing in later runs\n", COMPILED_NETLIST_EXTENSION);
     fprintf(stdout, "\n\t-d\n\t    Print debugging information with the default debugging level 0\n");
     fprintf(stdout, "\n\t-D\n\t    Print debugging information with the supplied debugging level\n");
-    fprintf(stdout, "\n\t-f\n\t    Specify the filename for the faults list of interest\n");
+    fprintf(stdout, "\n\t-F\n\t    Select the fault simulator: P (parallel-pattern single-fault propagation,\n"
+                          "\t    %d to %d test patterns at a time, default), S (serial, the same as -S)\n"
+                          "\t    D (deductive, the faults of every gate deduced in one pass) or C\n"
+                          "\t    (concurrent, the faulty machines diverging at every gate kept from a\n"
+                          "\t    test pattern to the next and only evaluated where events reach)\n",
+                          PARALLEL_PATTERNS, MAX_PARALLEL_PATTERNS);
+    fprintf(stdout, "\n\t--fault-memory\n\t    Bound the memory of the concurrent fault simulator's divergence lists,\n"
+                          "\t    in megabytes (%d by default). Larger fault lists are simulated in\n"
+                          "\t    several passes\n", CONCURRENT_MEMORY_MB);
+    fprintf(stdout, "\n\t-f\n\t    Specify the filename for the faults list of interest, either a text\n"
+                          "\t    (%s) or a binary (%s) fault list\n", FAULT_FILE_EXTENSION, BINARY_FAULT_FILE_EXTENSION);
+    fprintf(stdout, "\n\t--convert-faults\n\t    Save the fault list into the given file, in the binary format if its\n"
+                          "\t    extension is %s and in the text format otherwise, and quit\n",
+                          BINARY_FAULT_FILE_EXTENSION);
+    fprintf(stdout, "\n\t--dump-patterns\n\t    Print the patterns of a binary test pattern file (%s) as text and\n"
+                          "\t    quit, reading the standard input for -\n", BINARY_TEST_PATTERN_FILE_EXTENSION);
     fprintf(stdout, "\n\t-h --help\n\t    Display the detailed help information\n");
-    fprintf(stdout, "\n\t-s\n\t    Specify the filename to parse test patterns to simulate fault \n"
-                          "\t    collapsing with\n");
+    fprintf(stdout, "\n\t-j\n\t    Specify the number of threads of the multi-threaded parser (one per\n"
+                          "\t    online CPU by default)\n");
+    fprintf(stdout, "\n\t-P\n\t    Select the netlist parser: S (line by line, default), M (memory\n"
+                          "\t    mapped single pass tokenizer) or T (multi-threaded two pass parser)\n");
+    fprintf(stdout, "\n\t--pipe-patterns\n\t    Stream the test patterns in the binary format (%s) to the standard\n"
+                          "\t    input of the given command as they are generated\n",
+                          BINARY_TEST_PATTERN_FILE_EXTENSION);
+    fprintf(stdout, "\n\t-s\n\t    Grade the test patterns of the given text or binary (%s) file,\n"
+                          "\t    \"-\" for the standard input, instead of generating test patterns.\n"
+                          "\t    The patterns are read and fault simulated in blocks as wide as the\n"
+                          "\t    fault simulator takes\n",
+                          BINARY_TEST_PATTERN_FILE_EXTENSION);
+    fprintf(stdout, "\n\t-S\n\t    Fault simulate the test patterns one at a time with the serial fault\n"
+                          "\t    simulator instead of %d to %d at a time, as many as the vector\n"
+                          "\t    instructions of the CPU take\n", PARALLEL_PATTERNS, MAX_PARALLEL_PATTERNS);
+    fprintf(stdout, "\n\t-t\n\t    Specify the filename, without extension, to save test patterns into\n"
+                          "\t    (test_patterns by default)\n");
+    fprintf(stdout, "\n\t-T\n\t    Also save the test patterns in the bit-packed binary format (%s),\n"
+                          "\t    with the ids of the detected faults at debug level 2\n",
+                          BINARY_TEST_PATTERN_FILE_EXTENSION);
     fprintf(stdout, "\n\t-u\n\t    Specify the filename to save undetected faults into\n");
     fprintf(stdout, "\n\t--version\n\t    Display the tools current version number\n");
+    fprintf(stdout, "\n\t-z\n\t    Compress the saved test patterns and undetected faults with gzip,\n"
+                          "\t    appending %s to their filenames\n", COMPRESSED_FILE_EXTENSION);
     fprintf(stdout, "\n\t-Z\n\t    Turn ON/OFF fault collapsing\n");
     fprintf(stdout, "\n\t-X\n\t    Option for filling in the don't cares with during fault simulation\n");
     fprintf(stdout, "\n\n");
@@ -229,12 +325,19 @@ void parse_command_line_arguments(int argc, char* argv[])
     options.dontCareFilling = RANDOM;
     options.outputTestPatternFilename = NULL;
     options.isOneTestPerFault = FALSE;
+    options.parserMode = PARSER_STDIO;
+    options.faultSimulator = FAULT_SIM_PARALLEL;
+    options.faultMemory = CONCURRENT_MEMORY_MB;
 
     // Define command line options list for the program
-    char* SHORT_OPTS = "b:dD:f:hs:t:u:X:Z";
+    char* SHORT_OPTS = "b:BCdD:f:F:hj:P:s:St:Tu:X:zZ";
     static struct option LONG_OPTS[] = {
         {"help",    no_argument, 0,  0},
         {"version", no_argument, 0,  0},
+        {"convert-faults", required_argument, 0,  0},
+        {"dump-patterns",  required_argument, 0,  0},
+        {"pipe-patterns",  required_argument, 0,  0},
+        {"fault-memory",   required_argument, 0,  0},
         {0,         0,           0,  0}
     };
 
@@ -251,11 +354,33 @@ void parse_command_line_arguments(int argc, char* argv[])
                     displayHelpDetails();
                 else if(strcmp("version", LONG_OPTS[long_opt_index].name) == 0)
                     displayVersionDetails();
+                else if(strcmp("convert-faults", LONG_OPTS[long_opt_index].name) == 0)
+                    options.convertedFaultListFilename = optarg;
+                else if(strcmp("dump-patterns", LONG_OPTS[long_opt_index].name) == 0)
+                    options.dumpedTestPatternFilename = optarg;
+                else if(strcmp("pipe-patterns", LONG_OPTS[long_opt_index].name) == 0)
+                    options.patternPipeCommand = optarg;
+                else if(strcmp("fault-memory", LONG_OPTS[long_opt_index].name) == 0)
+                {
+                    options.faultMemory = atoi(optarg);
+                    if(options.faultMemory <= 0)
+                    {
+                        fprintf(stdout, "Option --fault-memory requires a positive number of megabytes.\n");
+                        errno = ERROR_COMMAND_LINE_ARGUMENTS;
+                        exit(1);
+                    }
+                }
                 break;
             case 'b':   // Define the benchmark filename
                 options.isBenchmarkFileGiven = TRUE;
                 options.benchmarkFilename = optarg;
                 break;
+            case 'B':   // Save undetected faults in the binary format
+                options.isBinaryFaultList = TRUE;
+                break;
+            case 'C':   // Turn ON the compiled netlist cache
+                options.isNetlistCacheEnabled = TRUE;
+                break;
             case 'd':   // Turn ON the display of debug details with default level
                 options.isDebugMode = TRUE;
                 options.debugLevel = 0;     // Default debug level is zero
@@ -268,20 +393,68 @@ void parse_command_line_arguments(int argc, char* argv[])
                 options.isFaultListGiven = TRUE;
                 options.faultListFilename = optarg;
                 break;
+            case 'F':   // Define the fault simulator implementation
+                if(strcmp(optarg, "P") == 0 || strcmp(optarg, "p") == 0)
+                    options.faultSimulator = FAULT_SIM_PARALLEL;
+                else if(strcmp(optarg, "S") == 0 || strcmp(optarg, "s") == 0)
+                    options.faultSimulator = FAULT_SIM_SERIAL;
+                else if(strcmp(optarg, "D") == 0 || strcmp(optarg, "d") == 0)
+                    options.faultSimulator = FAULT_SIM_DEDUCTIVE;
+                else if(strcmp(optarg, "C") == 0 || strcmp(optarg, "c") == 0)
+                    options.faultSimulator = FAULT_SIM_CONCURRENT;
+                else
+                {
+                    fprintf(stdout, "Option -F requires the fault simulator [P, S, D, C].\n");
+                    errno = ERROR_COMMAND_LINE_ARGUMENTS;
+                    exit(1);
+                }
+                break;
             case 'h':   // Display help
                 displayHelpDetails();
                 break;
+            case 'j':   // Define the number of parsing threads
+                options.parserThreads = atoi(optarg);
+                if(options.parserThreads <= 0)
+                {
+                    fprintf(stdout, "Option -j requires a positive number of threads.\n");
+                    errno = ERROR_COMMAND_LINE_ARGUMENTS;
+                    exit(1);
+                }
+                break;
+            case 'P':   // Define the netlist parser implementation
+                if(strcmp(optarg, "S") == 0 || strcmp(optarg, "s") == 0)
+                    options.parserMode = PARSER_STDIO;
+                else if(strcmp(optarg, "M") == 0 || strcmp(optarg, "m") == 0)
+                    options.parserMode = PARSER_MMAP;
+                else if(strcmp(optarg, "T") == 0 || strcmp(optarg, "t") == 0)
+                    options.parserMode = PARSER_THREADED;
+                else
+                {
+                    fprintf(stdout, "Option -P requires the parser mode [S, M, T].\n");
+                    errno = ERROR_COMMAND_LINE_ARGUMENTS;
+                    exit(1);
+                }
+                break;
             case 's':   // Define the custom input test patterns filename
                 options.isCustomFaultSimulation = TRUE;
                 options.inputTestPatternFilename = optarg;
                 break;
+            case 'S':   // Turn ON the serial fault simulator
+                options.faultSimulator = FAULT_SIM_SERIAL;
+                break;
            	case 't':   // Define the custom output test patterns filename
             	options.outputTestPatternFilename = optarg;
             	break;
+            case 'T':   // Also save test patterns in the binary format
+                options.isBinaryTestPatterns = TRUE;
+                break;
             case 'u':   // Define the undetected faults results filename
                 options.isPrintUndetectedFaults = TRUE;
                 options.undetectedFaultsFilename = optarg;
                 break;
+            case 'z':   // Compress the saved test patterns and faults
+                options.isCompressedOutput = TRUE;
+                break;
             case 'Z':   // Turn ON one-test-per-fault feature
                 options.isOneTestPerFault = TRUE;
                 break;
@@ -302,7 +475,9 @@ void parse_command_line_arguments(int argc, char* argv[])
             case '?':   // Parse unknown command line argument
                 if (optopt == 'D')
                     fprintf(stdout, "Error: Option -%c requires the debug level (0, 1, 2).\n", optopt);
-                else if (optopt == 'b' || optopt == 'f' || optopt == 's' || optopt == 'u')
+                else if (optopt == 'j')
+                    fprintf(stdout, "Error: Option -%c requires the number of threads.\n", optopt);
+                else if (optopt == 'b' || optopt == 'f' || optopt == 's' || optopt == 't' || optopt == 'u')
                     fprintf(stdout, "Error: Option -%c requires a filename.\n", optopt);
                 else if (isprint(optopt))
                     fprintf(stdout, "Error: Unknown option '-%c'.\n", optopt);
@@ -331,27 +506,64 @@ void parse_command_line_arguments(int argc, char* argv[])
  */
 void populate_circuit_from_file()
 {
-    // Initialize the hash tables
-    extern HASH_ENTRY hashTableGates[MAX_GATES];
-    bzero(hashTableGates, sizeof(hashTableGates));
-
     if(options.isDebugMode && options.debugLevel > 0) fprintf(stdout, "Parsing: \"%s\"...\n", options.benchmarkFilename);
 
     // Start the stopwatch
     startSW(&stopwatch);
 
+    // Load the compiled netlist of the same source if one was saved before
+    char cacheFilename[MAX_LINE_LENGTH];
+    uint64_t sourceHash, sourceSize;
+    BOOLEAN isCacheUsable = FALSE, isCached = FALSE;
+    if(options.isNetlistCacheEnabled)
+    {
+        isCacheUsable = hashNetlistFile(options.benchmarkFilename, &sourceHash, &sourceSize);
+        getCompiledNetlistFilename(options.benchmarkFilename, cacheFilename, sizeof(cacheFilename));
+    }
+    if(isCacheUsable)
+        isCached = loadCompiledNetlist(&circuit, &info, cacheFilename, sourceHash, sourceSize);
+    errno = 0;  // A missing or stale compiled netlist is not an error
+
     // Populate the circuit
-    BOOLEAN status = populateCircuit(circuit, &info, options.benchmarkFilename);
+    BOOLEAN status;
+    if(isCached)
+        status = TRUE;
+    else if(options.parserMode == PARSER_MMAP)
+        status = populateCircuitMapped(&circuit, &info, options.benchmarkFilename);
+    else if(options.parserMode == PARSER_THREADED)
+        status = populateCircuitThreaded(&circuit, &info, options.benchmarkFilename);
+    else
+        status = populateCircuit(&circuit, &info, options.benchmarkFilename);
 
     // Compute gate levels in a successfully parsed circuit or quit for errors
     if(status == TRUE)
     {
-        computeGateLevels(circuit, &info);
+        if(!isCached) computeGateLevels(&circuit, &info);
 
         // Compute the time taken for parsing
         double duration = getElaspedTimeSW(&stopwatch);
-        if(options.isDebugMode && options.debugLevel > 0) fprintf(stdout, "Netlist file successfully parsed "
-                "[ %.4f seconds ].\n\n", duration);
+        if(options.isDebugMode && options.debugLevel > 0)
+        {
+            if(isCached)
+                fprintf(stdout, "Compiled netlist \"%s\" successfully loaded "
+                    "[ %.4f seconds ].\n\n", cacheFilename, duration);
+            else
+                fprintf(stdout, "Netlist file successfully parsed "
+                    "[ %.4f seconds ].\n\n", duration);
+
+            size_t memory = getCircuitMemoryUsage(&circuit, info.numGates);
+            fprintf(stdout, "Circuit memory: %zu bytes for %d gates (%.1f bytes per gate).\n\n",
+                memory, info.numGates, info.numGates > 0 ? (double) memory / info.numGates : 0.0);
+        }
+
+        // Save the compiled netlist for later runs
+        if(isCacheUsable && !isCached)
+        {
+            BOOLEAN saved = saveCompiledNetlist(&circuit, &info, cacheFilename, sourceHash, sourceSize);
+            if(options.isDebugMode && options.debugLevel > 0 && saved == FALSE)
+                fprintf(stdout, "Could not save the compiled netlist \"%s\".\n\n", cacheFilename);
+            errno = 0;
+        }
     }
     else
     {
@@ -364,9 +576,9 @@ void populate_circuit_from_file()
     if(options.isDebugMode) 
     {
         fprintf(stdout, "Input gates:\n");
-        for(K = 0; K < info.numPI; K++) printf("%s  ", circuit[info.inputs[K]]->name);
+        for(K = 0; K < info.numPI; K++) printf("%s  ", GATE_NAME(&circuit, info.inputs[K]));
         fprintf(stdout, "\nOutput gates:\n");
-        for(K = 0; K < info.numPO; K++) printf("%s  ", circuit[info.outputs[K]]->name);
+        for(K = 0; K < info.numPO; K++) printf("%s  ", GATE_NAME(&circuit, info.outputs[K]));
         fprintf(stdout, "\n\n");
     }   
 }
@@ -382,47 +594,28 @@ void generate_fault_list()
      * Currently, simply all lines in the circuit will have faults associated with it.
      * TODO: Determine redundant faults
      */
-	int K, L, count = 0;
+	int K, L;
+
+    // Every gate has two faults and so has every branch of a fan out
+    long total = 0;
+    for(K = 0; K < info.numGates; K++)
+        total += 2 + ((NUM_FANOUT(&circuit, K) > 1) ? 2 * NUM_FANOUT(&circuit, K) : 0);
+    allocateFaultList(&faultList, (int) total);
+
 	for(K = 0; K < info.numGates; K++)
 	{
-		// Add stuck at zero fault for the main segment
-		faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-		faultList.list[count]->index    = K;
-        faultList.list[count]->indexOut = -1;
-		faultList.list[count]->type     = ST_0;
-		faultList.list[count]->detected = FALSE;
-		count++;
-
-		// Add stuck at one fault for the main segment
-		faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-		faultList.list[count]->index    = K;
-        faultList.list[count]->indexOut = -1;
-		faultList.list[count]->type     = ST_1;
-		faultList.list[count]->detected = FALSE;
-		count++;
+		// Add stuck at zero and stuck at one faults for the main segment
+		appendFault(&faultList, K, -1, ST_0);
+		appendFault(&faultList, K, -1, ST_1);
 
         // Add fan out segments
-        if(circuit[K]->numOut > 1)
-            for(L = 0; L < circuit[K]->numOut; L++)
+        if(NUM_FANOUT(&circuit, K) > 1)
+            for(L = 0; L < NUM_FANOUT(&circuit, K); L++)
             {
-                // Add stuck at zero fault for the fan out segment
-                faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-                faultList.list[count]->index    = K;
-                faultList.list[count]->indexOut = circuit[K]->out[L];
-                faultList.list[count]->type     = ST_0;
-                faultList.list[count]->detected = FALSE;
-                count++;
-
-                // Add stuck at one fault for the fan out segment
-                faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-                faultList.list[count]->index    = K;
-                faultList.list[count]->indexOut = circuit[K]->out[L];
-                faultList.list[count]->type     = ST_1;
-                faultList.list[count]->detected = FALSE;
-                count++;
+                appendFault(&faultList, K, FANOUT(&circuit, K, L), ST_0);
+                appendFault(&faultList, K, FANOUT(&circuit, K, L), ST_1);
             }
 	}
-	faultList.count = count;
 }
 
 /*
@@ -432,14 +625,10 @@ void generate_fault_list()
  */
 void parse_fault_from_file(char* filename)
 {
-    // Open the faultlist file
-    FILE* fp = fopen(filename, "r");
-    if(fp == NULL)
-    {
-        sprintf(ERROR_MESSAGE, "File \"%s\" not found", filename);
-        errno = ERROR_PARSING_FAULT_LIST;
-        exit(1);
-    }
+    if(options.isDebugMode && options.debugLevel > 0) fprintf(stdout, "Loading faults: \"%s\"...\n", filename);
+
+    // Start the stopwatch
+    startSW(&stopwatch);
 
     /*
      * The format used is the one defined by the ISCAS89
@@ -451,142 +640,308 @@ void parse_fault_from_file(char* filename)
      *     Format:  <start gatename> -> <ending gatename> [/0] [/1]
      *     Example: nyu-23->nyu0 /1
      */
-    char* line = NULL;
-    size_t len = 0;
-    char gate1[20], gate2[20];
-    int single = 0, fault1 = -1, fault2 = -1, count = 0, indexOut, index, L;
-    while((getline(&line, &len, fp)) != -1)
-    {
-        // Extract gate
-        if(strstr(line, "->") == NULL)
+    if(loadFaultList(&circuit, &info, &faultList, filename, get_netlist_hash()) == FALSE)
+    {
+        sprintf(ERROR_MESSAGE, "File \"%s\" not found", filename);
+        errno = ERROR_PARSING_FAULT_LIST;
+        exit(1);
+    }
+
+    // Compute the time and memory taken for loading
+    double duration = getElaspedTimeSW(&stopwatch);
+    if(options.isDebugMode && options.debugLevel > 0)
+        fprintf(stdout, "Fault list file successfully loaded: %d faults, %.1f KB "
+            "[ %.4f seconds ].\n\n", faultList.count,
+            getFaultListMemoryUsage(&faultList) / 1024.0, duration);
+}
+
+/*
+ *  Saves the fault list into the file given to --convert-faults and quits. The
+ *  binary format is used for the binary fault list extension.
+ *  
+ *  @return nothing
+ */
+void convert_fault_list()
+{
+    char* filename = options.convertedFaultListFilename;
+
+    BOOLEAN saved;
+    if(isBinaryFaultListFilename(filename))
+        saved = saveBinaryFaultList(&circuit, &info, &faultList, filename, FALSE, get_netlist_hash());
+    else
+        saved = saveFaultList(&circuit, &faultList, filename, FALSE);
+
+    if(saved == FALSE)
+    {
+        fprintf(stdout, "Error: Could not save the fault list into \"%s\".\n", filename);
+        if(errno == 0) errno = EIO;
+        exit(1);
+    }
+
+    fprintf(stdout, "Fault list saved into \"%s\": %d faults.\n", filename, faultList.count);
+    exit(EXIT_SUCCESS);
+}
+
+/*
+ *  Prints the patterns of a binary test pattern file as text and quits
+ *  
+ *  @return nothing
+ */
+void dump_test_patterns()
+{
+    char* filename = options.dumpedTestPatternFilename;
+    PATTERN_READER reader;
+    TEST_VECTOR* tv = (TEST_VECTOR*) calloc(1, sizeof(TEST_VECTOR));
+
+    if(tv == NULL || openPatternReader(&reader, filename) == FALSE || reader.isText)
+    {
+        fprintf(stdout, "Error: \"%s\" is not a binary test pattern file.\n", filename);
+        if(errno == 0) errno = EIO;
+        exit(1);
+    }
+
+    // Fault ids only name faults of the same netlist
+    BOOLEAN isSameNetlist = (reader.header.netlistHash == get_netlist_hash() &&
+                             reader.header.numPI == info.numPI && reader.header.numPO == info.numPO);
+    if(isSameNetlist == FALSE)
+        fprintf(stdout, "Warning: \"%s\" was saved for a different netlist.\n\n", filename);
+    else
+        reader.numFaults = faultList.count;
+
+    fprintf(stdout, "Test Vectors:\nFormat: <Pattern/Input> <Results/Output> <# Faults> {<List of Faults>}\n\n");
+
+    int count = 0, K, id;
+    while(readPattern(&reader, tv))
+    {
+        count++;
+        fprintf(stdout, "test %5d:\t", count);
+        printCube(stdout, &tv->input);
+        fputc('\t', stdout);
+        printCube(stdout, &tv->output);
+        if((reader.header.flags & PATTERN_FILE_FAULT_IDS) == 0)
         {
-            sscanf(line, "%[a-z,A-Z,0-9,_]", gate1);
-            single = 1;
+            fprintf(stdout, "\n");
+            continue;
         }
-        else sscanf(line, "%[a-z,A-Z,0-9,_]->%[a-z,A-Z,0-9,_]", gate1, gate2);
 
-        // Extract fault
-        while(1)
+        fprintf(stdout, "\t%d\t{", reader.numFaultIds);
+        for(K = 0; K < reader.numFaultIds; K++)
         {
-            if((line = strstr(line, "/")) == NULL) break;
-            line++;
-            if(fault1 < 0)  sscanf(line, "%d", &fault1);
-            else sscanf(line, "%d", &fault2);
+            id = (int) reader.faultIds[K];
+            if(isSameNetlist == FALSE || id >= faultList.count)
+                fprintf(stdout, " #%d", id);
+            else if(faultList.faults[id].indexOut < 0)
+                fprintf(stdout, " (%s, %d)", GATE_NAME(&circuit, faultList.faults[id].index),
+                    faultList.faults[id].type);
+            else
+                fprintf(stdout, " (%s->%s, %d)", GATE_NAME(&circuit, faultList.faults[id].index),
+                    GATE_NAME(&circuit, faultList.faults[id].indexOut), faultList.faults[id].type);
         }
+        fprintf(stdout, " }\n");
+    }
+
+    BOOLEAN isCorrupted = reader.isCorrupted;
+    closePatternReader(&reader);
+    releaseTestVector(tv);
+    free(tv);
 
-        // Add the first fault for the main segment
-        if(single)
+    if(isCorrupted)
+    {
+        fprintf(stdout, "Error: \"%s\" is truncated after %d patterns.\n", filename, count);
+        errno = EIO;
+        exit(1);
+    }
+
+    fprintf(stdout, "\nTotal Patterns: %d\n", count);
+    exit(EXIT_SUCCESS);
+}
+
+/*
+ *  Computes once the hash of the benchmark file, which keys binary fault lists
+ *  
+ *  @return uint64_t - the hash of the benchmark file
+ */
+uint64_t get_netlist_hash()
+{
+    static BOOLEAN isHashed = FALSE;
+    static uint64_t hash;
+    uint64_t size;
+
+    if(isHashed == FALSE)
+    {
+        if(hashNetlistFile(options.benchmarkFilename, &hash, &size) == FALSE)
         {
-            faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-            faultList.list[count]->index    = findIndex(circuit, &info.numGates, gate1, FALSE);
-            faultList.list[count]->indexOut = -1;
-            faultList.list[count]->type     = (fault1 == 0? ST_0 : ST_1);
-            faultList.list[count]->detected = FALSE;
-            count++;
-
-            if(fault2 >= 0)
-            {
-                faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-                faultList.list[count]->index    = findIndex(circuit, &info.numGates, gate1, FALSE);
-                faultList.list[count]->indexOut = -1;
-                faultList.list[count]->type     = (fault2 == 0? ST_0 : ST_1);
-                faultList.list[count]->detected = FALSE;
-                count++;
-            }
+            sprintf(ERROR_MESSAGE, "File \"%s\" could not be read", options.benchmarkFilename);
+            errno = ERROR_PARSING_CIRCUIT;
+            exit(1);
         }
-        else
+        isHashed = TRUE;
+    }
+    return hash;
+}
+
+
+/*
+ *  Picks the fault simulation kernel for the CPU and sizes the parallel fault
+ *  simulator for the circuit
+ *
+ *  @return nothing
+ */
+void build_parallel_simulator()
+{
+    const PARALLEL_KERNEL* kernel = findParallelKernel(NULL);
+    if(kernel == NULL || kernel->isSupported() == FALSE)
+    {
+        fprintf(stdout, "Error: The CPU does not run the fault simulation kernel this program was built with.\n");
+        errno = ENOTSUP;
+        exit(1);
+    }
+    buildParallelSimulator(&simulator, &circuit, &info, kernel);
+}
+
+/*
+ *  Gives the number of test vectors fault simulated at once
+ *
+ *  @return int - PARALLEL_PATTERNS for the fault simulators of one test vector
+ *                at a time, the patterns of the kernel otherwise
+ */
+int get_block_size()
+{
+    if(options.faultSimulator != FAULT_SIM_PARALLEL) return PARALLEL_PATTERNS;
+    return simulator.kernel->numPatterns;
+}
+
+/*
+ *  Drops the faults a test vector detects from the given position in the fault
+ *  list on, with the serial, the deductive or the concurrent fault simulator
+ *
+ *  @param  TEST_VECTOR* tv     - the test vector, holding its output values
+ *  @param  int     start       - starting point in the fault list
+ *  @return nothing
+ */
+void simulate_test_vector(TEST_VECTOR* tv, int start)
+{
+    if(options.faultSimulator == FAULT_SIM_DEDUCTIVE)
+        simulateDeductiveVector(&deductive, &circuit, &info, &faultList, tv, start);
+    else if(options.faultSimulator == FAULT_SIM_CONCURRENT)
+        simulateConcurrentVector(&concurrent, &circuit, &info, &faultList, tv, start);
+    else
+        simulateTestVector(&circuit, &info, &faultList, tv, start);
+}
+
+/*
+ *  Computes the output values of a block of filled test vectors and drops the
+ *  faults they detect. Every detected fault is added to the first test vector
+ *  of the block detecting it.
+ *
+ *  @param  TEST_VECTOR* block  - the test vectors
+ *  @param  int     count       - number of test vectors, 1 to get_block_size()
+ *  @return nothing
+ */
+void simulate_test_vector_block(TEST_VECTOR* block, int count)
+{
+    int P;
+    if(options.faultSimulator != FAULT_SIM_PARALLEL)
+    {
+        // Sweep the whole circuit since a filled pattern changes most of its gates
+        for(P = 0; P < count; P++)
         {
-            index    = findIndex(circuit, &info.numGates, gate1, FALSE);
-            indexOut = findIndex(circuit, &info.numGates, gate2, FALSE);
-            
-            for(L = 0; L < circuit[index]->numOut; L++)
-                if(circuit[index]->out[L] == indexOut) break;
-
-            // Add the first fault for the fan out segment
-            if(index >= 0 && indexOut >= 0 && L <circuit[index]->numOut)
-            {
-                faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-                faultList.list[count]->index    = index;
-                faultList.list[count]->indexOut = indexOut;
-                faultList.list[count]->type     = (fault1 == 0? ST_0 : ST_1);
-                faultList.list[count]->detected = FALSE;
-                count++;
-
-                if(fault2 >= 0)
-                {
-                    faultList.list[count] = (FAULT*) malloc(sizeof(FAULT));
-                    faultList.list[count]->index    = index;
-                    faultList.list[count]->indexOut = indexOut;
-                    faultList.list[count]->type     = (fault2 == 0? ST_0 : ST_1);
-                    faultList.list[count]->detected = FALSE;
-                    count++;
-                }
-            }
+            sweep_pattern(&circuit, &info, &block[P].input, NULL, NULL, &block[P].output);
+            simulate_test_vector(&block[P], 0);
         }
     }
+    else
+    {
+        simulateParallelPatterns(&simulator, &circuit, &info, block, count);
+        for(P = 0; P < count; P++)
+            collectParallelOutputs(&simulator, &info, P, &block[P].output);
+        dropParallelFaults(&simulator, &circuit, &info, &faultList, block, 0);
+    }
+}
+
+/*
+ *  Fills a test vector randomly, seeding the random numbers with the given
+ *  seed
+ *
+ *  @param  TEST_VECTOR* tv     - the test vector
+ *  @param  unsigned int seed   - the seed
+ *  @return nothing
+ */
+void generate_random_pattern(TEST_VECTOR* tv, unsigned int seed)
+{
+    int K;
+    srand((int) seed);
 
-    faultList.count = count;
+    clearCube(&tv->input, info.numPI);
+    for(K = 0; K < info.numPI; K++)
+        setCubeValue(&tv->input, K, (rand() % 100 > 50) ? I : O);
 
-    if(line) free(line);
+    // Nothing is left to fill, but the filling reseeds the next patterns
+    fillDontCares(&info, tv);
+    tv->faults_count = 0;
 }
 
-
 /*
- *  Generates test patterns randomly
+ *  Generates test patterns randomly, a block at a time. The patterns are the
+ *  ones generated one at a time whatever the size of the blocks.
  *  
  *  @return nothing
  */
-void random_test_generation(FILE* fp, int* testPatternCount)
+void random_test_generation(int* testPatternCount)
 {
-    SIM_RESULT simResults;
-    TEST_VECTOR tv;
-    int K, L, noPatternsCount = 0;
+    int size = get_block_size();
+    TEST_VECTOR* block = (TEST_VECTOR*) calloc(size, sizeof(TEST_VECTOR));
+    unsigned int* seeds = (unsigned int*) malloc(size * sizeof(unsigned int));
+    int K, L, P, noPatternsCount = 0;
     unsigned int seed = 0;
+    if(block == NULL || seeds == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
     
     while(noPatternsCount < 32)
     {
-        // Generate a random pattern
-        if(seed < 1000) seed = time(((long *) NULL));
-        else { seed = rand() % seed; }
-        srand((int) seed);
-
-        for(K = 0; K < info.numPI; K++)
-            if(rand() % 100 > 50)  tv.input[K] = '1';
-            else tv.input[K] = '0';
-        tv.input[K] = '\0';
-
-        //strcpy(tv.input, "0011");
-
-        // Compute results for the input pattern
-        clearPropagationValuesCircuit(circuit, info.numGates);
-        simResults = generate_output(circuit, &info, tv.input);
-        strcpy(tv.output, simResults.output);
-
-        //printf("Haya: %s -> %s\n", tv.input, tv.output);
+        for(P = 0; P < size; P++)
+        {
+            // Generate a random pattern
+            if(seed < 1000) seed = time(((long *) NULL));
+            else { seed = rand() % seed; }
+            seeds[P] = seed;
+            generate_random_pattern(&block[P], seed);
+        }
 
-        // Simulate the pattern
-        tv.faults_count = 0;
-        simulateTestVector(circuit, &info, &faultList, &tv, 0);
+        // Simulate the patterns
+        simulate_test_vector_block(block, size);
 
-        if(tv.faults_count == 0) noPatternsCount++;
-        else
+        for(P = 0; P < size && noPatternsCount < 32; P++)
         {
-            // Count test pattern
-            (*testPatternCount)++;
-
-            // Display and save results
-            if(options.isDebugMode && options.debugLevel > 0) displayTestVector(circuit, &tv, *testPatternCount);
-            saveTestVector(circuit, &tv, fp, *testPatternCount);
+            if(block[P].faults_count == 0) noPatternsCount++;
+            else
+            {
+                // Count test pattern
+                (*testPatternCount)++;
 
-            // Clear the faults list memory for this pattern
-            for(L = 0; L < tv.faults_count; L++)
-                if(tv.faults_list[L]) free(tv.faults_list[L]);
+                // Display and save results
+                submitTestVector(&outputStage, &block[P], *testPatternCount);
+            }
+        }
 
-            // Mark the fault as detected
-            faultList.list[K]->detected = TRUE;
+        // The patterns past the last one are dropped, with the faults they detect,
+        // and the random numbers are put back as the last one left them
+        if(P < size)
+        {
+            for(K = P; K < size; K++)
+                for(L = 0; L < block[K].faults_count; L++)
+                    CLEAR_FAULT_STATUS(&faultList, block[K].faults_list[L], FAULT_DETECTED);
+            seed = seeds[P - 1];
+            generate_random_pattern(&block[P], seed);
         }
-        //break;
     }
+
+    for(P = 0; P < size; P++) releaseTestVector(&block[P]);
+    free(block);
+    free(seeds);
 }    
 
 /*
@@ -594,59 +949,66 @@ void random_test_generation(FILE* fp, int* testPatternCount)
  *  
  *  @return nothing
  */
-void deterministic_test_generation(FILE* fp, int* testPatternCount)
+void deterministic_test_generation(int* testPatternCount)
 {
-    SIM_RESULT simResults;
     BOOLEAN results;
-    int K, L;
+    int K;
     TEST_VECTOR testVector;
+    FAULT* fault;
+    bzero(&testVector, sizeof(TEST_VECTOR));
     //SIM_RESULT simResults;
     for(K = 0; K < faultList.count; K++)
     {
-        if(faultList.list[K]->detected == TRUE) continue;
-
-        clearPropagationValuesCircuit(circuit, info.numGates);
+        if(IS_DETECTED(&faultList, K)) continue;
+        fault = &faultList.faults[K];
 
-        results = excite(circuit, faultList.list[K]->index, faultList.list[K]->indexOut, 
-                            (faultList.list[K]->type == ST_1? B : D));
-        if(results == FALSE) continue;
+        clearPropagationValuesCircuit(&circuit, info.numGates);
 
-        results = propagate(circuit, faultList.list[K]->index, faultList.list[K]->indexOut,
-                            (faultList.list[K]->type == ST_1? B : D));
+        results = excite(&circuit, fault->index, fault->indexOut, (fault->type == ST_1? B : D));
         if(results == TRUE)
+            results = propagate(&circuit, fault->index, fault->indexOut, (fault->type == ST_1? B : D));
+        if(results == FALSE)
         {
-            extractTestVector(circuit, &info, &testVector);
+            // Give up on the fault, the test generator could not excite or propagate it
+            SET_FAULT_STATUS(&faultList, K, FAULT_ABORTED);
+            continue;
+        }
+
+        extractTestVector(&circuit, &info, &testVector);
 
-            // Add the current fault into the patterns fault list
-            testVector.faults_list[0] = (FAULT*) malloc(sizeof(FAULT));
-            testVector.faults_list[0]->index    = faultList.list[K]->index;
-            testVector.faults_list[0]->indexOut = faultList.list[K]->indexOut;
-            testVector.faults_list[0]->type     = faultList.list[K]->type;
+        // Add the current fault into the patterns fault list
+        addTestVectorFault(&testVector, K);
 
-            // Simulate other faults in the remaining fault list if fault collapsing is allowed
-            //if(options.isOneTestPerFault == FALSE)
-            simulateTestVector(circuit, &info, &faultList, &testVector, K+1);
+        // Simulate other faults in the remaining fault list if fault collapsing is allowed
+        //if(options.isOneTestPerFault == FALSE)
+        if(options.faultSimulator != FAULT_SIM_PARALLEL)
+        {
+            simulate_test_vector(&testVector, K+1);
 
             // Compute all output gate values for the pattern
-            clearPropagationValuesCircuit(circuit, info.numGates);
-            simResults = generate_output(circuit, &info, testVector.input);
-            strcpy(testVector.output, simResults.output);
+            clearPropagationValuesCircuit(&circuit, info.numGates);
+            generate_output(&circuit, &info, &testVector.input, &testVector.output);
+        }
+        else
+        {
+            fillDontCares(&info, &testVector);
+            simulateParallelPatterns(&simulator, &circuit, &info, &testVector, 1);
+            dropParallelFaults(&simulator, &circuit, &info, &faultList, &testVector, K+1);
 
-            // Count test pattern
-            (*testPatternCount)++;
+            // Compute all output gate values for the pattern
+            collectParallelOutputs(&simulator, &info, 0, &testVector.output);
+        }
 
-            // Display and save results
-            if(options.isDebugMode && options.debugLevel > 0) displayTestVector(circuit, &testVector, *testPatternCount);
-            saveTestVector(circuit, &testVector, fp, *testPatternCount);
+        // Count test pattern
+        (*testPatternCount)++;
 
-            // Clear the faults list memory for this pattern
-            for(L = 0; L < testVector.faults_count; L++)
-                if(testVector.faults_list[L]) free(testVector.faults_list[L]);
+        // Display and save results
+        submitTestVector(&outputStage, &testVector, *testPatternCount);
 
-            // Mark the fault as detected
-            faultList.list[K]->detected = TRUE;
-        }
+        // Mark the fault as detected
+        SET_FAULT_STATUS(&faultList, K, FAULT_DETECTED);
     }
+    releaseTestVector(&testVector);
 }
 
 /*
@@ -657,13 +1019,41 @@ void deterministic_test_generation(FILE* fp, int* testPatternCount)
 void generate_test_patterns()
 {
 	// Prepare test patterns output files
-	char filename[MAX_WORD];
-	if(options.outputTestPatternFilename != NULL)
-    	strcpy(filename, options.outputTestPatternFilename);
-    else
-    	strcpy(filename, "test_patterns");
-    strcat(filename, ".tvl");
-    FILE* fp = fopen(filename, "w");
+	char* basename = (options.outputTestPatternFilename != NULL) ? options.outputTestPatternFilename : "test_patterns";
+	char* compression = options.isCompressedOutput ? COMPRESSED_FILE_EXTENSION : "";
+	char filename[MAX_LINE_LENGTH], binaryFilename[MAX_LINE_LENGTH];
+    snprintf(filename, sizeof(filename), "%s%s%s", basename, TEST_PATTERN_FILE_EXTENSION, compression);
+    snprintf(binaryFilename, sizeof(binaryFilename), "%s%s%s", basename, BINARY_TEST_PATTERN_FILE_EXTENSION,
+             compression);
+    FILE* fp = patternFile = openDataFile(filename, "w");
+    if(fp == NULL)
+    {
+        fprintf(stdout, "Error: Could not create the test pattern file \"%s\".\n", filename);
+        exit(1);
+    }
+
+    BOOLEAN isFaultIdsSaved = (options.isDebugMode && options.debugLevel >= 2);
+    if(options.isBinaryTestPatterns &&
+       openPatternWriter(&patternWriter, binaryFilename, &info, get_netlist_hash(), isFaultIdsSaved) == FALSE)
+    {
+        fprintf(stdout, "Error: Could not create the test pattern file \"%s\".\n", binaryFilename);
+        if(errno == 0) errno = EIO;
+        exit(1);
+    }
+
+    // Stream the binary test patterns to the command as they are generated
+    if(options.patternPipeCommand != NULL)
+    {
+        signal(SIGPIPE, SIG_IGN);
+        patternPipe = popen(options.patternPipeCommand, "w");
+        if(patternPipe == NULL ||
+           openPatternStream(&patternStream, patternPipe, &info, get_netlist_hash(), isFaultIdsSaved) == FALSE)
+        {
+            fprintf(stdout, "Error: Could not start the command \"%s\".\n", options.patternPipeCommand);
+            if(errno == 0) errno = EIO;
+            exit(1);
+        }
+    }
 
     if(options.isDebugMode) 
     	fprintf(stdout, "Total Gates: %d\n\n", (info.numGates-info.numPI));
@@ -673,18 +1063,30 @@ void generate_test_patterns()
     	fprintf(stdout, "Test Vectors:\nFormat: <Pattern/Input> <Results/Output> <# Faults> {<List of Faults>}\n\n");
     fprintf(fp, "Test Vectors:\nFormat: <Pattern/Input> <Results/Output> <# Faults> {<List of Faults>}\n\n");
 
+    // Format and write the test patterns on the output thread
+    if(startOutputStage(&outputStage, &circuit, &faultList, fp, options.isDebugMode && options.debugLevel > 0,
+                        (options.isBinaryTestPatterns ? &patternWriter : NULL),
+                        (options.patternPipeCommand != NULL ? &patternStream : NULL)) == FALSE)
+    {
+        fprintf(stdout, "Error: Could not start the output thread.\n");
+        if(errno == 0) errno = EAGAIN;
+        exit(1);
+    }
+
     // Start timer
     startSW(&stopwatch);
 
     // Perform random test pattern generation
     int testPatternCount = 0;
-    random_test_generation(fp, &testPatternCount);
+    random_test_generation(&testPatternCount);
+    flushOutputStage(&outputStage);
 
     printf("-->\n");
 
     // Perform determinstic test pattern generation
-    deterministic_test_generation(fp, &testPatternCount);
-    
+    deterministic_test_generation(&testPatternCount);
+    flushOutputStage(&outputStage);
+
     // Compute test patterns generation duration
     double duration = getElaspedTimeSW(&stopwatch);
         if(options.isDebugMode && options.debugLevel > 0) fprintf(stdout, "\nTest vectors successfully generated "
@@ -695,30 +1097,125 @@ void generate_test_patterns()
 }
 
 /*
- *  Save undected faults into a file
+ *  Fault simulates the test patterns of a given file, dropping the faults they
+ *  detect. The file is read one block of get_block_size() patterns at a time,
+ *  so that it is never held whole and the widest kernel grades it.
  *  
  *  @return nothing
  */
-void save_undetected_faults()
+void grade_test_patterns()
 {
-    char filename[MAX_WORD];
-    strcpy(filename, options.undetectedFaultsFilename);
-    strcat(filename, FAULT_FILE_EXTENSION);
-    FILE* fp = fopen(filename, "w");
-    int K;
-    for(K = 0; K < faultList.count; K++)
-        if(faultList.list[K]->detected == FALSE)
+    char* filename = options.inputTestPatternFilename;
+    PATTERN_READER reader;
+    int blockSize = get_block_size();
+    TEST_VECTOR* tv = (TEST_VECTOR*) calloc(blockSize, sizeof(TEST_VECTOR));
+    if(tv == NULL)
+    {
+        errno = ENOMEM;
+        exit(1);
+    }
+
+    if(openPatternReader(&reader, filename) == FALSE)
+    {
+        fprintf(stdout, "Error: Could not read the test pattern file \"%s\".\n", filename);
+        if(errno == 0) errno = EIO;
+        exit(1);
+    }
+    reader.numFaults = faultList.count;
+    if(reader.isText == FALSE && (reader.header.numPI != info.numPI || reader.header.numPO != info.numPO))
+    {
+        sprintf(ERROR_MESSAGE, "\"%s\" has %d inputs and %d outputs instead of %d and %d", filename,
+                reader.header.numPI, reader.header.numPO, info.numPI, info.numPO);
+        errno = ERROR_PARSING_TEST_PATTERNS;
+        exit(1);
+    }
+
+    // Display the graded test patterns on the output thread
+    if(options.isDebugMode && options.debugLevel > 0) 
+    	fprintf(stdout, "Test Vectors:\nFormat: <Pattern/Input> <Results/Output> <# Faults> {<List of Faults>}\n\n");
+    if(startOutputStage(&outputStage, &circuit, &faultList, NULL, options.isDebugMode && options.debugLevel > 0,
+                        NULL, NULL) == FALSE)
+    {
+        fprintf(stdout, "Error: Could not start the output thread.\n");
+        if(errno == 0) errno = EAGAIN;
+        exit(1);
+    }
+
+    // Start timer
+    startSW(&stopwatch);
+
+    int testPatternCount = 0, uselessPatternCount = 0, count, P;
+    while(TRUE)
+    {
+        // Read the next block, as wide as the fault simulation kernel
+        count = readPatternBlock(&reader, tv, blockSize);
+        if(count == 0) break;
+
+        // Fill the patterns of the block
+        for(P = 0; P < count; P++)
         {
-            if(faultList.list[K]->indexOut < 0)
-                fprintf(fp, "%s /%c\n", circuit[faultList.list[K]->index]->name, 
-                            (faultList.list[K]->type == ST_1 ? '1':'0'));
-            else
-                fprintf(fp, "%s->%s /%c\n", circuit[faultList.list[K]->index]->name, 
-                    circuit[faultList.list[K]->indexOut]->name, 
-                    (faultList.list[K]->type == ST_1 ? '1':'0'));
+            if(tv[P].input.width != info.numPI)
+            {
+                sprintf(ERROR_MESSAGE, "Test pattern %d of \"%s\" does not have %d input values",
+                        testPatternCount + P + 1, filename, info.numPI);
+                errno = ERROR_PARSING_TEST_PATTERNS;
+                exit(1);
+            }
+            fillDontCares(&info, &tv[P]);
+            tv[P].faults_count = 0;
         }
 
-    fclose(fp);
+        // Compute results for the filled patterns and drop the faults they detect
+        simulate_test_vector_block(tv, count);
+
+        for(P = 0; P < count; P++)
+        {
+            testPatternCount++;
+            if(tv[P].faults_count == 0) uselessPatternCount++;
+
+            // Display results, patterns detecting no new faults included
+            if(options.isDebugMode && options.debugLevel > 0)
+                submitTestVector(&outputStage, &tv[P], testPatternCount);
+        }
+    }
+    flushOutputStage(&outputStage);
+
+    BOOLEAN isCorrupted = reader.isCorrupted;
+    closePatternReader(&reader);
+    for(P = 0; P < blockSize; P++) releaseTestVector(&tv[P]);
+    free(tv);
+
+    if(isCorrupted)
+    {
+        sprintf(ERROR_MESSAGE, "\"%s\" has an invalid test pattern after %d patterns", filename, testPatternCount);
+        errno = ERROR_PARSING_TEST_PATTERNS;
+        exit(1);
+    }
+
+    // Compute test patterns grading duration
+    double duration = getElaspedTimeSW(&stopwatch);
+    if(options.isDebugMode && options.debugLevel > 0) fprintf(stdout, "\nTest vectors successfully graded "
+                "[ %.4f seconds ].\n\n", duration);
+
+    fprintf(stdout, "\nTotal Patterns graded: %d\n", testPatternCount);
+    fprintf(stdout, "Patterns detecting no new faults: %d\n", uselessPatternCount);
+}
+
+/*
+ *  Save undected faults into a file
+ *  
+ *  @return nothing
+ */
+void save_undetected_faults()
+{
+    char filename[MAX_LINE_LENGTH];
+    snprintf(filename, sizeof(filename), "%s%s%s", options.undetectedFaultsFilename,
+             (options.isBinaryFaultList ? BINARY_FAULT_FILE_EXTENSION : FAULT_FILE_EXTENSION),
+             (options.isCompressedOutput ? COMPRESSED_FILE_EXTENSION : ""));
+
+    // Saved by the output thread, which reports errors when it is closed
+    submitFaultList(&outputStage, &info, &faultList, filename, options.isBinaryFaultList, TRUE,
+                    (options.isBinaryFaultList ? get_netlist_hash() : 0));
 }
 
 /*
@@ -730,16 +1227,60 @@ void display_statistics( )
 {
 	fprintf(stdout, "\nTotal faults:\t%d\n", faultList.count);
 
-	int undetected_faults = 0, K;
-    for(K = 0; K < faultList.count; K++)
-        if(faultList.list[K]->detected == FALSE) undetected_faults++;
+	int undetected_faults = faultList.count - countFaults(&faultList, FAULT_DETECTED);
 
 	fprintf(stdout, "\nDetected faults:\n\tCount:\t\t%d\n", (faultList.count-undetected_faults));
 	fprintf(stdout, "\tPercentage:\t%.0f%%\n", ((float) (faultList.count-undetected_faults)*100/faultList.count));
 
     fprintf(stdout, "\nUndetected faults:\n\tTotal count:\t%d\n", undetected_faults);
     fprintf(stdout, "\tPercentage:\t\t%.0f%%\n", ((float) (undetected_faults)*100/faultList.count));
-    fprintf(stdout, "\tOutput file:\t\"%s%s\"\n", (options.isPrintUndetectedFaults == TRUE? 
-                    options.undetectedFaultsFilename : "test_patterns.tvl"), FAULT_FILE_EXTENSION);
+    fprintf(stdout, "\tAborted:\t\t%d\n", countFaults(&faultList, FAULT_ABORTED));
+    fprintf(stdout, "\tOutput file:\t\"%s%s%s\"\n", (options.isPrintUndetectedFaults == TRUE? 
+                    options.undetectedFaultsFilename : "test_patterns.tvl"),
+                    (options.isBinaryFaultList ? BINARY_FAULT_FILE_EXTENSION : FAULT_FILE_EXTENSION),
+                    (options.isCompressedOutput ? COMPRESSED_FILE_EXTENSION : ""));
+
+    // Memory of the concurrent fault simulator's divergence lists
+    if(options.faultSimulator == FAULT_SIM_CONCURRENT)
+        fprintf(stdout, "\nDivergence lists:\n\tPeak memory:\t%.1f KB of %d MB\n\tPasses:\t\t%ld (%ld over the bound)\n",
+                concurrent.peakMemory / 1024.0, options.faultMemory, concurrent.numPasses, concurrent.numSplits);
+}
 
-}
\ No newline at end of file
+/*
+ *  Writes the test patterns and faults still queued for the output thread and
+ *  closes the output files
+ *  
+ *  @return nothing
+ */
+void close_output_files()
+{
+    BOOLEAN status = closeOutputStage(&outputStage);
+    if(outputStage.failedFilename[0] != '\0')
+        fprintf(stdout, "Error: Could not save the undetected faults into \"%s\".\n", outputStage.failedFilename);
+    else if(status == FALSE)
+        fprintf(stdout, "Error: Could not save the test patterns.\n");
+
+    if(patternWriter.fp != NULL && closePatternWriter(&patternWriter) == FALSE)
+    {
+        fprintf(stdout, "Error: Could not save the binary test patterns.\n");
+        status = FALSE;
+    }
+    if(patternPipe != NULL)
+    {
+        if(closePatternWriter(&patternStream) == FALSE) status = FALSE;
+        if(pclose(patternPipe) != 0)
+        {
+            fprintf(stdout, "Error: The command \"%s\" failed.\n", options.patternPipeCommand);
+            status = FALSE;
+        }
+        patternPipe = NULL;
+    }
+    if(patternFile != NULL && fclose(patternFile) != 0) status = FALSE;
+    patternFile = NULL;
+
+    if(status == FALSE)
+    {
+        if(errno == 0) errno = EIO;
+        exit(1);
+    }
+}
@@ -29,6 +29,7 @@
  *	Prototypes of test suits
  */
 void test_fixture_Parsing_Netlist_File( void );
+void test_fixture_Parsing_Fault_List_File( void );
 void test_fixture_Generate_Test_Pattern( void );
 
 
@@ -38,6 +39,7 @@ void test_fixture_Generate_Test_Pattern( void );
 void all_test_suits( void )
 {
 	test_fixture_Parsing_Netlist_File();
+	test_fixture_Parsing_Fault_List_File();
 	test_fixture_Generate_Test_Pattern();
 }
 
@@ -54,10 +56,7 @@ void setup( void )
  */
 void teardown( void )
 {
-	// Clear the hash table
-	int K = 0;
-	for(; K < MAX_GATES; K++)
-        if(hashTableGates[K].strKey) free(hashTableGates[K].strKey);
+
 }
 
 /*
@@ -19,7 +19,65 @@
  * =====================================================================================
  */
 
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
 #include "seatest.h"
+#include "pattern_file.h"
+#include "output_stage.h"
+#include "parser_netlist.h"
+#include "fault_simulation.h"
+#include "test_generator.h"
+#include "event_queue.h"
+#include "test_cube.h"
+#include "dual_rail.h"
+#include "parallel_simulation.h"
+#include "deductive_simulation.h"
+#include "concurrent_simulation.h"
+#include "fault_list.h"
+#include "logic_tables.h"
+#include "globals.h"
+
+/*
+ *	Tests prototypes
+ */
+void test_save_and_read_binary_test_patterns();
+void test_read_corrupted_binary_test_patterns();
+void test_write_test_patterns_on_the_output_thread();
+void test_read_text_test_patterns();
+void test_merge_and_fill_test_cubes();
+void test_dual_rail_logic_matches_the_logic_tables();
+void test_gate_kernels_match_the_logic_tables();
+void test_sweep_patterns_in_evaluation_order();
+void test_schedule_events_by_level();
+void test_event_driven_simulation_matches_the_sweep();
+void test_wide_gate_counts_follow_test_generation();
+void test_parallel_fault_simulation_matches_the_serial_one();
+void test_grade_test_patterns_with_the_wide_kernels();
+void test_deductive_fault_simulation_matches_the_serial_one();
+void test_concurrent_fault_simulation_matches_the_serial_one();
+
+/*
+ *	The ISCAS85 c17 circuit
+ */
+char* c17 = "INPUT(1)\nINPUT(2)\nINPUT(3)\nINPUT(6)\nINPUT(7)\n"
+			"OUTPUT(22)\nOUTPUT(23)\n"
+			"22 = NAND(10, 16)\n23 = NAND(16, 19)\n"
+			"10 = NAND(1, 3)\n11 = NAND(3, 6)\n"
+			"16 = NAND(2, 11)\n19 = NAND(11, 7)\n";
+
+
+/*
+ *	A circuit of wide, XOR and inverting gates
+ */
+char* mixed = "INPUT(a)\nINPUT(b)\nINPUT(c)\nINPUT(d)\nINPUT(e)\nINPUT(f)\n"
+			"OUTPUT(y)\nOUTPUT(z)\nOUTPUT(w)\n"
+			"g1 = XOR(a, b)\ng2 = NAND(c, d, e)\ng3 = AND(a, b, c, d, e, f)\n"
+			"g4 = NOR(g1, g2, f)\ny = XNOR(g1, g3)\nz = OR(g2, g4, g3, a, b)\n"
+			"w = NOT(g4)\n";
 
 
 /*
@@ -31,8 +89,1025 @@ void test_fixture_Generate_Test_Pattern( void )
 	test_fixture_start();               
 
 	// Run tests
-	//run_test(test_<test-name>);
+	run_test(test_save_and_read_binary_test_patterns);
+	run_test(test_read_corrupted_binary_test_patterns);
+	run_test(test_write_test_patterns_on_the_output_thread);
+	run_test(test_read_text_test_patterns);
+	run_test(test_merge_and_fill_test_cubes);
+	run_test(test_dual_rail_logic_matches_the_logic_tables);
+	run_test(test_gate_kernels_match_the_logic_tables);
+	run_test(test_sweep_patterns_in_evaluation_order);
+	run_test(test_schedule_events_by_level);
+	run_test(test_event_driven_simulation_matches_the_sweep);
+	run_test(test_wide_gate_counts_follow_test_generation);
+	run_test(test_parallel_fault_simulation_matches_the_serial_one);
+	run_test(test_grade_test_patterns_with_the_wide_kernels);
+	run_test(test_deductive_fault_simulation_matches_the_serial_one);
+	run_test(test_concurrent_fault_simulation_matches_the_serial_one);
 
 	// Ends a fixture
 	test_fixture_end();  
 }
+
+/*		*/
+void test_save_and_read_binary_test_patterns()
+{
+	CIRCUIT_INFO info;
+	PATTERN_WRITER writer;
+	PATTERN_READER reader;
+	TEST_VECTOR* tv = (TEST_VECTOR*) calloc(1, sizeof(TEST_VECTOR));
+	int32_t faults[3];
+	char* filename = "bin/test-0" BINARY_TEST_PATTERN_FILE_EXTENSION;
+	char* inputs[]  = {"01x1", "xxxx", "1100"};
+	char* outputs[] = {"1x", "00", "x1"};
+	int counts[]    = {2, 0, 3};
+	char values[71];
+
+	// Planes cross a 64-bit word boundary
+	bzero(&info, sizeof(info));
+	info.numPI = 70;
+	info.numPO = 2;
+
+	int K, L;
+	for(K = 0; K < 3; K++) faults[K] = 10 * K + 1;
+
+	assert_true(openPatternWriter(&writer, filename, &info, 42, TRUE));
+	for(K = 0; K < 3; K++)
+	{
+		for(L = 0; L < info.numPI; L++) values[L] = inputs[K][L % 4];
+		packCube(&tv->input, values, info.numPI);
+		packCube(&tv->output, outputs[K], info.numPO);
+		tv->faults_count = 0;
+		for(L = 0; L < counts[K]; L++) addTestVectorFault(tv, faults[L]);
+		assert_true(writePattern(&writer, tv));
+	}
+	assert_true(closePatternWriter(&writer));
+
+	// The patterns are read back with their don't cares and detected faults
+	assert_true(isPatternFile(filename));
+	assert_true(openPatternReader(&reader, filename));
+	assert_int_equal(3, reader.header.count);
+	assert_int_equal(70, reader.header.numPI);
+	assert_true(reader.header.netlistHash == 42);
+
+	for(K = 0; K < 3; K++)
+	{
+		assert_true(readPattern(&reader, tv));
+		assert_int_equal(info.numPI, tv->input.width);
+		unpackCube(&tv->input, values);
+		for(L = 0; L < info.numPI; L++)
+			assert_true(values[L] == inputs[K][L % 4]);
+		unpackCube(&tv->output, values);
+		assert_string_equal(outputs[K], values);
+		assert_int_equal(counts[K], reader.numFaultIds);
+		for(L = 0; L < counts[K]; L++)
+			assert_int_equal(10 * L + 1, reader.faultIds[L]);
+	}
+	assert_false(readPattern(&reader, tv));
+	assert_false(reader.isCorrupted);
+	closePatternReader(&reader);
+
+	// Against a list of 21 faults, the last pattern names a fault beyond it
+	assert_true(openPatternReader(&reader, filename));
+	reader.numFaults = 21;
+	assert_true(readPattern(&reader, tv));
+	assert_true(readPattern(&reader, tv));
+	assert_false(readPattern(&reader, tv));
+	assert_true(reader.isCorrupted);
+	closePatternReader(&reader);
+
+	// Clear memories
+	remove(filename);
+	releaseTestVector(tv);
+	free(tv);
+}
+
+/*		*/
+void test_read_corrupted_binary_test_patterns()
+{
+	CIRCUIT_INFO info;
+	PATTERN_WRITER writer;
+	PATTERN_READER reader;
+	TEST_VECTOR* tv = (TEST_VECTOR*) calloc(1, sizeof(TEST_VECTOR));
+	char* filename = "bin/test-3" BINARY_TEST_PATTERN_FILE_EXTENSION;
+	uint32_t word;
+	FILE* fp;
+	int K;
+
+	bzero(&info, sizeof(info));
+	info.numPI = 4;
+	info.numPO = 2;
+
+	// A fault id count of 2^31 is rejected rather than read into no buffer
+	assert_true(openPatternWriter(&writer, filename, &info, 0, TRUE));
+	for(K = 0; K < 2; K++)
+	{
+		packCube(&tv->input, "01x1", info.numPI);
+		packCube(&tv->output, "1x", info.numPO);
+		tv->faults_count = 0;
+		addTestVectorFault(tv, 5);
+		assert_true(writePattern(&writer, tv));
+	}
+	assert_true(closePatternWriter(&writer));
+
+	word = 0x80000000u;
+	fp = fopen(filename, "r+b");
+	fseek(fp, sizeof(PATTERN_FILE_HEADER) + 4 * sizeof(uint64_t), SEEK_SET);
+	fwrite(&word, sizeof(uint32_t), 1, fp);
+	fclose(fp);
+
+	assert_true(openPatternReader(&reader, filename));
+	assert_false(readPattern(&reader, tv));
+	assert_true(reader.isCorrupted);
+	closePatternReader(&reader);
+
+	// Fault ids announced by a corrupted flags word run past the end of the file
+	assert_true(openPatternWriter(&writer, filename, &info, 0, FALSE));
+	for(K = 0; K < 2; K++)
+	{
+		packCube(&tv->input, "1100", info.numPI);
+		packCube(&tv->output, "x1", info.numPO);
+		assert_true(writePattern(&writer, tv));
+	}
+	assert_true(closePatternWriter(&writer));
+
+	word = 0xFFFFFFFFu;
+	fp = fopen(filename, "r+b");
+	fseek(fp, offsetof(PATTERN_FILE_HEADER, flags), SEEK_SET);
+	fwrite(&word, sizeof(uint32_t), 1, fp);
+	fclose(fp);
+
+	assert_true(openPatternReader(&reader, filename));
+	for(K = 0; K < 3 && readPattern(&reader, tv); K++);
+	assert_true(K < 2);
+	assert_true(reader.isCorrupted);
+	closePatternReader(&reader);
+
+	// Clear memories
+	remove(filename);
+	releaseTestVector(tv);
+	free(tv);
+}
+
+/*		*/
+void test_write_test_patterns_on_the_output_thread()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	OUTPUT_STAGE* stage = (OUTPUT_STAGE*) calloc(1, sizeof(OUTPUT_STAGE));
+	PATTERN_WRITER writer;
+	PATTERN_READER reader;
+	TEST_VECTOR* tv = (TEST_VECTOR*) calloc(1, sizeof(TEST_VECTOR));
+	char* filename = "bin/test-1" BINARY_TEST_PATTERN_FILE_EXTENSION;
+	int count = 3 * OUTPUT_QUEUE_CAPACITY, K;
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	info.numPI = 16;
+	info.numPO = 1;
+
+	// More patterns than the queue holds go through in order
+	assert_true(openPatternWriter(&writer, filename, &info, 7, TRUE));
+	assert_true(startOutputStage(stage, &circuit, NULL, NULL, FALSE, &writer, NULL));
+	for(K = 0; K < count; K++)
+	{
+		int L;
+		clearCube(&tv->input, info.numPI);
+		for(L = 0; L < info.numPI; L++) setCubeValue(&tv->input, L, ((K >> L) & 1) ? I : O);
+		packCube(&tv->output, (K % 2) ? "1" : "x", info.numPO);
+		tv->faults_count = 0;
+		addTestVectorFault(tv, K);
+		submitTestVector(stage, tv, K + 1);
+	}
+	assert_true(closeOutputStage(stage));
+	assert_true(closePatternWriter(&writer));
+
+	assert_true(openPatternReader(&reader, filename));
+	assert_int_equal(count, reader.header.count);
+	for(K = 0; K < count; K++)
+	{
+		assert_true(readPattern(&reader, tv));
+		assert_int_equal(((K & 1) ? I : O), CUBE_VALUE(&tv->input, 0));
+		assert_int_equal((((K >> 9) & 1) ? I : O), CUBE_VALUE(&tv->input, 9));
+		assert_int_equal(((K % 2) ? I : X), CUBE_VALUE(&tv->output, 0));
+		assert_int_equal(1, reader.numFaultIds);
+		assert_int_equal(K, reader.faultIds[0]);
+	}
+	assert_false(readPattern(&reader, tv));
+	closePatternReader(&reader);
+
+	// Clear memories
+	remove(filename);
+	free(stage);
+	releaseTestVector(tv);
+	free(tv);
+}
+
+/*		*/
+void test_read_text_test_patterns()
+{
+	PATTERN_READER reader;
+	TEST_VECTOR* tv = (TEST_VECTOR*) calloc(1, sizeof(TEST_VECTOR));
+	char* filename = "bin/test-1" TEST_PATTERN_FILE_EXTENSION;
+	char values[5];
+
+	// Lines of a test pattern file, bare patterns and lines to be skipped
+	FILE* fp = fopen(filename, "w");
+	assert_true(fp != NULL);
+	fprintf(fp, "Total Gates: 6\n\nTest Vectors:\nFormat: <Pattern/Input> <Results/Output>\n\n");
+	fprintf(fp, "test     1:\t01x1\t1D\t2\t{ (A, 0) (B, 1) }\n");
+	fprintf(fp, "1X00\n\n");
+	fprintf(fp, "  0011 B0\r\n");
+	fprintf(fp, "01x1a\n");
+	fclose(fp);
+
+	assert_false(isPatternFile(filename));
+	assert_true(openPatternReader(&reader, filename));
+	assert_true(reader.isText);
+
+	// The composite values read as their fault-free values
+	assert_true(readPattern(&reader, tv));
+	unpackCube(&tv->input, values);
+	assert_string_equal("01x1", values);
+	unpackCube(&tv->output, values);
+	assert_string_equal("11", values);
+	assert_true(readPattern(&reader, tv));
+	unpackCube(&tv->input, values);
+	assert_string_equal("1x00", values);
+	assert_int_equal(0, tv->output.width);
+	assert_true(readPattern(&reader, tv));
+	unpackCube(&tv->input, values);
+	assert_string_equal("0011", values);
+	unpackCube(&tv->output, values);
+	assert_string_equal("00", values);
+	assert_false(readPattern(&reader, tv));
+	assert_false(reader.isCorrupted);
+	closePatternReader(&reader);
+
+	// Clear memories
+	remove(filename);
+	releaseTestVector(tv);
+	free(tv);
+}
+
+/*		*/
+void test_merge_and_fill_test_cubes()
+{
+	TEST_CUBE cube, other, filled;
+	char values[71];
+	int K;
+
+	bzero(&cube, sizeof(cube));
+	bzero(&other, sizeof(other));
+	bzero(&filled, sizeof(filled));
+	// Values cross a 64-bit word boundary
+	for(K = 0; K < 70; K++) values[K] = 'x';
+	values[70] = '\0';
+	values[1] = '1';
+	values[66] = '0';
+	packCube(&cube, values, 70);
+	values[1] = 'x';
+	values[66] = 'x';
+	values[2] = '0';
+	values[69] = '1';
+	packCube(&other, values, 70);
+
+	// Cubes specifying no value differently merge into one
+	assert_true(areCubesCompatible(&cube, &other));
+	assert_true(hashCube(&cube) != hashCube(&other));
+	assert_true(mergeCubes(&cube, &other));
+	unpackCube(&cube, values);
+	assert_int_equal('1', values[1]);
+	assert_int_equal('0', values[2]);
+	assert_int_equal('0', values[66]);
+	assert_int_equal('1', values[69]);
+	assert_int_equal('x', values[68]);
+
+	// A conflicting cube leaves the merged cube unchanged
+	setCubeValue(&other, 66, I);
+	assert_false(areCubesCompatible(&cube, &other));
+	uint64_t hash = hashCube(&cube);
+	assert_false(mergeCubes(&cube, &other));
+	assert_true(hash == hashCube(&cube));
+
+	// Filling the don't-cares keeps the specified values and no bit past the width
+	copyCube(&filled, &cube);
+	fillCube(&filled, ONES);
+	unpackCube(&filled, values);
+	assert_int_equal('0', values[2]);
+	assert_int_equal('1', values[68]);
+	assert_true(filled.care[1] == 0x3F && filled.value[1] == 0x3B);
+	copyCube(&filled, &cube);
+	fillCube(&filled, ZEROS);
+	assert_true(filled.care[1] == 0x3F && filled.value[1] == 0x20);
+	assert_true(areCubesCompatible(&cube, &filled));
+
+	// A wider test cube grows the bit-vectors, a narrower one reuses them
+	clearCube(&filled, 3000);
+	setCubeValue(&filled, 2999, I);
+	assert_true(filled.capacity >= 3000);
+	assert_int_equal(I, CUBE_VALUE(&filled, 2999));
+	assert_int_equal(X, CUBE_VALUE(&filled, 2998));
+	uint64_t* bits = filled.care;
+	copyCube(&filled, &cube);
+	assert_true(filled.care == bits);
+	assert_true(hashCube(&filled) == hashCube(&cube));
+
+	releaseCube(&cube);
+	releaseCube(&other);
+	releaseCube(&filled);
+	assert_true(filled.care == NULL && filled.capacity == 0);
+}
+
+/*		*/
+void test_dual_rail_logic_matches_the_logic_tables()
+{
+	DUAL_RAIL a, b, word;
+	LOGIC_VALUE value;
+	int K, L;
+
+	// Every lane keeps its value, whatever the other lanes hold
+	for(K = 0; K < 64; K++)
+		for(value = O; value <= X; value++)
+		{
+			word = spreadDualRail((K % 2) ? X : D);
+			setDualRailValue(&word, K, value);
+			assert_int_equal(value, getDualRailValue(&word, K));
+			assert_int_equal((K % 2) ? X : D, getDualRailValue(&word, (K + 1) % 64));
+		}
+
+	// Lane 5 * K + L holds the pair of values (K, L), covering all of them at once
+	a = spreadDualRail(O);
+	b = spreadDualRail(O);
+	for(K = O; K <= X; K++)
+		for(L = O; L <= X; L++)
+		{
+			setDualRailValue(&a, 5 * K + L, K);
+			setDualRailValue(&b, 5 * K + L, L);
+		}
+
+	DUAL_RAIL and = andDualRail(a, b), or = orDualRail(a, b), xor = xorDualRail(a, b);
+	DUAL_RAIL nand = negateDualRail(and, TRUE), nor = negateDualRail(or, TRUE);
+	DUAL_RAIL xnor = negateDualRail(xor, TRUE), inv = negateDualRail(a, TRUE);
+	for(K = O; K <= X; K++)
+		for(L = O; L <= X; L++)
+		{
+			assert_int_equal(TABLE_AND[K][L], getDualRailValue(&and, 5 * K + L));
+			assert_int_equal(TABLE_NAND[K][L], getDualRailValue(&nand, 5 * K + L));
+			assert_int_equal(TABLE_OR[K][L], getDualRailValue(&or, 5 * K + L));
+			assert_int_equal(TABLE_NOR[K][L], getDualRailValue(&nor, 5 * K + L));
+			assert_int_equal(TABLE_XOR[K][L], getDualRailValue(&xor, 5 * K + L));
+			assert_int_equal(TABLE_XNOR[K][L], getDualRailValue(&xnor, 5 * K + L));
+			assert_int_equal(TABLE_INV[K], getDualRailValue(&inv, 5 * K + L));
+			assert_int_equal(negate(K, FALSE), getDualRailValue(&a, 5 * K + L));
+		}
+
+	// The unknown lanes keep both of their value bits cleared
+	assert_true(((and.good | and.faulty) & and.unknown) == 0);
+	assert_true(((or.good | or.faulty) & or.unknown) == 0);
+	assert_true(((xnor.good | xnor.faulty) & xnor.unknown) == 0);
+	assert_true(((nand.good | nand.faulty) & nand.unknown) == 0);
+}
+
+/*
+ *	Output of a gate folding the values of its inputs through a logic table,
+ *	for the true and the faulty circuits apart. A circuit's value is known when
+ *	every choice of 0 or 1 for the X inputs gives the same one.
+ */
+LOGIC_VALUE referenceGateOutput(const LOGIC_VALUE (*table)[5], BOOLEAN inv, const uint8_t* value, int numIn)
+{
+	int side, choice, K, numUnknown = 0, known[2];
+	LOGIC_VALUE result, first;
+
+	for(K = 0; K < numIn; K++) numUnknown += (value[K] == X);
+	for(side = 0; side < 2; side++)
+	{
+		known[side] = -1;
+		for(choice = 0; choice < (1 << numUnknown); choice++)
+		{
+			int unknownSeen = 0;
+			for(K = 0; K < numIn; K++)
+			{
+				LOGIC_VALUE input;
+				if(value[K] == X) input = ((choice >> unknownSeen++) & 1) ? I : O;
+				else if(side == 0) input = (value[K] == I || value[K] == D) ? I : O;
+				else input = (value[K] == I || value[K] == B) ? I : O;
+				result = (K == 0) ? input : table[result][input];
+			}
+			if(choice == 0) first = result;
+			else if(result != first) break;
+		}
+		if(choice == (1 << numUnknown)) known[side] = (first == I);
+	}
+
+	if(known[0] < 0 || known[1] < 0) return X;
+	result = known[0] ? (known[1] ? I : D) : (known[1] ? B : O);
+	return negate(result, inv);
+}
+
+/*		*/
+void test_gate_kernels_match_the_logic_tables()
+{
+	static const GATE_TYPE types[3] = { AND, OR, XOR };
+	const LOGIC_VALUE (*tables[3])[5] = { TABLE_AND, TABLE_OR, TABLE_XOR };
+	int32_t in[6] = { 0, 1, 2, 3, 4, 5 };
+	int32_t count[MAX_LOGIC_VALUES];
+	uint8_t value[6];
+	DUAL_RAIL word[6], output;
+	int T, inv, numIn, combination, K, N, mismatches = 0;
+	LOGIC_VALUE expected;
+	uint8_t kernel;
+
+	// Every combination of values on up to six inputs, the order of the inputs
+	// not mattering. On two inputs, the reference gives the logic tables.
+	for(T = 0; T < 3; T++)
+		for(inv = FALSE; inv <= TRUE; inv++)
+			for(numIn = 1; numIn <= 6; numIn++)
+			{
+				kernel = selectGateKernel(types[T], (BOOLEAN) inv, numIn);
+				int combinations = 1;
+				for(K = 0; K < numIn; K++) combinations *= 5;
+
+				for(combination = 0; combination < combinations; combination++)
+				{
+					bzero(count, sizeof(count));
+					for(K = 0, N = combination; K < numIn; K++, N /= 5)
+					{
+						value[K] = N % 5;
+						count[value[K]]++;
+						word[K] = spreadDualRail(value[K]);
+					}
+					expected = referenceGateOutput(tables[T], (BOOLEAN) inv, value, numIn);
+					if(numIn == 2 && expected != negate(tables[T][value[0]][value[1]], (BOOLEAN) inv))
+						mismatches++;
+					if(evaluateGateKernel(kernel, value, in, numIn) != expected) mismatches++;
+					if(countGateOutput(kernel, count) != expected) mismatches++;
+
+					output = evaluateDualRailKernel(kernel, word, in, numIn);
+					if(getDualRailValue(&output, 0) != expected || getDualRailValue(&output, 63) != expected)
+						mismatches++;
+				}
+			}
+	assert_int_equal(0, mismatches);
+
+	// Buffers read their first input only, other gates and gates without inputs are X
+	value[0] = D;
+	value[1] = O;
+	assert_int_equal(B, evaluateGateKernel(selectGateKernel(BUF, TRUE, 2), value, in, 2));
+	assert_int_equal(D, evaluateGateKernel(selectGateKernel(BUF, FALSE, 1), value, in, 1));
+	assert_int_equal(X, evaluateGateKernel(selectGateKernel(FF, FALSE, 1), value, in, 1));
+	assert_int_equal(X, evaluateGateKernel(selectGateKernel(AND, TRUE, 0), value, in, 0));
+}
+
+/*		*/
+void test_sweep_patterns_in_evaluation_order()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT fault;
+	BOOLEAN wasFaultExcited;
+	TEST_CUBE input, output;
+	char values[3];
+
+	bzero(&input, sizeof(input));
+	bzero(&output, sizeof(output));
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, c17, strlen(c17)));
+	computeGateLevels(&circuit, &info);
+
+	// Every gate is listed once, after all of its inputs
+	int K, L;
+	int* position = (int*) calloc(info.numGates, sizeof(int));
+	for(K = 0; K < info.numGates; K++)
+		position[circuit.order[K]] = K + 1;
+	for(K = 0; K < info.numGates; K++)
+	{
+		assert_true(position[K] > 0);
+		for(L = 0; L < NUM_FANIN(&circuit, K); L++)
+			assert_true(position[FANIN(&circuit, K, L)] < position[K]);
+	}
+	free(position);
+
+	// Fault-free circuit, without clearing it between the patterns
+	packCube(&input, "00000", info.numPI);
+	assert_true(sweep_pattern(&circuit, &info, &input, NULL, NULL, &output));
+	unpackCube(&output, values);
+	assert_string_equal("00", values);
+	packCube(&input, "11111", info.numPI);
+	assert_true(sweep_pattern(&circuit, &info, &input, NULL, NULL, &output));
+	unpackCube(&output, values);
+	assert_string_equal("10", values);
+
+	// A stuck-at fault on the stem of a fan out, B reaching output 23
+	fault.index = findIndex(&circuit, &info.numGates, "16", FALSE);
+	fault.type = ST_0;
+	wasFaultExcited = FALSE;
+	assert_true(sweep_pattern(&circuit, &info, &input, &fault, &wasFaultExcited, &output));
+	assert_true(wasFaultExcited);
+	assert_int_equal(I, circuit.value[info.outputs[0]]);
+	assert_int_equal(B, circuit.value[info.outputs[1]]);
+	unpackCube(&output, values);
+	assert_string_equal("10", values);
+
+	// A fault that the pattern cannot excite
+	fault.type = ST_1;
+	assert_false(sweep_pattern(&circuit, &info, &input, &fault, &wasFaultExcited, NULL));
+	assert_false(wasFaultExcited);
+
+	// Clear memories
+	releaseCube(&input);
+	releaseCube(&output);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_schedule_events_by_level()
+{
+	EVENT_QUEUE queue;
+	int32_t level[] = {2, 0, 1, 0, 2, 1};
+
+	bzero(&queue, sizeof(queue));
+	buildEventQueue(&queue, level, 6);
+	assert_int_equal(3, queue.numLevels);
+	assert_int_equal(-1, nextEvent(&queue));
+
+	// Gates leave level by level, in the order they were scheduled, and once
+	scheduleEvent(&queue, 4, 2);
+	scheduleEvent(&queue, 5, 1);
+	scheduleEvent(&queue, 0, 2);
+	scheduleEvent(&queue, 4, 2);
+	scheduleEvent(&queue, 2, 1);
+	assert_int_equal(4, queue.size);
+	assert_int_equal(5, nextEvent(&queue));
+	assert_int_equal(2, nextEvent(&queue));
+
+	// A bucket that wraps around, and a gate scheduled below the others
+	assert_int_equal(4, nextEvent(&queue));
+	scheduleEvent(&queue, 4, 2);
+	scheduleEvent(&queue, 3, 0);
+	assert_int_equal(3, nextEvent(&queue));
+	assert_int_equal(0, nextEvent(&queue));
+	assert_int_equal(4, nextEvent(&queue));
+	assert_int_equal(-1, nextEvent(&queue));
+
+	// Dropped events can be scheduled again
+	scheduleEvent(&queue, 1, 0);
+	scheduleEvent(&queue, 5, 1);
+	clearEventQueue(&queue);
+	assert_int_equal(0, queue.size);
+	scheduleEvent(&queue, 5, 1);
+	assert_int_equal(5, nextEvent(&queue));
+
+	// Clear memories
+	releaseEventQueue(&queue);
+}
+
+/*		*/
+void test_event_driven_simulation_matches_the_sweep()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT fault;
+	BOOLEAN wasExcited, wasSwept;
+	TEST_CUBE input, event, sweep;
+	char* patterns[] = {"00000", "11111", "10101", "01x10", "x1x0x"};
+	int K, P;
+
+	bzero(&input, sizeof(input));
+	bzero(&event, sizeof(event));
+	bzero(&sweep, sizeof(sweep));
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, c17, strlen(c17)));
+	computeGateLevels(&circuit, &info);
+
+	// Gates are never looked up by name while simulating
+	int lookups = circuit.names.lookups;
+	findIndex(&circuit, &info.numGates, "16", FALSE);
+	assert_int_equal(lookups + 1, circuit.names.lookups);
+	lookups = circuit.names.lookups;
+
+	for(P = 0; P < 5; P++)
+	{
+		// Fault-free circuit
+		packCube(&input, patterns[P], info.numPI);
+		clearPropagationValuesCircuit(&circuit, info.numGates);
+		generate_output(&circuit, &info, &input, &event);
+		sweep_pattern(&circuit, &info, &input, NULL, NULL, &sweep);
+		assert_true(hashCube(&sweep) == hashCube(&event));
+		assert_int_equal(sweep.width, event.width);
+		assert_true(memcmp(sweep.care, event.care, CUBE_WORDS(sweep.width) * sizeof(uint64_t)) == 0);
+		assert_true(memcmp(sweep.value, event.value, CUBE_WORDS(sweep.width) * sizeof(uint64_t)) == 0);
+
+		// Every stuck-at fault on every gate
+		for(K = 0; K < 2 * info.numGates; K++)
+		{
+			fault.index = K / 2;
+			fault.type = (K % 2) ? ST_1 : ST_0;
+
+			clearPropagationValuesCircuit(&circuit, info.numGates);
+			wasExcited = wasSwept = FALSE;
+			test_pattern(&circuit, &info, &input, &fault, &wasExcited, &event);
+			sweep_pattern(&circuit, &info, &input, &fault, &wasSwept, &sweep);
+			assert_int_equal(wasSwept, wasExcited);
+			if(wasExcited) assert_true(areCubesCompatible(&sweep, &event) && hashCube(&sweep) == hashCube(&event));
+		}
+	}
+	assert_int_equal(lookups, circuit.names.lookups);
+
+	// Clear memories
+	releaseCube(&input);
+	releaseCube(&event);
+	releaseCube(&sweep);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_wide_gate_counts_follow_test_generation()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	int32_t count[MAX_LOGIC_VALUES];
+	char* netlist = "INPUT(a)\nINPUT(b)\nINPUT(c)\nINPUT(d)\nINPUT(e)\n"
+					"OUTPUT(y)\nOUTPUT(z)\n"
+					"n = NOT(e)\ny = NOR(a, b, c, d, n)\nz = AND(a, b, y)\n";
+	int K, L, G, step;
+
+	// The wide gate reads stems (c, d, n) and fan out segments (a, b)
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, netlist, strlen(netlist)));
+	computeGateLevels(&circuit, &info);
+	int index_y = findIndex(&circuit, &info.numGates, "y", FALSE);
+	assert_int_equal(KERNEL_MANY, KERNEL_ARITY(circuit.kernel[index_y]));
+	assert_int_equal(2, INPUT_COUNTS(&circuit, index_y)[BRANCH_INPUTS]);
+
+	// Whatever the values set, the counts match the inputs read again
+	srand(7);
+	for(step = 0; step < 2000; step++)
+	{
+		if(step % 100 == 0) clearPropagationValuesCircuit(&circuit, info.numGates);
+		setGateValue(&circuit, rand() % info.numGates, (LOGIC_VALUE) (rand() % MAX_LOGIC_VALUES));
+
+		for(G = 0; G < info.numGates; G++)
+		{
+			if(KERNEL_ARITY(circuit.kernel[G]) != KERNEL_MANY) continue;
+			bzero(count, sizeof(count));
+			for(K = 0; K < NUM_FANIN(&circuit, G); K++)
+				count[getLogicValue(&circuit, G, K)]++;
+			for(L = 0; L < MAX_LOGIC_VALUES; L++)
+				assert_int_equal(count[L], INPUT_COUNTS(&circuit, G)[L]);
+			assert_int_equal(countGateOutput(circuit.kernel[G], count), computeGateOutput(&circuit, G));
+		}
+	}
+
+	// Clear memories
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_parallel_fault_simulation_matches_the_serial_one()
+{
+	char* netlists[] = { c17, mixed };
+	int counts[] = { 1, 4, 16, 64, 65, 200, 256, 500, 512 };
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST serial, parallel;
+	PARALLEL_SIMULATOR sim;
+	TEST_VECTOR* tv = (TEST_VECTOR*) calloc(MAX_PARALLEL_PATTERNS, sizeof(TEST_VECTOR));
+	TEST_CUBE output;
+	const PARALLEL_KERNEL* kernel;
+	int C, G, K, L, N, P, count;
+
+	// Every kernel the CPU runs, the generic vectors ones whatever the CPU
+	bzero(&output, sizeof(output));
+	srand(1);
+	for(N = 0; N < NUM_PARALLEL_KERNELS; N++)
+	for(C = 0; C < 2; C++)
+	{
+		kernel = PARALLEL_KERNELS[N];
+		if(kernel->isSupported() == FALSE) continue;
+
+		bzero(&circuit, sizeof(circuit));
+		bzero(&info, sizeof(info));
+		bzero(&sim, sizeof(sim));
+		assert_true(parseNetlistBuffer(&circuit, &info, netlists[C], strlen(netlists[C])));
+		computeGateLevels(&circuit, &info);
+		buildParallelSimulator(&sim, &circuit, &info, kernel);
+		int32_t* detected = (int32_t*) malloc(4 * (info.numGates + circuit.numEdges) * sizeof(int32_t));
+
+		// Blocks of every size the kernel takes, the expected outputs of some test
+		// vectors contradicting their inputs as the ATPG may give them
+		for(G = 0; G < sizeof(counts) / sizeof(int) && counts[G] <= kernel->numPatterns; G++)
+		{
+			// Both stuck-at faults of every gate, some of them twice, and of every fan out branch
+			bzero(&serial, sizeof(serial));
+			bzero(&parallel, sizeof(parallel));
+			allocateFaultList(&serial, 4 * (info.numGates + circuit.numEdges));
+			allocateFaultList(&parallel, 4 * (info.numGates + circuit.numEdges));
+			for(K = 0; K < 2 * info.numGates + 4; K++)
+			{
+				appendFault(&serial, (K / 2) % info.numGates, -1, (K % 2) ? ST_1 : ST_0);
+				appendFault(&parallel, (K / 2) % info.numGates, -1, (K % 2) ? ST_1 : ST_0);
+			}
+			for(K = 0; K < info.numGates; K++)
+				for(L = 0; L < 2 * NUM_FANOUT(&circuit, K) && NUM_FANOUT(&circuit, K) > 1; L++)
+				{
+					appendFault(&serial, K, FANOUT(&circuit, K, L / 2), (L % 2) ? ST_1 : ST_0);
+					appendFault(&parallel, K, FANOUT(&circuit, K, L / 2), (L % 2) ? ST_1 : ST_0);
+				}
+
+			count = counts[G];
+			for(P = 0; P < count; P++)
+			{
+				clearCube(&tv[P].input, info.numPI);
+				for(K = 0; K < info.numPI; K++) setCubeValue(&tv[P].input, K, (rand() % 2) ? I : O);
+				tv[P].faults_count = 0;
+			}
+
+			simulateParallelPatterns(&sim, &circuit, &info, tv, count);
+			for(P = 0; P < count; P++)
+			{
+				collectParallelOutputs(&sim, &info, P, &output);
+				sweep_pattern(&circuit, &info, &tv[P].input, NULL, NULL, &tv[P].output);
+				assert_true(hashCube(&output) == hashCube(&tv[P].output));
+				if(P % 7 == 3) setCubeValue(&tv[P].output, 0, CUBE_VALUE(&tv[P].output, 0) == I ? O : I);
+			}
+			dropParallelFaults(&sim, &circuit, &info, &parallel, tv, 0);
+
+			// The serial fault simulator drops the same faults with the same test vectors
+			for(P = 0; P < count; P++)
+			{
+				int numDetected = tv[P].faults_count;
+				if(numDetected > 0) memcpy(detected, tv[P].faults_list, numDetected * sizeof(int32_t));
+				tv[P].faults_count = 0;
+				simulateTestVector(&circuit, &info, &serial, &tv[P], 0);
+				assert_int_equal(numDetected, tv[P].faults_count);
+				if(numDetected == tv[P].faults_count && numDetected > 0)
+					assert_true(memcmp(detected, tv[P].faults_list, numDetected * sizeof(int32_t)) == 0);
+			}
+			for(K = 0; K < serial.count; K++)
+				assert_int_equal(IS_DETECTED(&serial, K), IS_DETECTED(&parallel, K));
+			clearFaultList(&serial);
+			clearFaultList(&parallel);
+		}
+
+		free(detected);
+		releaseParallelSimulator(&sim);
+		clearCircuit(&circuit, &info);
+	}
+
+	for(P = 0; P < MAX_PARALLEL_PATTERNS; P++) releaseTestVector(&tv[P]);
+	free(tv);
+	releaseCube(&output);
+}
+
+/*		*/
+void test_grade_test_patterns_with_the_wide_kernels()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	PARALLEL_SIMULATOR sim;
+	PATTERN_WRITER writer;
+	PATTERN_READER reader;
+	TEST_VECTOR* tv = (TEST_VECTOR*) calloc(MAX_PARALLEL_PATTERNS, sizeof(TEST_VECTOR));
+	char* filename = "bin/test-2" BINARY_TEST_PATTERN_FILE_EXTENSION;
+	const PARALLEL_KERNEL* kernel;
+	int K, N, P, count, total, numPatterns = 600;
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, mixed, strlen(mixed)));
+	computeGateLevels(&circuit, &info);
+
+	// More patterns than the widest kernel takes at once
+	srand(2);
+	assert_true(openPatternWriter(&writer, filename, &info, 0, FALSE));
+	for(P = 0; P < numPatterns; P++)
+	{
+		clearCube(&tv->input, info.numPI);
+		clearCube(&tv->output, info.numPO);
+		for(K = 0; K < info.numPI; K++) setCubeValue(&tv->input, K, (rand() % 2) ? I : O);
+		tv->faults_count = 0;
+		assert_true(writePattern(&writer, tv));
+	}
+	assert_true(closePatternWriter(&writer));
+
+	// Blocks are read as wide as the kernel, so that every block but a short last
+	// one runs on the kernel itself rather than on the 64 lanes fallback
+	for(N = 0; N < NUM_PARALLEL_KERNELS; N++)
+	{
+		kernel = PARALLEL_KERNELS[N];
+		if(kernel->isSupported() == FALSE) continue;
+
+		bzero(&sim, sizeof(sim));
+		buildParallelSimulator(&sim, &circuit, &info, kernel);
+		assert_true(openPatternReader(&reader, filename));
+		for(total = 0; (count = readPatternBlock(&reader, tv, kernel->numPatterns)) > 0; total += count)
+		{
+			assert_int_equal((numPatterns - total < kernel->numPatterns) ? numPatterns - total : kernel->numPatterns, count);
+			simulateParallelPatterns(&sim, &circuit, &info, tv, count);
+			assert_true(sim.active == ((count > PARALLEL_PATTERNS) ? kernel : &scalarParallelKernel));
+		}
+		assert_int_equal(numPatterns, total);
+		assert_false(reader.isCorrupted);
+		closePatternReader(&reader);
+		releaseParallelSimulator(&sim);
+	}
+
+	for(P = 0; P < MAX_PARALLEL_PATTERNS; P++) releaseTestVector(&tv[P]);
+	free(tv);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_deductive_fault_simulation_matches_the_serial_one()
+{
+	char* netlists[] = { c17, mixed };
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST serial, deductive;
+	DEDUCTIVE_SIMULATOR sim;
+	TEST_VECTOR tv, copy;
+	int C, K, L, P, R, start;
+
+	srand(1);
+	bzero(&sim, sizeof(sim));
+	bzero(&tv, sizeof(tv));
+	bzero(&copy, sizeof(copy));
+	for(C = 0; C < 4; C++)
+	{
+		bzero(&circuit, sizeof(circuit));
+		bzero(&info, sizeof(info));
+		assert_true(parseNetlistBuffer(&circuit, &info, netlists[C % 2], strlen(netlists[C % 2])));
+		computeGateLevels(&circuit, &info);
+
+		// The second time, inner gates always unknown leave faults X on their fan out
+		if(C >= 2)
+			for(K = 0; K < info.numGates; K++)
+				if(NUM_FANIN(&circuit, K) > 0 && K % 3 == 1)
+					circuit.kernel[K] = GATE_KERNEL(FUNCTION_AND, 0);
+		buildDeductiveSimulator(&sim, &circuit, &info);
+
+		for(R = 0; R < 8; R++)
+		{
+			// Both stuck-at faults of every gate, some of them twice, and of every fan out branch
+			bzero(&serial, sizeof(serial));
+			bzero(&deductive, sizeof(deductive));
+			allocateFaultList(&serial, 4 * (info.numGates + circuit.numEdges));
+			allocateFaultList(&deductive, 4 * (info.numGates + circuit.numEdges));
+			for(K = 0; K < 2 * info.numGates + 4; K++)
+			{
+				appendFault(&serial, (K / 2) % info.numGates, -1, (K % 2) ? ST_1 : ST_0);
+				appendFault(&deductive, (K / 2) % info.numGates, -1, (K % 2) ? ST_1 : ST_0);
+			}
+			for(K = 0; K < info.numGates; K++)
+				for(L = 0; L < 2 * NUM_FANOUT(&circuit, K) && NUM_FANOUT(&circuit, K) > 1; L++)
+				{
+					appendFault(&serial, K, FANOUT(&circuit, K, L / 2), (L % 2) ? ST_1 : ST_0);
+					appendFault(&deductive, K, FANOUT(&circuit, K, L / 2), (L % 2) ? ST_1 : ST_0);
+				}
+
+			// Random test vectors, the expected outputs of some contradicting their
+			// inputs, dropping the faults from some point of the list on
+			for(P = 0; P < 16; P++)
+			{
+				clearCube(&tv.input, info.numPI);
+				for(K = 0; K < info.numPI; K++) setCubeValue(&tv.input, K, (rand() % 2) ? I : O);
+				sweep_pattern(&circuit, &info, &tv.input, NULL, NULL, &tv.output);
+				if(P % 5 == 2)
+					for(K = 0; K < info.numPO; K++)
+						if(rand() % 2) setCubeValue(&tv.output, K, CUBE_VALUE(&tv.output, K) == I ? O : I);
+				clearCube(&copy.input, info.numPI);
+				clearCube(&copy.output, info.numPO);
+				mergeCubes(&copy.input, &tv.input);
+				mergeCubes(&copy.output, &tv.output);
+				start = (P % 3 == 1) ? rand() % serial.count : 0;
+
+				tv.faults_count = copy.faults_count = 0;
+				simulateTestVector(&circuit, &info, &serial, &tv, start);
+				simulateDeductiveVector(&sim, &circuit, &info, &deductive, &copy, start);
+				assert_int_equal(tv.faults_count, copy.faults_count);
+				if(tv.faults_count == copy.faults_count)
+					assert_true(memcmp(tv.faults_list, copy.faults_list, tv.faults_count * sizeof(int32_t)) == 0);
+			}
+			for(K = 0; K < serial.count; K++)
+				assert_int_equal(IS_DETECTED(&serial, K), IS_DETECTED(&deductive, K));
+			clearFaultList(&serial);
+			clearFaultList(&deductive);
+		}
+
+		clearCircuit(&circuit, &info);
+	}
+
+	releaseDeductiveSimulator(&sim);
+	releaseTestVector(&tv);
+	releaseTestVector(&copy);
+}
+
+/*		*/
+void test_concurrent_fault_simulation_matches_the_serial_one()
+{
+	char* netlists[] = { c17, mixed };
+	size_t limits[] = { (size_t) 1 << 20, 64 };
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST serial, concurrent;
+	CONCURRENT_SIMULATOR sim;
+	TEST_VECTOR tv, copy;
+	int C, F, K, L, M, P, start;
+
+	srand(1);
+	bzero(&sim, sizeof(sim));
+	bzero(&tv, sizeof(tv));
+	bzero(&copy, sizeof(copy));
+	for(C = 0; C < 4; C++)
+	{
+		bzero(&circuit, sizeof(circuit));
+		bzero(&info, sizeof(info));
+		assert_true(parseNetlistBuffer(&circuit, &info, netlists[C % 2], strlen(netlists[C % 2])));
+		computeGateLevels(&circuit, &info);
+
+		// The second time, inner gates always unknown leave faults X on their fan out
+		if(C >= 2)
+			for(K = 0; K < info.numGates; K++)
+				if(NUM_FANIN(&circuit, K) > 0 && K % 3 == 1)
+					circuit.kernel[K] = GATE_KERNEL(FUNCTION_AND, 0);
+
+		// Divergence lists within the bound, and outgrowing it to be simulated in passes
+		for(M = 0; M < 2; M++)
+		{
+			buildConcurrentSimulator(&sim, &circuit, &info, limits[M]);
+
+			// Both stuck-at faults of every gate, some of them twice, and of every fan out branch
+			bzero(&serial, sizeof(serial));
+			bzero(&concurrent, sizeof(concurrent));
+			allocateFaultList(&serial, 4 * (info.numGates + circuit.numEdges));
+			allocateFaultList(&concurrent, 4 * (info.numGates + circuit.numEdges));
+			for(K = 0; K < 2 * info.numGates + 4; K++)
+			{
+				appendFault(&serial, (K / 2) % info.numGates, -1, (K % 2) ? ST_1 : ST_0);
+				appendFault(&concurrent, (K / 2) % info.numGates, -1, (K % 2) ? ST_1 : ST_0);
+			}
+			for(K = 0; K < info.numGates; K++)
+				for(L = 0; L < 2 * NUM_FANOUT(&circuit, K) && NUM_FANOUT(&circuit, K) > 1; L++)
+				{
+					appendFault(&serial, K, FANOUT(&circuit, K, L / 2), (L % 2) ? ST_1 : ST_0);
+					appendFault(&concurrent, K, FANOUT(&circuit, K, L / 2), (L % 2) ? ST_1 : ST_0);
+				}
+
+			// A sequence of random test vectors, the expected outputs of some
+			// contradicting their inputs, from a moving point of the fault list on,
+			// some faults being detected or detected no more in between
+			for(P = 0, start = 0; P < 64; P++)
+			{
+				clearCube(&tv.input, info.numPI);
+				for(K = 0; K < info.numPI; K++) setCubeValue(&tv.input, K, (rand() % 2) ? I : O);
+				sweep_pattern(&circuit, &info, &tv.input, NULL, NULL, &tv.output);
+				if(P % 5 == 2)
+					for(K = 0; K < info.numPO; K++)
+						if(rand() % 2) setCubeValue(&tv.output, K, CUBE_VALUE(&tv.output, K) == I ? O : I);
+				clearCube(&copy.input, info.numPI);
+				clearCube(&copy.output, info.numPO);
+				mergeCubes(&copy.input, &tv.input);
+				mergeCubes(&copy.output, &tv.output);
+
+				if(P % 16 == 15) start = 0;
+				else if(P % 4 == 1) start++;
+				F = rand() % serial.count;
+				if(P % 6 == 3)
+				{
+					CLEAR_FAULT_STATUS(&serial, F, FAULT_DETECTED);
+					CLEAR_FAULT_STATUS(&concurrent, F, FAULT_DETECTED);
+				}
+				else if(P % 6 == 4)
+				{
+					SET_FAULT_STATUS(&serial, F, FAULT_DETECTED);
+					SET_FAULT_STATUS(&concurrent, F, FAULT_DETECTED);
+				}
+
+				tv.faults_count = copy.faults_count = 0;
+				simulateTestVector(&circuit, &info, &serial, &tv, start);
+				simulateConcurrentVector(&sim, &circuit, &info, &concurrent, &copy, start);
+				assert_int_equal(tv.faults_count, copy.faults_count);
+				if(tv.faults_count == copy.faults_count)
+					assert_true(memcmp(tv.faults_list, copy.faults_list, tv.faults_count * sizeof(int32_t)) == 0);
+			}
+			for(K = 0; K < serial.count; K++)
+				assert_int_equal(IS_DETECTED(&serial, K), IS_DETECTED(&concurrent, K));
+
+			// Only the passes of the small bound give up on the lists they outgrew
+			assert_true(sim.peakMemory > 0);
+			assert_true((M == 0) == (sim.numSplits == 0));
+			clearFaultList(&serial);
+			clearFaultList(&concurrent);
+		}
+
+		clearCircuit(&circuit, &info);
+	}
+
+	releaseConcurrentSimulator(&sim);
+	releaseTestVector(&tv);
+	releaseTestVector(&copy);
+}
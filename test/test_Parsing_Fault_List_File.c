@@ -0,0 +1,302 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  test_Parsing_Fault_List_File.c
+ *
+ *    Description:  Unit tests for the "Fault List" module
+ *
+ *        Version:  1.0
+ *        Created:  17 October 2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ *         Author:  Francis Sowani <fts215@nyu.edu>
+ *         Author:  Wei-Chung Lin <wcl262@nyu.edu>
+ *     Supervisor:  Prof. Ozgur Sinanoglu <os22@nyu.edu>
+ *     Supervisor:  Samah Saeed <sms22@nyu.edu>
+ *   Organization:  New York University Abu Dhabi
+ *
+ * =====================================================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "seatest.h"
+#include "parser_netlist.h"
+#include "fault_list.h"
+#include "data_file.h"
+#include "globals.h"
+
+/*
+ *	Tests prototypes
+ */
+void test_find_fan_out_branch_slots();
+void test_parse_fault_list_from_a_buffer();
+void test_index_faults_by_gate_and_count_statuses();
+void test_save_and_load_fault_lists();
+void test_save_and_load_compressed_fault_lists();
+
+
+/*
+ *	Run all tests
+ */
+void test_fixture_Parsing_Fault_List_File( void )
+{
+	// Starts a fixture
+	test_fixture_start();
+
+	// Run tests
+	run_test(test_find_fan_out_branch_slots);
+	run_test(test_parse_fault_list_from_a_buffer);
+	run_test(test_index_faults_by_gate_and_count_statuses);
+	run_test(test_save_and_load_fault_lists);
+	run_test(test_save_and_load_compressed_fault_lists);
+
+	// Ends a fixture
+	test_fixture_end();
+}
+
+/*		*/
+void test_find_fan_out_branch_slots()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	BRANCH_INDEX branches;
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	bzero(&branches, sizeof(branches));
+	assert_true(populateCircuit(&circuit, &info, "benchmarks/test-0.bench"));
+
+	buildBranchIndex(&circuit, info.numGates, &branches);
+
+	int K, L;
+	for(K = 0; K < info.numGates; K++)
+		for(L = 0; L < NUM_FANOUT(&circuit, K); L++)
+			assert_int_equal(L, findBranchSlot(&branches, K, FANOUT(&circuit, K, L)));
+
+	// Unconnected gates have no branch
+	int index_A = findIndex(&circuit, &info.numGates, "A", FALSE);
+	int index_L = findIndex(&circuit, &info.numGates, "L", FALSE);
+	assert_int_equal(-1, findBranchSlot(&branches, index_A, index_L));
+	assert_int_equal(-1, findBranchSlot(&branches, index_L, index_A));
+
+	// Clear memories
+	releaseBranchIndex(&branches);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_parse_fault_list_from_a_buffer()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST* faults = (FAULT_LIST*) calloc(1, sizeof(FAULT_LIST));
+	char* list = "# comment line\n"
+				 "A /0 /1\n"
+				 "\tB->H /1   # trailing comment\r\n"
+				 "\n"
+				 "B -> I /0/1\n"
+				 "A->L /0\n"
+				 "L /1";
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(populateCircuit(&circuit, &info, "benchmarks/test-0.bench"));
+	assert_true(parseFaultListBuffer(&circuit, &info, faults, list, strlen(list)));
+
+	int index_A = findIndex(&circuit, &info.numGates, "A", FALSE);
+	int index_B = findIndex(&circuit, &info.numGates, "B", FALSE);
+	int index_H = findIndex(&circuit, &info.numGates, "H", FALSE);
+	int index_I = findIndex(&circuit, &info.numGates, "I", FALSE);
+	int index_L = findIndex(&circuit, &info.numGates, "L", FALSE);
+
+	// The branch from A to L does not exist and is ignored
+	int index[]    = {index_A, index_A, index_B, index_B, index_B, index_L};
+	int indexOut[] = {-1, -1, index_H, index_I, index_I, -1};
+	int type[]     = {ST_0, ST_1, ST_1, ST_0, ST_1, ST_1};
+
+	assert_int_equal(6, faults->count);
+	assert_true(faults->capacity >= faults->count);
+
+	int K;
+	for(K = 0; K < faults->count; K++)
+	{
+		assert_int_equal(index[K], faults->faults[K].index);
+		assert_int_equal(indexOut[K], faults->faults[K].indexOut);
+		assert_int_equal(type[K], faults->faults[K].type);
+		assert_false(IS_DETECTED(faults, K));
+	}
+
+	// Clear memories
+	clearFaultList(faults);
+	assert_int_equal(0, faults->count);
+	free(faults);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_index_faults_by_gate_and_count_statuses()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST* faults = (FAULT_LIST*) calloc(1, sizeof(FAULT_LIST));
+	char* list = "A /0 /1\n"
+				 "B->H /1\n"
+				 "B->I /0 /1\n"
+				 "B /0\n";
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(populateCircuit(&circuit, &info, "benchmarks/test-0.bench"));
+	assert_true(parseFaultListBuffer(&circuit, &info, faults, list, strlen(list)));
+	indexFaultsByGate(faults, info.numGates);
+
+	int index_A = findIndex(&circuit, &info.numGates, "A", FALSE);
+	int index_B = findIndex(&circuit, &info.numGates, "B", FALSE);
+	int index_L = findIndex(&circuit, &info.numGates, "L", FALSE);
+
+	// The main segment faults of a gate come before its fan out segment faults
+	int faultsA[] = {0, 1};
+	int faultsB[] = {5, 2, 3, 4};
+	assert_int_equal(2, faults->gateStart[index_A + 1] - faults->gateStart[index_A]);
+	assert_int_equal(faults->gateStart[index_A + 1], faults->branchStart[index_A]);
+	assert_n_array_equal(faultsA, (&faults->byGate[faults->gateStart[index_A]]), 2);
+	assert_int_equal(4, faults->gateStart[index_B + 1] - faults->gateStart[index_B]);
+	assert_int_equal(faults->gateStart[index_B] + 1, faults->branchStart[index_B]);
+	assert_n_array_equal(faultsB, (&faults->byGate[faults->gateStart[index_B]]), 4);
+	assert_int_equal(faults->gateStart[index_L], faults->gateStart[index_L + 1]);
+	assert_int_equal(faults->count, faults->gateStart[info.numGates]);
+
+	// The statuses are counted from their bitmaps
+	SET_FAULT_STATUS(faults, 0, FAULT_DETECTED);
+	SET_FAULT_STATUS(faults, 4, FAULT_DETECTED);
+	SET_FAULT_STATUS(faults, 5, FAULT_ABORTED);
+	assert_int_equal(2, countFaults(faults, FAULT_DETECTED));
+	assert_int_equal(1, countFaults(faults, FAULT_ABORTED));
+	assert_int_equal(0, countFaults(faults, FAULT_REDUNDANT));
+	assert_true(IS_DETECTED(faults, 4));
+	assert_false(IS_DETECTED(faults, 5));
+
+	// Clear memories
+	clearFaultList(faults);
+	free(faults);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_save_and_load_fault_lists()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST* faults = (FAULT_LIST*) calloc(1, sizeof(FAULT_LIST));
+	FAULT_LIST* loaded = (FAULT_LIST*) calloc(1, sizeof(FAULT_LIST));
+	char* textFilename = "bin/test-0" FAULT_FILE_EXTENSION;
+	char* binaryFilename = "bin/test-0" BINARY_FAULT_FILE_EXTENSION;
+	char* list = "A /0 /1\n"
+				 "B->H /1\n"
+				 "B->I /0 /1\n"
+				 "L /0\n";
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(populateCircuit(&circuit, &info, "benchmarks/test-0.bench"));
+	assert_true(parseFaultListBuffer(&circuit, &info, faults, list, strlen(list)));
+	SET_FAULT_STATUS(faults, 1, FAULT_DETECTED);
+
+	// The binary fault list keeps the detection status of the faults
+	assert_true(isBinaryFaultListFilename(binaryFilename));
+	assert_false(isBinaryFaultListFilename(textFilename));
+	assert_true(saveBinaryFaultList(&circuit, &info, faults, binaryFilename, FALSE, 42));
+	assert_true(loadFaultList(&circuit, &info, loaded, binaryFilename, 42));
+
+	int K;
+	assert_int_equal(faults->count, loaded->count);
+	for(K = 0; K < faults->count; K++)
+	{
+		assert_int_equal(faults->faults[K].index, loaded->faults[K].index);
+		assert_int_equal(faults->faults[K].indexOut, loaded->faults[K].indexOut);
+		assert_int_equal(faults->faults[K].type, loaded->faults[K].type);
+		assert_int_equal(IS_DETECTED(faults, K), IS_DETECTED(loaded, K));
+	}
+	clearFaultList(loaded);
+
+	// Only the undetected faults are saved into the text fault list
+	assert_true(saveFaultList(&circuit, faults, textFilename, TRUE));
+	assert_true(loadFaultList(&circuit, &info, loaded, textFilename, 42));
+
+	assert_int_equal(faults->count - 1, loaded->count);
+	for(K = 0; K < loaded->count; K++)
+	{
+		assert_int_equal(faults->faults[K + (K > 0)].index, loaded->faults[K].index);
+		assert_int_equal(faults->faults[K + (K > 0)].indexOut, loaded->faults[K].indexOut);
+		assert_int_equal(faults->faults[K + (K > 0)].type, loaded->faults[K].type);
+	}
+
+	// Clear memories
+	remove(textFilename);
+	remove(binaryFilename);
+	clearFaultList(faults);
+	clearFaultList(loaded);
+	free(faults);
+	free(loaded);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_save_and_load_compressed_fault_lists()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	FAULT_LIST* faults = (FAULT_LIST*) calloc(1, sizeof(FAULT_LIST));
+	FAULT_LIST* loaded = (FAULT_LIST*) calloc(1, sizeof(FAULT_LIST));
+	char* filename = "bin/test-1" BINARY_FAULT_FILE_EXTENSION COMPRESSED_FILE_EXTENSION;
+	char* list = "A /0 /1\n"
+				 "B->H /1\n"
+				 "L /0\n";
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(populateCircuitMapped(&circuit, &info, "benchmarks/test-0.bench"));
+	assert_true(parseFaultListBuffer(&circuit, &info, faults, list, strlen(list)));
+	SET_FAULT_STATUS(faults, 2, FAULT_DETECTED);
+
+	assert_true(isCompressedFilename(filename));
+	assert_true(isBinaryFaultListFilename(filename));
+	assert_true(saveBinaryFaultList(&circuit, &info, faults, filename, FALSE, 42));
+
+	// The file holds gzip data, which is decompressed as it is loaded
+	DATA_FILE file;
+	assert_true(loadDataFile(&file, filename));
+	assert_false(file.isMapped);
+	assert_true(file.size > sizeof(BINARY_FAULT_LIST_MAGIC));
+	assert_true(memcmp(file.data, BINARY_FAULT_LIST_MAGIC, sizeof(BINARY_FAULT_LIST_MAGIC)) == 0);
+	releaseDataFile(&file);
+
+	FILE* fp = fopen(filename, "rb");
+	assert_true(fp != NULL);
+	assert_int_equal(0x1f, fgetc(fp));
+	assert_int_equal(0x8b, fgetc(fp));
+	fclose(fp);
+
+	assert_true(loadFaultList(&circuit, &info, loaded, filename, 42));
+	int K;
+	assert_int_equal(faults->count, loaded->count);
+	for(K = 0; K < faults->count; K++)
+	{
+		assert_int_equal(faults->faults[K].index, loaded->faults[K].index);
+		assert_int_equal(faults->faults[K].indexOut, loaded->faults[K].indexOut);
+		assert_int_equal(faults->faults[K].type, loaded->faults[K].type);
+		assert_int_equal(IS_DETECTED(faults, K), IS_DETECTED(loaded, K));
+	}
+
+	// Clear memories
+	remove(filename);
+	clearFaultList(faults);
+	clearFaultList(loaded);
+	free(faults);
+	free(loaded);
+	clearCircuit(&circuit, &info);
+}
@@ -18,10 +18,17 @@
  *
  * =====================================================================================
  */
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <strings.h>
 
 #include "seatest.h"
 #include "parser_netlist.h"
+#include "logic_tables.h"
+#include "netlist_cache.h"
+#include "parser_threaded.h"
+#include "symbol_table.h"
 #include "globals.h"
 
 /*
@@ -32,6 +39,13 @@ void test_append_a_gate_into_a_circuit();
 void test_search_gate_index_in_a_circuit();
 
 void test_populate_circuit_from_an_input_file();
+void test_populate_circuit_from_a_mapped_file();
+void test_parse_netlist_from_a_buffer();
+void test_save_and_load_a_compiled_netlist();
+void test_parse_netlist_with_threads();
+void test_parse_gates_beyond_the_former_limits();
+void test_parse_an_output_feeding_a_gate();
+void test_intern_gate_names_beyond_the_circuit_limits();
 
 
 /*
@@ -48,58 +62,98 @@ void test_fixture_Parsing_Netlist_File( void )
 	run_test(test_search_gate_index_in_a_circuit);
 
 	run_test(test_populate_circuit_from_an_input_file);
+	run_test(test_populate_circuit_from_a_mapped_file);
+	run_test(test_parse_netlist_from_a_buffer);
+	run_test(test_save_and_load_a_compiled_netlist);
+	run_test(test_parse_netlist_with_threads);
+	run_test(test_parse_gates_beyond_the_former_limits);
+	run_test(test_parse_an_output_feeding_a_gate);
+	run_test(test_intern_gate_names_beyond_the_circuit_limits);
 
 	// Ends a fixture
 	test_fixture_end();                 
 }
 
+/*
+ *	Checks that two circuits have the same gates and connections
+ */
+static void assert_same_circuits( CIRCUIT* expected, CIRCUIT* actual, int numGates )
+{
+	int K;
+	for(K = 0; K < numGates; K++)
+	{
+		assert_string_equal(GATE_NAME(expected, K), GATE_NAME(actual, K));
+		assert_int_equal(expected->type[K], actual->type[K]);
+		assert_int_equal(expected->inv[K], actual->inv[K]);
+		assert_int_equal(expected->PO[K], actual->PO[K]);
+		assert_int_equal(expected->level[K], actual->level[K]);
+		assert_int_equal(NUM_FANIN(expected, K), NUM_FANIN(actual, K));
+		assert_int_equal(NUM_FANOUT(expected, K), NUM_FANOUT(actual, K));
+		assert_n_array_equal((&FANIN(expected, K, 0)), (&FANIN(actual, K, 0)), NUM_FANIN(expected, K));
+		assert_n_array_equal((&FANIN_BRANCH(expected, K, 0)), (&FANIN_BRANCH(actual, K, 0)), NUM_FANIN(expected, K));
+		assert_n_array_equal((&FANOUT(expected, K, 0)), (&FANOUT(actual, K, 0)), NUM_FANOUT(expected, K));
+	}
+}
+
 /*		*/
 void test_create_empty_circuit()
 {
 	CIRCUIT circuit;
-	assert_true((circuit[0] == NULL));
-	assert_int_equal(sizeof(circuit[0]), sizeof(NULL));
+	bzero(&circuit, sizeof(circuit));
+
+	assert_int_equal(circuit.capacity, 0);
+	assert_true((circuit.type == NULL));
+	assert_int_equal(getCircuitMemoryUsage(&circuit, 0), 2 * sizeof(int32_t));
 }
 
 /*		*/
 void test_append_a_gate_into_a_circuit()
 {
 	CIRCUIT circuit;
+	CIRCUIT_INFO info;
 	int total = 0;
 
-	appendNewGate(circuit, &total, "joy");
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	appendNewGate(&circuit, &total, "joy");
 
-	assert_false((circuit[0] == NULL));
-	assert_int_equal(sizeof(*circuit[0]), sizeof(GATE));
+	assert_true((circuit.capacity >= 1));
 	assert_int_equal(total, 1);
-	assert_string_equal(circuit[0]->name, "joy");
+	assert_string_equal(GATE_NAME(&circuit, 0), "joy");
+	assert_true((circuit.type[0] == OTHER && circuit.value[0] == X));
 
 	// Clean up
-	if(circuit[0]) free(circuit[0]);
+	info.numGates = total;
+	clearCircuit(&circuit, &info);
 }
 
 /*		*/
 void test_search_gate_index_in_a_circuit()
 {
 	CIRCUIT circuit;
+	CIRCUIT_INFO info;
 	int total = 0;
 
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+
 	// Search unavaible gate without adding
-	int index = findIndex(circuit, &total, "hey", FALSE);
+	int index = findIndex(&circuit, &total, "hey", FALSE);
 	assert_int_equal(total, 0);
 	assert_int_equal(index, 0);
 
 	// Search unavaible gate with adding
-	index = findIndex(circuit, &total, "hey", TRUE);
+	index = findIndex(&circuit, &total, "hey", TRUE);
 	assert_int_equal(total, 1);
 	assert_int_equal(index, 0);
 
 	// Search an available gate
-	index = findIndex(circuit, &total, "hey", TRUE);
+	index = findIndex(&circuit, &total, "hey", TRUE);
 	assert_int_equal(total, 1);
 	assert_int_equal(index, 0);
 
-	if(circuit[0]) free(circuit[0]);
+	info.numGates = total;
+	clearCircuit(&circuit, &info);
 }
 
 /*		*/
@@ -114,7 +168,9 @@ void test_populate_circuit_from_an_input_file()
 
 	char* filename = "benchmarks/test-0.bench";
 
-	if(populateCircuit(circuit, &info, filename) == FALSE)
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	if(populateCircuit(&circuit, &info, filename) == FALSE)
 		printf("ERROR\n");
 
 	// Test for circuit statistics
@@ -123,37 +179,39 @@ void test_populate_circuit_from_an_input_file()
 	assert_int_equal(info.numPO, 	TOTAL_PRIMARY_OUTPUT_LINES);
 
 	// Test for gate types flags
-	int index_NOT = findIndex(circuit, &info.numGates, "J", FALSE);
-	int index_AND = findIndex(circuit, &info.numGates, "H", FALSE);
-	int index_OR  = findIndex(circuit, &info.numGates, "K", FALSE);
+	int index_NOT = findIndex(&circuit, &info.numGates, "J", FALSE);
+	int index_AND = findIndex(&circuit, &info.numGates, "H", FALSE);
+	int index_OR  = findIndex(&circuit, &info.numGates, "K", FALSE);
 	
-	assert_true((circuit[index_NOT]->type == BUF && circuit[index_NOT]->inv == TRUE));
-	assert_true((circuit[index_AND]->type == AND && circuit[index_AND]->inv == FALSE));
-	assert_true((circuit[index_OR]->type  == OR  && circuit[index_OR]->inv == FALSE));
+	assert_true((circuit.type[index_NOT] == BUF && circuit.inv[index_NOT] == TRUE));
+	assert_true((circuit.type[index_AND] == AND && circuit.inv[index_AND] == FALSE));
+	assert_true((circuit.type[index_OR]  == OR  && circuit.inv[index_OR] == FALSE));
 
 	// Test for primary output and output flags
-	int index_PI = findIndex(circuit, &info.numGates, "B", FALSE);
-	int index_PO = findIndex(circuit, &info.numGates, "L", FALSE);
+	int index_PI = findIndex(&circuit, &info.numGates, "B", FALSE);
+	int index_PO = findIndex(&circuit, &info.numGates, "L", FALSE);
 
-	assert_true((circuit[index_PI]->type == PI));
-	assert_true((circuit[index_PO]->PO == TRUE));
+	assert_true((circuit.type[index_PI] == PI));
+	assert_true((circuit.PO[index_PO] == TRUE));
 
 	// Test for input and output lists to a gate
 	#define TOTAL_INPUT_LINES 	2
-	int index_IN   = findIndex(circuit, &info.numGates, "H", FALSE);
-	int index_IN_1 = findIndex(circuit, &info.numGates, "A", FALSE);
-	int index_IN_2 = findIndex(circuit, &info.numGates, "B", FALSE);
-	int in_list[MAX_INPUT_GATES] = {index_IN_1, index_IN_2};
+	int index_IN   = findIndex(&circuit, &info.numGates, "H", FALSE);
+	int index_IN_1 = findIndex(&circuit, &info.numGates, "A", FALSE);
+	int index_IN_2 = findIndex(&circuit, &info.numGates, "B", FALSE);
+	int in_list[] = {index_IN_1, index_IN_2};
 
-	assert_n_array_equal(in_list, circuit[index_IN]->in, TOTAL_INPUT_LINES);
+	assert_int_equal(NUM_FANIN(&circuit, index_IN), TOTAL_INPUT_LINES);
+	assert_n_array_equal(in_list, (&FANIN(&circuit, index_IN, 0)), TOTAL_INPUT_LINES);
 
 	#define TOTAL_OUTPUT_LINES 	2
-	int index_OUT   = findIndex(circuit, &info.numGates, "B", FALSE);
-	int index_OUT_1 = findIndex(circuit, &info.numGates, "H", FALSE);
-	int index_OUT_2 = findIndex(circuit, &info.numGates, "I", FALSE);
-	int out_list[MAX_INPUT_GATES] = {index_IN_1, index_IN_2};
+	int index_OUT   = findIndex(&circuit, &info.numGates, "B", FALSE);
+	int index_OUT_1 = findIndex(&circuit, &info.numGates, "H", FALSE);
+	int index_OUT_2 = findIndex(&circuit, &info.numGates, "I", FALSE);
+	int out_list[] = {index_OUT_1, index_OUT_2};
 
-	assert_n_array_equal(out_list, circuit[index_IN]->in, TOTAL_OUTPUT_LINES);
+	assert_int_equal(NUM_FANOUT(&circuit, index_OUT), TOTAL_OUTPUT_LINES);
+	assert_n_array_equal(out_list, (&FANOUT(&circuit, index_OUT, 0)), TOTAL_OUTPUT_LINES);
 
 	// Test for gate names flags
 	char* gate_names[] = {"A", "B", "C", "E", "L", "J", "I", "H", "K"};
@@ -161,10 +219,317 @@ void test_populate_circuit_from_an_input_file()
 
 	for(; K < TOTAL_LINES; K++)
 	{
-		assert_string_equal(gate_names[K], circuit[K]->name);
+		assert_string_equal(gate_names[K], GATE_NAME(&circuit, K));
+	}
+
+	// Clear memories
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_populate_circuit_from_a_mapped_file()
+{
+	CIRCUIT circuit, mapped;
+	CIRCUIT_INFO info, mappedInfo;
+	char* filename = "benchmarks/test-0.bench";
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&mapped, sizeof(mapped));
+	bzero(&info, sizeof(info));
+	bzero(&mappedInfo, sizeof(mappedInfo));
+
+	// Both parsers must build the same circuit
+	assert_true(populateCircuit(&circuit, &info, filename));
+	assert_true(populateCircuitMapped(&mapped, &mappedInfo, filename));
+
+	assert_int_equal(info.numGates, mappedInfo.numGates);
+	assert_int_equal(info.numPI, mappedInfo.numPI);
+	assert_int_equal(info.numPO, mappedInfo.numPO);
+	assert_n_array_equal(info.inputs, mappedInfo.inputs, info.numPI);
+	assert_n_array_equal(info.outputs, mappedInfo.outputs, info.numPO);
+	assert_same_circuits(&circuit, &mapped, info.numGates);
+
+	// Clear memories
+	clearCircuit(&circuit, &info);
+	clearCircuit(&mapped, &mappedInfo);
+}
+
+/*		*/
+void test_parse_netlist_from_a_buffer()
+{
+	CIRCUIT circuit;
+	CIRCUIT_INFO info;
+	char* netlist = "# comment line\n"
+					"INPUT( a )\r\n"
+					"\tINPUT(b)\n"
+					"OUTPUT(y)   # trailing comment\n"
+					"\n"
+					"y = NAND( a ,b,\tn )\n"
+					"n = NOT(a)";
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, netlist, strlen(netlist)));
+
+	assert_int_equal(info.numGates, 4);
+	assert_int_equal(info.numPI, 2);
+	assert_int_equal(info.numPO, 1);
+
+	int index_y = findIndex(&circuit, &info.numGates, "y", FALSE);
+	int index_n = findIndex(&circuit, &info.numGates, "n", FALSE);
+	int in_list[] = {findIndex(&circuit, &info.numGates, "a", FALSE),
+					 findIndex(&circuit, &info.numGates, "b", FALSE), index_n};
+
+	assert_true((circuit.type[index_y] == AND && circuit.inv[index_y] == TRUE));
+	assert_true((circuit.type[index_n] == BUF && circuit.inv[index_n] == TRUE));
+	assert_int_equal(NUM_FANIN(&circuit, index_y), 3);
+	assert_n_array_equal(in_list, (&FANIN(&circuit, index_y, 0)), 3);
+	assert_true(circuit.PO[index_y]);
+
+	// Every input knows the fan out segment feeding it
+	int K;
+	for(K = 0; K < NUM_FANIN(&circuit, index_y); K++)
+		assert_int_equal(index_y, circuit.fanout[FANIN_BRANCH(&circuit, index_y, K)]);
+	assert_int_equal(FANIN_BRANCH(&circuit, index_n, 0), findFanoutBranch(&circuit, in_list[0], index_n));
+
+	// Clear memories
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_save_and_load_a_compiled_netlist()
+{
+	CIRCUIT circuit, compiled;
+	CIRCUIT_INFO info, compiledInfo;
+	char* filename = "benchmarks/test-0.bench";
+	char* cacheFilename = "bin/test-0.bench" COMPILED_NETLIST_EXTENSION;
+	uint64_t hash, size;
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&compiled, sizeof(compiled));
+	bzero(&info, sizeof(info));
+	bzero(&compiledInfo, sizeof(compiledInfo));
+
+	assert_true(hashNetlistFile(filename, &hash, &size));
+	assert_true(populateCircuit(&circuit, &info, filename));
+	computeGateLevels(&circuit, &info);
+	assert_true(saveCompiledNetlist(&circuit, &info, cacheFilename, hash, size));
+
+	// A compiled netlist of a different source is rejected
+	assert_false(loadCompiledNetlist(&compiled, &compiledInfo, cacheFilename, hash + 1, size));
+	assert_true(loadCompiledNetlist(&compiled, &compiledInfo, cacheFilename, hash, size));
+
+	assert_int_equal(info.numGates, compiledInfo.numGates);
+	assert_int_equal(info.numPI, compiledInfo.numPI);
+	assert_int_equal(info.numPO, compiledInfo.numPO);
+	assert_n_array_equal(info.inputs, compiledInfo.inputs, info.numPI);
+	assert_n_array_equal(info.outputs, compiledInfo.outputs, info.numPO);
+	assert_same_circuits(&circuit, &compiled, info.numGates);
+
+	// The built arrays are used in place of the file, the event queue included
+	assert_true(compiled.image != NULL);
+	assert_true((compiled.type >= (uint8_t*) compiled.image &&
+				 compiled.type < (uint8_t*) compiled.image + compiled.imageSize));
+	assert_n_array_equal(circuit.order, compiled.order, info.numGates);
+	assert_int_equal(circuit.events.numLevels, compiled.events.numLevels);
+	assert_n_array_equal(circuit.events.bucketStart, compiled.events.bucketStart,
+						 circuit.events.numLevels + 1);
+
+	int K;
+	for(K = 0; K < info.numGates; K++)
+	{
+		assert_int_equal(K, findIndex(&compiled, &compiledInfo.numGates, GATE_NAME(&circuit, K), FALSE));
+		assert_int_equal(circuit.kernel[K], compiled.kernel[K]);
+		assert_int_equal(X, compiled.value[K]);
+	}
+	clearCircuit(&compiled, &compiledInfo);
+
+	// A single corrupted byte of a section is rejected rather than loaded
+	COMPILED_NETLIST_HEADER header;
+	FILE* fp = fopen(cacheFilename, "r+b");
+	assert_true(fread(&header, sizeof(header), 1, fp) == 1);
+	fseek(fp, header.sectionOffset[SECTION_FANIN], SEEK_SET);
+	int byte = fgetc(fp);
+	fseek(fp, header.sectionOffset[SECTION_FANIN], SEEK_SET);
+	fputc(byte ^ 0xff, fp);
+	fclose(fp);
+	bzero(&compiled, sizeof(compiled));
+	bzero(&compiledInfo, sizeof(compiledInfo));
+	assert_false(loadCompiledNetlist(&compiled, &compiledInfo, cacheFilename, hash, size));
+
+	// Clear memories
+	remove(cacheFilename);
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_parse_netlist_with_threads()
+{
+	CIRCUIT circuit, threaded;
+	CIRCUIT_INFO info, threadedInfo;
+	char* netlist = "INPUT(a)\n"
+					"INPUT(b)\n"
+					"INPUT(c)\n"
+					"OUTPUT(y)\n"
+					"OUTPUT(z)\n"
+					"# gates referenced before their definition\n"
+					"y = NAND(m, n)\n"
+					"m = AND(a, b)\n"
+					"\n"
+					"n = XNOR(b, c, m)\n"
+					"z = NOT(n)\n";
+	int threads[] = {1, 2, 3, 5, 16};
+	int T;
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, netlist, strlen(netlist)));
+
+	for(T = 0; T < sizeof(threads) / sizeof(int); T++)
+	{
+		bzero(&threaded, sizeof(threaded));
+		bzero(&threadedInfo, sizeof(threadedInfo));
+		assert_true(parseNetlistBufferThreaded(&threaded, &threadedInfo, netlist,
+											   strlen(netlist), threads[T]));
+
+		assert_int_equal(info.numGates, threadedInfo.numGates);
+		assert_int_equal(info.numPI, threadedInfo.numPI);
+		assert_int_equal(info.numPO, threadedInfo.numPO);
+		assert_n_array_equal(info.inputs, threadedInfo.inputs, info.numPI);
+		assert_n_array_equal(info.outputs, threadedInfo.outputs, info.numPO);
+		assert_same_circuits(&circuit, &threaded, info.numGates);
+
+		clearCircuit(&threaded, &threadedInfo);
+	}
+
+	// Clear memories
+	clearCircuit(&circuit, &info);
+}
+
+/*		*/
+void test_parse_gates_beyond_the_former_limits()
+{
+	CIRCUIT circuit, threaded;
+	CIRCUIT_INFO info, threadedInfo;
+	int numSinks = 6000, K;
+	char longName[100];
+	char* netlist = (char*) malloc((numSinks + 1) * (sizeof(longName) + 128));
+	size_t size;
+
+	// A gate with a long name fans out to more gates than a gate used to hold,
+	// which all feed a single gate. As many inputs are buffered into outputs:
+	// a circuit held at most 2000 of each.
+	memset(longName, 'g', sizeof(longName) - 1);
+	longName[sizeof(longName) - 1] = '\0';
+	size = sprintf(netlist, "INPUT(%s)\nOUTPUT(y)\n", longName);
+	for(K = 0; K < numSinks; K++)
+		size += sprintf(netlist + size, "s%d = NOT(%s)\n", K, longName);
+	size += sprintf(netlist + size, "y = AND(s0");
+	for(K = 1; K < numSinks; K++)
+		size += sprintf(netlist + size, ", s%d", K);
+	size += sprintf(netlist + size, ")\n");
+	for(K = 0; K < numSinks; K++)
+		size += sprintf(netlist + size, "INPUT(i%d)\nOUTPUT(o%d)\no%d = BUF(i%d)\n", K, K, K, K);
+
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, netlist, size));
+	assert_int_equal(info.numGates, 3 * numSinks + 2);
+	assert_int_equal(info.numPI, numSinks + 1);
+	assert_int_equal(info.numPO, numSinks + 1);
+	assert_int_equal(info.inputs[numSinks], 3 * numSinks);
+	assert_int_equal(info.outputs[numSinks], 3 * numSinks + 1);
+	assert_string_equal(GATE_NAME(&circuit, 0), longName);
+	assert_int_equal(NUM_FANOUT(&circuit, 0), numSinks);
+	assert_int_equal(NUM_FANIN(&circuit, 1), numSinks);
+	for(K = 0; K < numSinks; K++)
+	{
+		assert_int_equal(FANOUT(&circuit, 0, K), K + 2);
+		assert_int_equal(FANIN(&circuit, 1, K), K + 2);
 	}
 
+	bzero(&threaded, sizeof(threaded));
+	bzero(&threadedInfo, sizeof(threadedInfo));
+	assert_true(parseNetlistBufferThreaded(&threaded, &threadedInfo, netlist, size, 3));
+	assert_int_equal(info.numGates, threadedInfo.numGates);
+	assert_same_circuits(&circuit, &threaded, info.numGates);
+	assert_int_equal(info.numPI, threadedInfo.numPI);
+	assert_int_equal(info.numPO, threadedInfo.numPO);
+	assert_true(memcmp(info.inputs, threadedInfo.inputs, info.numPI * sizeof(int32_t)) == 0);
+	assert_true(memcmp(info.outputs, threadedInfo.outputs, info.numPO * sizeof(int32_t)) == 0);
+
 	// Clear memories
-	for(K = 0; K < TOTAL_LINES; K++)
-		if(circuit[K]) free(circuit[K]);
+	free(netlist);
+	clearCircuit(&circuit, &info);
+	clearCircuit(&threaded, &threadedInfo);
+}
+
+/*		*/
+void test_parse_an_output_feeding_a_gate()
+{
+	CIRCUIT circuit, threaded;
+	CIRCUIT_INFO info, threadedInfo;
+	char* netlist = "INPUT(a)\n"
+					"INPUT(b)\n"
+					"OUTPUT(n)\n"
+					"OUTPUT(y)\n"
+					"n = NOT(a)\n"
+					"q = DFF(n)\n"
+					"r = DFF(n)\n"
+					"y = AND(n, b, q, r)\n";
+
+	// An output feeding a gate and two flip-flops, as DATA_9_31 does in s35932
+	bzero(&circuit, sizeof(circuit));
+	bzero(&info, sizeof(info));
+	assert_true(parseNetlistBuffer(&circuit, &info, netlist, strlen(netlist)));
+	int index_n = findIndex(&circuit, &info.numGates, "n", FALSE);
+	int index_y = findIndex(&circuit, &info.numGates, "y", FALSE);
+	assert_true(circuit.PO[index_n]);
+	assert_true(circuit.PPO[index_n]);
+	assert_int_equal(info.numPPO, 1);
+	assert_int_equal(NUM_FANOUT(&circuit, index_n), 1);
+	assert_int_equal(FANOUT(&circuit, index_n, 0), index_y);
+
+	bzero(&threaded, sizeof(threaded));
+	bzero(&threadedInfo, sizeof(threadedInfo));
+	assert_true(parseNetlistBufferThreaded(&threaded, &threadedInfo, netlist, strlen(netlist), 2));
+	assert_int_equal(info.numGates, threadedInfo.numGates);
+	assert_int_equal(info.numPPO, threadedInfo.numPPO);
+	assert_same_circuits(&circuit, &threaded, info.numGates);
+
+	// Clear memories
+	clearCircuit(&circuit, &info);
+	clearCircuit(&threaded, &threadedInfo);
+}
+
+/*		*/
+void test_intern_gate_names_beyond_the_circuit_limits()
+{
+	SYMBOL_TABLE table;
+	char name[32];
+	int K, len, total = 300000;
+
+	// Three times the 100000 gates a circuit used to hold
+	bzero(&table, sizeof(table));
+	for(K = 0; K < total; K++)
+	{
+		len = sprintf(name, "G%d", K);
+		assert_int_equal(K, internSymbol(&table, name, len, hashSymbol(name, len), K));
+	}
+	assert_int_equal(total, table.count);
+	assert_true((2 * table.count <= table.capacity));
+
+	// Names keep their first id and survive every growth of the table
+	for(K = 0; K < total; K += 7)
+	{
+		len = sprintf(name, "G%d", K);
+		assert_int_equal(K, internSymbol(&table, name, len, hashSymbol(name, len), total + K));
+		assert_int_equal(K, findSymbol(&table, name, len, hashSymbol(name, len)));
+	}
+	assert_int_equal(-1, findSymbol(&table, "G", 1, hashSymbol("G", 1)));
+	assert_int_equal(total, table.count);
+
+	releaseSymbolTable(&table);
+	assert_int_equal(0, table.count);
+	assert_int_equal(-1, findSymbol(&table, "G0", 2, hashSymbol("G0", 2)));
 }